@@ -0,0 +1,419 @@
+#include "mpicpp-lite/mpicpp-lite.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
+#include "framework/mesh/mesh_generator/mesh_generator.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh.h"
+#include "framework/math/quadratures/angular_product_quadrature.h"
+#include "framework/physics/physics_material/physics_material.h"
+#include "framework/physics/physics_material/multi_group_xs/single_state_mgxs.h"
+#include "framework/parameters/parameter_block.h"
+#include "framework/object_factory.h"
+#include "framework/utils/timer.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <petsc.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace mpi = mpicpp_lite;
+using namespace opensn;
+
+namespace
+{
+
+/**Benchmark configuration, set from `--key=value` command line arguments.*/
+struct BenchmarkOptions
+{
+  int nx = 32;
+  int ny = 32;
+  /// Number of cells in z. Zero gives a 2D mesh.
+  int nz = 32;
+  double length = 10.0;
+  int num_groups = 16;
+  int num_azimuthal = 4;
+  int num_polar = 2;
+  int scattering_order = 0;
+  int num_sweeps = 5;
+  std::string sweep_type = "both";
+  bool dsa = false;
+  std::string output = "sweep_benchmark.json";
+};
+
+void
+PrintUsage()
+{
+  std::cout << "Usage: opensn-sweep-benchmark [--key=value ...]\n"
+            << "  --nx, --ny, --nz     Number of cells per direction (nz=0 gives 2D)\n"
+            << "  --length             Side length of the domain\n"
+            << "  --groups             Number of energy groups\n"
+            << "  --azimuthal          Number of azimuthal angles per octant\n"
+            << "  --polar              Number of polar angles per octant\n"
+            << "  --scattering-order   Scattering order\n"
+            << "  --sweeps             Number of timed sweeps\n"
+            << "  --sweep-type         AAH, CBC or both\n"
+            << "  --dsa                Also time a WGDSA application (0 or 1)\n"
+            << "  --output             Path of the JSON report\n";
+}
+
+BenchmarkOptions
+ParseOptions(int argc, char** argv)
+{
+  BenchmarkOptions options;
+  for (int i = 1; i < argc; ++i)
+  {
+    const std::string arg = argv[i];
+    const size_t eq = arg.find('=');
+    OpenSnInvalidArgumentIf(arg.rfind("--", 0) != 0 or eq == std::string::npos,
+                            "Arguments must be of the form --key=value, got \"" + arg + "\".");
+    const std::string key = arg.substr(2, eq - 2);
+    const std::string value = arg.substr(eq + 1);
+
+    if (key == "nx")
+      options.nx = std::stoi(value);
+    else if (key == "ny")
+      options.ny = std::stoi(value);
+    else if (key == "nz")
+      options.nz = std::stoi(value);
+    else if (key == "length")
+      options.length = std::stod(value);
+    else if (key == "groups")
+      options.num_groups = std::stoi(value);
+    else if (key == "azimuthal")
+      options.num_azimuthal = std::stoi(value);
+    else if (key == "polar")
+      options.num_polar = std::stoi(value);
+    else if (key == "scattering-order")
+      options.scattering_order = std::stoi(value);
+    else if (key == "sweeps")
+      options.num_sweeps = std::stoi(value);
+    else if (key == "sweep-type")
+      options.sweep_type = value;
+    else if (key == "dsa")
+      options.dsa = std::stoi(value) != 0;
+    else if (key == "output")
+      options.output = value;
+    else
+      OpenSnInvalidArgument("Unknown argument \"--" + key + "\".");
+  }
+
+  OpenSnInvalidArgumentIf(options.nx < 1 or options.ny < 1 or options.nz < 0,
+                          "Cell counts must be positive.");
+  OpenSnInvalidArgumentIf(options.num_groups < 1, "--groups must be positive.");
+  OpenSnInvalidArgumentIf(options.num_sweeps < 1, "--sweeps must be positive.");
+  OpenSnInvalidArgumentIf(options.sweep_type != "AAH" and options.sweep_type != "CBC" and
+                            options.sweep_type != "both",
+                          "--sweep-type must be AAH, CBC or both.");
+  return options;
+}
+
+/**Creates the orthogonal mesh and sets a single material on it.*/
+void
+MakeMesh(const BenchmarkOptions& options)
+{
+  auto NodeSet = [&options](const std::string& name, int num_cells)
+  {
+    std::vector<double> nodes(num_cells + 1);
+    for (int i = 0; i <= num_cells; ++i)
+      nodes[i] = options.length * i / num_cells;
+    return ParameterBlock(name, nodes);
+  };
+
+  ParameterBlock node_sets("node_sets");
+  node_sets.AddParameter(NodeSet("0", options.nx));
+  node_sets.AddParameter(NodeSet("1", options.ny));
+  if (options.nz > 0)
+    node_sets.AddParameter(NodeSet("2", options.nz));
+  node_sets.ChangeToArray();
+
+  ParameterBlock params;
+  params.AddParameter(node_sets);
+
+  auto& factory = ObjectFactory::GetInstance();
+  const size_t handle = factory.MakeRegisteredObjectOfType("mesh::OrthogonalMeshGenerator", params);
+  auto& generator = GetStackItem<MeshGenerator>(object_stack, handle, __FUNCTION__);
+  generator.Execute();
+
+  GetCurrentMesh()->SetUniformMaterialID(0);
+}
+
+/**Creates a single scattering material and the angular quadrature. Returns the
+ * quadrature handle.*/
+size_t
+MakeMaterialAndQuadrature(const BenchmarkOptions& options)
+{
+  auto xs = std::make_shared<SingleStateMGXS>();
+  xs->MakeSimple1(options.num_groups, 1.0, 0.5);
+
+  auto material = std::make_shared<Material>();
+  material->name_ = "benchmark_material";
+  material->properties_.push_back(xs);
+  material_stack.push_back(material);
+  multigroup_xs_stack.push_back(xs);
+
+  auto quadrature =
+    std::make_shared<AngularQuadratureProdGLC>(options.num_azimuthal, options.num_polar);
+  angular_quadrature_stack.push_back(quadrature);
+  return angular_quadrature_stack.size() - 1;
+}
+
+lbs::DiscreteOrdinatesSolver&
+MakeSolver(const BenchmarkOptions& options,
+           const std::string& sweep_type,
+           const size_t quadrature_handle)
+{
+  ParameterBlock groupset("0");
+  groupset.AddParameter("groups_from_to", std::vector<int>{0, options.num_groups - 1});
+  groupset.AddParameter("angular_quadrature_handle", quadrature_handle);
+  groupset.AddParameter("inner_linear_method", std::string("richardson"));
+  groupset.AddParameter("apply_wgdsa", options.dsa);
+
+  ParameterBlock groupsets("groupsets");
+  groupsets.AddParameter(groupset);
+  groupsets.ChangeToArray();
+
+  ParameterBlock solver_options("options");
+  solver_options.AddParameter("scattering_order", options.scattering_order);
+  solver_options.AddParameter("save_angular_flux", sweep_type == "CBC");
+  solver_options.AddParameter("verbose_inner_iterations", false);
+
+  ParameterBlock params;
+  params.AddParameter("name", "sweep_benchmark_" + sweep_type);
+  params.AddParameter("num_groups", options.num_groups);
+  params.AddParameter(groupsets);
+  params.AddParameter("sweep_type", sweep_type);
+  params.AddParameter(solver_options);
+
+  auto& factory = ObjectFactory::GetInstance();
+  const size_t handle = factory.MakeRegisteredObjectOfType("lbs::DiscreteOrdinatesSolver", params);
+  auto& solver = GetStackItem<lbs::DiscreteOrdinatesSolver>(object_stack, handle, __FUNCTION__);
+  solver.Initialize();
+  return solver;
+}
+
+/**Timings of one sweep type, maximized over all processes.*/
+struct SweepTypeResults
+{
+  std::string sweep_type;
+  double sweep_time = 0.0;
+  double chunk_time = 0.0;
+  double communication_time = 0.0;
+  double source_time = 0.0;
+  double dsa_time = 0.0;
+};
+
+double
+GlobalMax(double value)
+{
+  double global_value = 0.0;
+  mpi_comm.all_reduce(value, global_value, mpi::op::max<double>());
+  return global_value;
+}
+
+/**Times the source evaluation, the sweeps and, if requested, a WGDSA
+ * application in isolation. All times are per application in milliseconds.*/
+SweepTypeResults
+RunSweepType(const BenchmarkOptions& options,
+             const std::string& sweep_type,
+             const size_t quadrature_handle)
+{
+  auto& solver = MakeSolver(options, sweep_type, quadrature_handle);
+  auto& groupset = solver.Groupsets().front();
+  auto& context = dynamic_cast<lbs::SweepWGSContext&>(solver.GetWGSContext(0));
+  auto& scheduler = context.sweep_scheduler_;
+
+  SweepTypeResults results;
+  results.sweep_type = sweep_type;
+
+  auto& phi_old = solver.PhiOldLocal();
+  auto& q_moments = solver.QMomentsLocal();
+  phi_old.assign(phi_old.size(), 1.0);
+
+  // Source evaluation
+  const lbs::SourceFlags source_flags =
+    lbs::APPLY_FIXED_SOURCES | lbs::APPLY_WGS_SCATTER_SOURCES | lbs::APPLY_AGS_SCATTER_SOURCES;
+  const auto source_function = solver.GetActiveSetSourceFunction();
+  mpi_comm.barrier();
+  Timer timer;
+  for (int n = 0; n < options.num_sweeps; ++n)
+  {
+    q_moments.assign(q_moments.size(), 0.0);
+    source_function(groupset, q_moments, phi_old, solver.DensitiesLocal(), source_flags);
+  }
+  results.source_time = GlobalMax(timer.GetTime() / options.num_sweeps);
+
+  // Sweeps. One untimed sweep warms up the buffers.
+  scheduler.SetDestinationPhi(solver.PhiNewLocal());
+  scheduler.ZeroOutputFluxDataStructures();
+  scheduler.Sweep();
+
+  scheduler.ResetSweepStatistics();
+  mpi_comm.barrier();
+  timer.Reset();
+  for (int n = 0; n < options.num_sweeps; ++n)
+  {
+    scheduler.ZeroOutputFluxDataStructures();
+    scheduler.Sweep();
+  }
+  const double local_sweep_time = timer.GetTime() / options.num_sweeps;
+
+  // The chunk time is the compute part of the sweep, the remainder is spent on
+  // communication and waiting for upstream data. Both are in ms.
+  const double local_chunk_time =
+    scheduler.GetSweepStatistics().compute_time / options.num_sweeps;
+  results.sweep_time = GlobalMax(local_sweep_time);
+  results.chunk_time = GlobalMax(local_chunk_time);
+  results.communication_time = GlobalMax(std::max(local_sweep_time - local_chunk_time, 0.0));
+
+  // Within-group DSA
+  if (options.dsa and groupset.apply_wgdsa_)
+  {
+    auto& phi_new = solver.PhiNewLocal();
+    mpi_comm.barrier();
+    timer.Reset();
+    for (int n = 0; n < options.num_sweeps; ++n)
+    {
+      std::vector<double> delta_phi_local;
+      solver.AssembleWGDSADeltaPhiVector(groupset, phi_new, delta_phi_local);
+      groupset.wgdsa_solver_->Assemble_b(delta_phi_local);
+      groupset.wgdsa_solver_->Solve(delta_phi_local);
+      solver.DisAssembleWGDSADeltaPhiVector(groupset, delta_phi_local, phi_new);
+    }
+    results.dsa_time = GlobalMax(timer.GetTime() / options.num_sweeps);
+  }
+
+  return results;
+}
+
+void
+WriteReport(const BenchmarkOptions& options,
+            const std::vector<SweepTypeResults>& all_results,
+            const size_t num_cells,
+            const size_t num_unknowns)
+{
+  std::ostringstream json;
+  json << std::setprecision(8);
+  json << "{\n"
+       << "  \"opensn_version\": \"" << GetVersionStr() << "\",\n"
+       << "  \"num_processes\": " << mpi_comm.size() << ",\n"
+       << "  \"config\": {\n"
+       << "    \"nx\": " << options.nx << ",\n"
+       << "    \"ny\": " << options.ny << ",\n"
+       << "    \"nz\": " << options.nz << ",\n"
+       << "    \"num_groups\": " << options.num_groups << ",\n"
+       << "    \"num_azimuthal\": " << options.num_azimuthal << ",\n"
+       << "    \"num_polar\": " << options.num_polar << ",\n"
+       << "    \"scattering_order\": " << options.scattering_order << ",\n"
+       << "    \"num_sweeps\": " << options.num_sweeps << ",\n"
+       << "    \"dsa\": " << (options.dsa ? "true" : "false") << "\n"
+       << "  },\n"
+       << "  \"num_cells\": " << num_cells << ",\n"
+       << "  \"num_unknowns\": " << num_unknowns << ",\n"
+       << "  \"results\": [\n";
+  for (size_t i = 0; i < all_results.size(); ++i)
+  {
+    const auto& results = all_results[i];
+    const double sweep_seconds = results.sweep_time * 1.0e-3;
+    json << "    {\n"
+         << "      \"sweep_type\": \"" << results.sweep_type << "\",\n"
+         << "      \"sweep_time_ms\": " << results.sweep_time << ",\n"
+         << "      \"compute_time_ms\": " << results.chunk_time << ",\n"
+         << "      \"communication_time_ms\": " << results.communication_time << ",\n"
+         << "      \"source_time_ms\": " << results.source_time << ",\n"
+         << "      \"dsa_time_ms\": " << results.dsa_time << ",\n"
+         << "      \"cells_per_second\": " << num_cells / sweep_seconds << ",\n"
+         << "      \"unknowns_per_second\": " << num_unknowns / sweep_seconds << "\n"
+         << "    }" << (i + 1 < all_results.size() ? "," : "") << "\n";
+  }
+  json << "  ]\n"
+       << "}\n";
+
+  std::ofstream file(options.output);
+  OpenSnLogicalErrorIf(not file.is_open(), "Failed to open \"" + options.output + "\".");
+  file << json.str();
+  std::cout << json.str();
+}
+
+int
+RunBenchmark(int argc, char** argv)
+{
+  for (int i = 1; i < argc; ++i)
+    if (std::string(argv[i]) == "--help")
+    {
+      if (mpi_comm.rank() == 0)
+        PrintUsage();
+      return 0;
+    }
+
+  const auto options = ParseOptions(argc, argv);
+
+  MakeMesh(options);
+  const size_t quadrature_handle = MakeMaterialAndQuadrature(options);
+
+  std::vector<std::string> sweep_types;
+  if (options.sweep_type == "AAH" or options.sweep_type == "both")
+    sweep_types.emplace_back("AAH");
+  if (options.sweep_type == "CBC" or options.sweep_type == "both")
+    sweep_types.emplace_back("CBC");
+
+  std::vector<SweepTypeResults> all_results;
+  size_t num_cells = 0;
+  size_t num_unknowns = 0;
+  for (const auto& sweep_type : sweep_types)
+  {
+    all_results.push_back(RunSweepType(options, sweep_type, quadrature_handle));
+
+    const auto& solver = dynamic_cast<const lbs::DiscreteOrdinatesSolver&>(*object_stack.back());
+    const auto& groupset = solver.Groupsets().front();
+    num_cells = solver.Grid().GetGlobalNumberOfCells();
+    num_unknowns = solver.GlobalNodeCount() * groupset.quadrature_->abscissae_.size() *
+                   groupset.groups_.size();
+  }
+
+  if (mpi_comm.rank() == 0)
+    WriteReport(options, all_results, num_cells, num_unknowns);
+
+  return 0;
+}
+
+} // namespace
+
+/**
+ * Standalone sweep microbenchmark. Builds a synthetic orthogonal mesh with a
+ * single scattering material, then times the sweeps of the AAH and/or CBC
+ * schedulers, the source evaluation and a WGDSA application in isolation,
+ * without any iterative solver around them. The results, including
+ * cells/s, unknowns/s and the split of the sweep time into compute and
+ * communication, are written as JSON by the root process.
+ */
+int
+main(int argc, char** argv)
+{
+  mpi::Environment env(argc, argv);
+  opensn::mpi_comm = MPI_COMM_WORLD;
+
+  PetscOptionsInsertString(nullptr, "-error_output_stderr");
+  PetscOptionsInsertString(nullptr, "-no_signal_handler");
+  PetscCall(PetscInitialize(&argc, &argv, nullptr, nullptr));
+
+  int error_code = 0;
+  try
+  {
+    opensn::Initialize();
+    error_code = RunBenchmark(argc, argv);
+    opensn::Finalize();
+  }
+  catch (const std::exception& e)
+  {
+    std::cerr << e.what() << std::endl;
+    error_code = EXIT_FAILURE;
+  }
+
+  PetscFinalize();
+  return error_code;
+}
@@ -80,6 +80,10 @@ during the preparation of simulation meshes.
 partitioner options available in PETSc (defaults to using `"parmetis"`).
 - \ref chi__KBAGraphPartitioner, the classical Neutron Transport KBA parallel
 partitioning with an overlaid orthogonal layout.
+- \ref chi__SweepGraphPartitioner, a KBA-style columnar partitioner that places
+its own cuts at equal-work positions (cells weighted by their number of nodes) and
+chooses the number of blocks per direction by trading load balance against the
+number of sweep stages.
 
 An example of changing the partitioning to PETSc's `"average"` option is shown
 below:
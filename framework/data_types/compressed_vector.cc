@@ -0,0 +1,220 @@
+#include "framework/data_types/compressed_vector.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/memory_usage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace opensn
+{
+
+namespace
+{
+
+/// Blocks needing more bits than this are stored losslessly
+constexpr unsigned int MAX_QUANTIZED_BITS = 52;
+
+/**Writes the lowest `num_bits` bits of `value` at bit position `bit_pos`.*/
+void
+WriteBits(std::vector<uint64_t>& words, uint64_t bit_pos, uint64_t value, unsigned int num_bits)
+{
+  const size_t w = bit_pos / 64;
+  const unsigned int shift = bit_pos % 64;
+  words[w] |= value << shift;
+  if (shift + num_bits > 64)
+    words[w + 1] |= value >> (64 - shift);
+}
+
+/**Reads `num_bits` bits at bit position `bit_pos`.*/
+uint64_t
+ReadBits(const uint64_t* words, uint64_t bit_pos, unsigned int num_bits)
+{
+  const size_t w = bit_pos / 64;
+  const unsigned int shift = bit_pos % 64;
+  uint64_t value = words[w] >> shift;
+  if (shift + num_bits > 64)
+    value |= words[w + 1] << (64 - shift);
+  return num_bits == 64 ? value : value & ((uint64_t(1) << num_bits) - 1);
+}
+
+} // namespace
+
+CompressedVector::CompressedVector(const std::vector<double>& values,
+                                   const size_t block_size,
+                                   const double tolerance,
+                                   const std::string& spill_file_name)
+  : size_(values.size()),
+    block_size_(block_size),
+    tolerance_(tolerance),
+    spill_file_name_(spill_file_name)
+{
+  OpenSnInvalidArgumentIf(block_size_ == 0, "The block size must be positive.");
+  OpenSnInvalidArgumentIf(tolerance_ < 0.0, "The compression tolerance must be non-negative.");
+
+  // Group the blocks into chunks whose bits, at 64 bits per value, are
+  // addressable by the offsets in the headers
+  blocks_per_chunk_ = std::max<size_t>(1, (size_t(1) << CHUNK_OFFSET_BITS) / (64 * block_size_));
+
+  // Quantization parameters and bit offsets of each block
+  const size_t num_blocks = (size_ + block_size_ - 1) / block_size_;
+  headers_.resize(num_blocks);
+  chunk_bit_offsets_.resize((num_blocks + blocks_per_chunk_ - 1) / blocks_per_chunk_);
+  uint64_t num_bits = 0;
+  for (size_t b = 0; b < num_blocks; ++b)
+  {
+    const size_t begin = b * block_size_;
+    const size_t end = std::min(begin + block_size_, size_);
+    const auto [min_it, max_it] = std::minmax_element(&values[begin], &values[begin] + end - begin);
+    const double max_abs = std::max(std::fabs(*min_it), std::fabs(*max_it));
+
+    if (b % blocks_per_chunk_ == 0)
+      chunk_bit_offsets_[b / blocks_per_chunk_] = num_bits;
+
+    auto& header = headers_[b];
+    header.chunk_bit_offset = num_bits - chunk_bit_offsets_[b / blocks_per_chunk_];
+    header.minimum = *min_it;
+    header.num_bits = 64;
+    if (*max_it == *min_it)
+      header.num_bits = 0;
+    else if (tolerance_ > 0.0)
+    {
+      // Rounding to the nearest multiple of the step gives an error of at most
+      // step/2. Rounding the step down to single precision only tightens this.
+      const double max_step = 2.0 * tolerance_ * max_abs;
+      float step = static_cast<float>(max_step);
+      if (static_cast<double>(step) > max_step)
+        step = std::nextafter(step, 0.0f);
+      if (std::isnormal(step))
+      {
+        const double max_level = std::ceil((*max_it - *min_it) / step);
+        if (max_level < std::ldexp(1.0, MAX_QUANTIZED_BITS))
+        {
+          const auto max_quantized = static_cast<uint64_t>(max_level);
+          unsigned int quantized_bits = 0;
+          while ((max_quantized >> quantized_bits) != 0)
+            ++quantized_bits;
+          header.num_bits = quantized_bits;
+          header.step = step;
+        }
+      }
+    }
+    num_bits += static_cast<uint64_t>(header.num_bits) * (end - begin);
+  }
+
+  // Pack the quantized values
+  num_words_ = (num_bits + 63) / 64;
+  words_.assign(num_words_, 0);
+  for (size_t b = 0; b < num_blocks; ++b)
+  {
+    const auto& header = headers_[b];
+    if (header.num_bits == 0)
+      continue;
+
+    const size_t begin = b * block_size_;
+    const size_t end = std::min(begin + block_size_, size_);
+    const unsigned int block_num_bits = header.num_bits;
+    uint64_t bit_pos = BitOffset(b);
+    for (size_t i = begin; i < end; ++i, bit_pos += block_num_bits)
+    {
+      uint64_t bits = 0;
+      if (block_num_bits == 64)
+        std::memcpy(&bits, &values[i], sizeof(double));
+      else
+        bits = static_cast<uint64_t>(std::llround((values[i] - header.minimum) / header.step));
+      WriteBits(words_, bit_pos, bits, block_num_bits);
+    }
+  }
+
+  if (IsSpilled())
+  {
+    std::ofstream file(spill_file_name_, std::ios::binary);
+    OpenSnLogicalErrorIf(not file.is_open(), "Failed to open \"" + spill_file_name_ + "\".");
+    file.write(reinterpret_cast<const char*>(words_.data()),
+               static_cast<std::streamsize>(CompressedDataSize()));
+    OpenSnLogicalErrorIf(not file.good(), "Failed to write \"" + spill_file_name_ + "\".");
+    file.close();
+
+    words_.clear();
+    words_.shrink_to_fit();
+    spill_file_.open(spill_file_name_, std::ios::binary);
+    OpenSnLogicalErrorIf(not spill_file_.is_open(),
+                         "Failed to open \"" + spill_file_name_ + "\".");
+  }
+}
+
+CompressedVector::~CompressedVector()
+{
+  if (IsSpilled())
+  {
+    spill_file_.close();
+    std::remove(spill_file_name_.c_str());
+  }
+}
+
+const uint64_t*
+CompressedVector::ReadWords(const size_t first, const size_t count) const
+{
+  if (not IsSpilled())
+    return words_.data() + first;
+
+  read_buffer_.resize(count);
+  spill_file_.seekg(static_cast<std::streamoff>(first * sizeof(uint64_t)));
+  spill_file_.read(reinterpret_cast<char*>(read_buffer_.data()),
+                   static_cast<std::streamsize>(count * sizeof(uint64_t)));
+  OpenSnLogicalErrorIf(not spill_file_.good(), "Failed to read \"" + spill_file_name_ + "\".");
+  return read_buffer_.data();
+}
+
+void
+CompressedVector::DecompressBlock(const size_t block, double* values) const
+{
+  const auto& header = headers_[block];
+  const size_t begin = block * block_size_;
+  const size_t num_values = std::min(block_size_, size_ - begin);
+
+  const unsigned int num_bits = header.num_bits;
+  if (num_bits == 0)
+  {
+    std::fill(values, values + num_values, header.minimum);
+    return;
+  }
+
+  const uint64_t bit_offset = BitOffset(block);
+  const size_t first_word = bit_offset / 64;
+  const uint64_t end_bit = bit_offset + num_bits * num_values;
+  const uint64_t* words = ReadWords(first_word, (end_bit + 63) / 64 - first_word);
+
+  const double step = header.step;
+  uint64_t bit_pos = bit_offset - 64 * first_word;
+  for (size_t i = 0; i < num_values; ++i, bit_pos += num_bits)
+  {
+    const uint64_t bits = ReadBits(words, bit_pos, num_bits);
+    if (num_bits == 64)
+      std::memcpy(&values[i], &bits, sizeof(double));
+    else
+      values[i] = header.minimum + static_cast<double>(bits) * step;
+  }
+}
+
+void
+CompressedVector::Decompress(std::vector<double>& values) const
+{
+  values.resize(size_);
+  for (size_t b = 0; b < headers_.size(); ++b)
+    DecompressBlock(b, &values[b * block_size_]);
+
+  // Only block-wise readers reuse the read buffer
+  read_buffer_.clear();
+  read_buffer_.shrink_to_fit();
+}
+
+size_t
+CompressedVector::ComputeMemoryUsage() const
+{
+  return VectorMemoryUsage(headers_) + VectorMemoryUsage(chunk_bit_offsets_) +
+         VectorMemoryUsage(words_) + VectorMemoryUsage(read_buffer_);
+}
+
+} // namespace opensn
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+
+/**
+ * A read-only vector of doubles stored with error-bounded, blockwise lossy
+ * compression. The values are split into blocks of consecutive entries and each
+ * block is quantized to the fewest bits per value such that every decompressed
+ * value is within `tolerance` times the largest magnitude in its block of the
+ * original value. Blocks that cannot be quantized with fewer than 53 bits, and
+ * all blocks when the tolerance is zero, are stored losslessly.
+ *
+ * The quantized data either stays in memory or is spilled to a file, in which
+ * case only the per-block headers are kept in memory and blocks are read back
+ * on demand. Each header takes 16 bytes, so blocks should hold enough values to
+ * amortize it. Values are accessed by decompressing whole blocks, so blocks
+ * should also match the access pattern of the consumer, e.g., all angles and
+ * groups at one node for angular fluxes.
+ */
+class CompressedVector
+{
+public:
+  /**Compresses the values. If `spill_file_name` is non-empty the compressed data
+   * is written to that file, which is removed when the vector is destroyed.*/
+  CompressedVector(const std::vector<double>& values,
+                   size_t block_size,
+                   double tolerance,
+                   const std::string& spill_file_name = "");
+  ~CompressedVector();
+
+  CompressedVector(const CompressedVector&) = delete;
+  CompressedVector& operator=(const CompressedVector&) = delete;
+
+  /**Returns the number of values.*/
+  size_t Size() const { return size_; }
+
+  size_t BlockSize() const { return block_size_; }
+
+  size_t NumBlocks() const { return headers_.size(); }
+
+  /**Returns the relative error bound the vector was compressed with.*/
+  double Tolerance() const { return tolerance_; }
+
+  /**Returns true if the compressed data lives in a file.*/
+  bool IsSpilled() const { return not spill_file_name_.empty(); }
+
+  /**Decompresses a block into `values`, which must hold at least `BlockSize()`
+   * entries. The last block may be shorter.*/
+  void DecompressBlock(size_t block, double* values) const;
+
+  /**Decompresses all values, resizing `values` as needed.*/
+  void Decompress(std::vector<double>& values) const;
+
+  /**Returns the number of bytes held in memory.*/
+  size_t ComputeMemoryUsage() const;
+
+  /**Returns the number of bytes of compressed data, in memory or on disk.*/
+  size_t CompressedDataSize() const { return num_words_ * sizeof(uint64_t); }
+
+  /**Random access to the values of a compressed vector, decompressing one block
+   * at a time. Consecutive accesses within a block are cheap.*/
+  class Reader
+  {
+  public:
+    explicit Reader(const CompressedVector& vector)
+      : vector_(vector), block_values_(vector.BlockSize())
+    {
+    }
+
+    double operator[](size_t i)
+    {
+      const size_t block = i / vector_.block_size_;
+      if (block != cached_block_)
+      {
+        vector_.DecompressBlock(block, block_values_.data());
+        cached_block_ = block;
+      }
+      return block_values_[i - block * vector_.block_size_];
+    }
+
+  private:
+    const CompressedVector& vector_;
+    size_t cached_block_ = std::numeric_limits<size_t>::max();
+    std::vector<double> block_values_;
+  };
+
+private:
+  /// Bits available for the offset of a block relative to its chunk
+  static constexpr unsigned int CHUNK_OFFSET_BITS = 25;
+
+  struct BlockHeader
+  {
+    double minimum = 0.0;
+    /// Quantization step, rounded down to single precision
+    float step = 0.0f;
+    /// Bit offset of the block relative to the first block of its chunk
+    uint32_t chunk_bit_offset : CHUNK_OFFSET_BITS;
+    /// Bits per value. Zero for constant blocks, 64 for lossless blocks.
+    uint32_t num_bits : 32 - CHUNK_OFFSET_BITS;
+  };
+  static_assert(sizeof(BlockHeader) == 16, "Block headers must stay compact.");
+
+  /**Returns the bit offset of a block in the compressed data.*/
+  uint64_t BitOffset(size_t block) const
+  {
+    return chunk_bit_offsets_[block / blocks_per_chunk_] + headers_[block].chunk_bit_offset;
+  }
+
+  /**Returns the words `[first, first + count)` of the compressed data.*/
+  const uint64_t* ReadWords(size_t first, size_t count) const;
+
+  const size_t size_;
+  const size_t block_size_;
+  const double tolerance_;
+  const std::string spill_file_name_;
+
+  /// Blocks per chunk, such that the offsets within a chunk fit the headers
+  size_t blocks_per_chunk_ = 1;
+  std::vector<BlockHeader> headers_;
+  std::vector<uint64_t> chunk_bit_offsets_;
+  std::vector<uint64_t> words_;
+  size_t num_words_ = 0;
+
+  mutable std::ifstream spill_file_;
+  mutable std::vector<uint64_t> read_buffer_;
+};
+
+} // namespace opensn
@@ -5,15 +5,11 @@
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/mesh/mesh.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
-#include "framework/mesh/mesh_continuum/grid_vtk_utils.h"
+#include "framework/mesh/mesh_continuum/grid_vtu_writer.h"
 #include "framework/object_factory.h"
 #include "framework/logging/log.h"
 #include "framework/runtime.h"
 #include <petsc.h>
-#include <vtkUnstructuredGrid.h>
-#include <vtkCellData.h>
-#include <vtkPointData.h>
-#include <vtkDoubleArray.h>
 
 namespace opensn
 {
@@ -204,7 +200,8 @@ FieldFunctionGridBased::UpdateFieldVector(const Vec& field_vector)
 void
 FieldFunctionGridBased::ExportMultipleToVTK(
   const std::string& file_base_name,
-  const std::vector<std::shared_ptr<const FieldFunctionGridBased>>& ff_list)
+  const std::vector<std::shared_ptr<const FieldFunctionGridBased>>& ff_list,
+  bool cell_averages_only)
 {
   const std::string fname = "chi_physics::FieldFunction::ExportMultipleToVTK";
   log.Log() << "Exporting field functions to VTK with file base \"" << file_base_name << "\"";
@@ -223,17 +220,16 @@ FieldFunctionGridBased::ExportMultipleToVTK(
         throw std::logic_error(fname +
                                ": Cannot be used with field functions based on different grids.");
 
-  // Get grid
+  // Get grid. The VTU geometry is cached on the grid and reused across exports.
   const auto& grid = master_ff.sdm_->Grid();
+  const auto& geometry = grid.GetVTUGeometry();
 
-  auto ugrid = PrepareVtkUnstructuredGrid(grid);
-
-  // Upload cell/point data
-  auto cell_data = ugrid->GetCellData();
-  auto point_data = ugrid->GetPointData();
+  // Gather point/cell data directly from the field vectors
+  std::vector<VTUDataArray> point_data;
+  std::vector<VTUDataArray> cell_data;
   for (const auto& ff_ptr : ff_list)
   {
-    const auto field_vector = ff_ptr->GetGhostedFieldVector();
+    const auto& field_vector = ff_ptr->ghosted_field_vector_->LocalSTLData();
 
     const auto& uk_man = ff_ptr->GetUnknownManager();
     const auto& unknown = ff_ptr->Unknown();
@@ -246,58 +242,40 @@ FieldFunctionGridBased::ExportMultipleToVTK(
       if (num_comps > 1)
         component_name += unknown.component_text_names_[c];
 
-      vtkNew<vtkDoubleArray> point_array;
-      vtkNew<vtkDoubleArray> cell_array;
-
-      point_array->SetName(component_name.c_str());
-      cell_array->SetName(component_name.c_str());
+      VTUDataArray cell_array{component_name, std::vector<double>(geometry.NumCells())};
+      VTUDataArray point_array{component_name, {}};
+      if (not cell_averages_only)
+        point_array.values.resize(geometry.NumPoints());
 
-      // Populate the array here
       for (const auto& cell : grid.local_cells)
       {
         const size_t num_nodes = sdm->GetCellNumNodes(cell);
+        const size_t num_verts = cell.vertex_ids_.size();
+        const size_t first_point = geometry.cell_node_offsets[cell.local_id_];
 
-        if (num_nodes == cell.vertex_ids_.size())
-        {
-          double node_average = 0.0;
-          for (int n = 0; n < num_nodes; ++n)
-          {
-            const int64_t nmap = sdm->MapDOFLocal(cell, n, uk_man, 0, c);
-
-            const double field_value = field_vector[nmap];
-
-            point_array->InsertNextValue(field_value);
-            node_average += field_value;
-          } // for node
-          node_average /= static_cast<double>(num_nodes);
-          cell_array->InsertNextValue(node_average);
-        }
-        else
+        double node_average = 0.0;
+        for (size_t n = 0; n < num_nodes; ++n)
         {
-          double node_average = 0.0;
-          for (int n = 0; n < num_nodes; ++n)
-          {
-            const int64_t nmap = sdm->MapDOFLocal(cell, n, uk_man, 0, c);
-
-            const double field_value = field_vector[nmap];
-            node_average += field_value;
-          } // for node
-          node_average /= static_cast<double>(num_nodes);
-          cell_array->InsertNextValue(node_average);
-          for (int n = 0; n < cell.vertex_ids_.size(); ++n)
-          {
-            point_array->InsertNextValue(node_average);
-          } // for vertex
-        }
-
+          const double field_value = field_vector[sdm->MapDOFLocal(cell, n, uk_man, 0, c)];
+          if (not cell_averages_only and num_nodes == num_verts)
+            point_array.values[first_point + n] = field_value;
+          node_average += field_value;
+        } // for node
+        node_average /= static_cast<double>(num_nodes);
+        cell_array.values[cell.local_id_] = node_average;
+
+        if (not cell_averages_only and num_nodes != num_verts)
+          for (size_t v = 0; v < num_verts; ++v)
+            point_array.values[first_point + v] = node_average;
       } // for cell
 
-      point_data->AddArray(point_array);
-      cell_data->AddArray(cell_array);
+      if (not cell_averages_only)
+        point_data.push_back(std::move(point_array));
+      cell_data.push_back(std::move(cell_array));
     } // for component
   }   // for ff_ptr
 
-  WritePVTUFiles(ugrid, file_base_name);
+  WriteVTUFiles(file_base_name, geometry, point_data, cell_data);
 
   log.Log() << "Done exporting field functions to VTK.";
   opensn::mpi_comm.barrier();
@@ -336,30 +314,28 @@ FieldFunctionGridBased::GetPointValue(const Vector3& point) const
       point.z >= zmin and point.z <= zmax)
   {
     const auto& grid = sdm_->Grid();
-    for (const auto& cell : grid.local_cells)
+    for (const uint64_t local_id : grid.FindLocalCellsContainingPoint(point))
     {
-      if (grid.CheckPointInsideCell(cell, point))
-      {
-        const auto& cell_mapping = sdm_->GetCellMapping(cell);
-        std::vector<double> shape_values;
-        cell_mapping.ShapeValues(point, shape_values);
+      const auto& cell = grid.local_cells[local_id];
+      const auto& cell_mapping = sdm_->GetCellMapping(cell);
+      std::vector<double> shape_values;
+      cell_mapping.ShapeValues(point, shape_values);
 
-        local_num_point_hits += 1;
+      local_num_point_hits += 1;
 
-        const size_t num_nodes = cell_mapping.NumNodes();
-        for (size_t c = 0; c < num_components; ++c)
+      const size_t num_nodes = cell_mapping.NumNodes();
+      for (size_t c = 0; c < num_components; ++c)
+      {
+        for (size_t j = 0; j < num_nodes; ++j)
         {
-          for (size_t j = 0; j < num_nodes; ++j)
-          {
-            cint64_t dof_map_j = sdm_->MapDOFLocal(cell, j, uk_man, 0, c);
-            const double dof_value_j = field_vector[dof_map_j];
-
-            local_point_value[c] += dof_value_j * shape_values[j];
-          } // for node i
-        }   // for component c
-      }     // if inside cell
-    }       // for cell
-  }         // if in bounding box
+          cint64_t dof_map_j = sdm_->MapDOFLocal(cell, j, uk_man, 0, c);
+          const double dof_value_j = field_vector[dof_map_j];
+
+          local_point_value[c] += dof_value_j * shape_values[j];
+        } // for node i
+      }   // for component c
+    }     // for cell
+  }       // if in bounding box
 
   // Communicate number of point hits
   size_t globl_num_point_hits;
@@ -81,9 +81,14 @@ public:
   typedef std::vector<std::shared_ptr<const FieldFunctionGridBased>> FFList;
 
   /**
-   * Export multiple field functions to VTK.
+   * Export multiple field functions to VTK. The data is written as raw binary
+   * appended arrays of a `.vtu` file per process and a `.pvtu` file. If
+   * `cell_averages_only` is true, only the cell averages are written and the
+   * nodal point data is omitted.
    */
-  static void ExportMultipleToVTK(const std::string& file_base_name, const FFList& ff_list);
+  static void ExportMultipleToVTK(const std::string& file_base_name,
+                                  const FFList& ff_list,
+                                  bool cell_averages_only = false);
 
   /**
    * Makes a copy of the locally stored data with ghost access.
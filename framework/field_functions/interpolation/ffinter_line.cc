@@ -44,20 +44,35 @@ FieldFunctionInterpolationLine::Initialize()
     ff_context.interpolation_points_ass_cell.assign(number_of_points_, 0);
     ff_context.interpolation_points_has_ass_cell.assign(number_of_points_, false);
 
-    // Find a home for each point
-    for (const auto& cell : grid.local_cells)
+    // Find a home for each point. Successive points are close to each other,
+    // so each search first walks from the cell of the previous point. Points
+    // on cell boundaries are assigned to the containing cell with the highest
+    // local-id.
+    bool has_previous_cell = false;
+    uint64_t previous_cell = 0;
+    for (int p = 0; p < number_of_points_; p++)
     {
-      for (int p = 0; p < number_of_points_; p++)
+      const auto& point = interpolation_points_[p];
+      uint64_t local_id = 0;
+      bool found = has_previous_cell and
+                   grid.LocateLocalCellByNeighborWalk(previous_cell, point, local_id);
+      if (not found)
       {
-        const auto& point = interpolation_points_[p];
-        if (grid.CheckPointInsideCell(cell, point))
-        {
-          ff_context.interpolation_points_ass_cell[p] = cell.local_id_;
-          ff_context.interpolation_points_has_ass_cell[p] = true;
-        }
-      } // for point p
-    }   // for cell
-  }     // for ff
+        const auto local_ids = grid.FindLocalCellsContainingPoint(point);
+        found = not local_ids.empty();
+        if (found)
+          local_id = local_ids.back();
+      }
+
+      if (found)
+      {
+        ff_context.interpolation_points_ass_cell[p] = local_id;
+        ff_context.interpolation_points_has_ass_cell[p] = true;
+        has_previous_cell = true;
+        previous_cell = local_id;
+      }
+    } // for point p
+  }   // for ff
 
   log.Log0Verbose1() << "Finished initializing interpolator.";
 }
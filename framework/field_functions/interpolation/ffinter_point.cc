@@ -14,9 +14,13 @@ FieldFunctionInterpolationPoint::Initialize()
   const std::string fname = "FieldFunctionInterpolationPoint::Initialize";
   const auto& grid = field_functions_.front()->GetSpatialDiscretization().Grid();
 
+  std::vector<uint64_t> candidate_cells;
+  grid.GetCellSpatialIndex().FindCandidateCells(point_of_interest_, candidate_cells);
+
   std::vector<uint64_t> cells_potentially_owning_point;
-  for (const auto& cell : grid.local_cells)
+  for (const uint64_t local_id : candidate_cells)
   {
+    const auto& cell = grid.local_cells[local_id];
     const auto& vcc = cell.centroid_;
     const auto& poi = point_of_interest_;
     const auto nudged_point = poi + 1.0e-6 * (vcc - poi);
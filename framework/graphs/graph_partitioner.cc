@@ -15,4 +15,13 @@ GraphPartitioner::GraphPartitioner(const InputParameters& params) : Object(param
 {
 }
 
+std::vector<int64_t>
+GraphPartitioner::PartitionWeighted(const std::vector<std::vector<uint64_t>>& graph,
+                                    const std::vector<Vector3>& centroids,
+                                    const std::vector<double>&,
+                                    int number_of_parts)
+{
+  return Partition(graph, centroids, number_of_parts);
+}
+
 } // namespace opensn
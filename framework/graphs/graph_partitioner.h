@@ -15,6 +15,13 @@ public:
                                          const std::vector<Vector3>& centroids,
                                          int number_of_parts) = 0;
 
+  /**Given a graph and a work estimate for each row. Returns the partition ids
+   * of each row in the graph. The default implementation ignores the weights.*/
+  virtual std::vector<int64_t> PartitionWeighted(const std::vector<std::vector<uint64_t>>& graph,
+                                                 const std::vector<Vector3>& centroids,
+                                                 const std::vector<double>& weights,
+                                                 int number_of_parts);
+
 protected:
   static InputParameters GetInputParameters();
   explicit GraphPartitioner(const InputParameters& params);
@@ -0,0 +1,313 @@
+#include "framework/graphs/sweep_graph_partitioner.h"
+
+#include "framework/object_factory.h"
+
+#include "framework/mesh/mesh.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+namespace opensn
+{
+
+OpenSnRegisterObject(SweepGraphPartitioner);
+
+namespace
+{
+
+/**Assigns the cells, sorted by coordinate, to `n` consecutive groups of
+ * approximately equal weight. Cells with the same coordinate are never split
+ * across groups. Returns the group index of each cell in sorted order.*/
+std::vector<size_t>
+SplitSortedByWeight(const std::vector<uint64_t>& sorted_cells,
+                    const std::vector<Vector3>& centroids,
+                    const std::vector<double>& weights,
+                    const size_t d,
+                    const size_t n)
+{
+  double total_weight = 0.0;
+  for (const uint64_t c : sorted_cells)
+    total_weight += weights[c];
+
+  const size_t num_cells = sorted_cells.size();
+  std::vector<size_t> groups(num_cells, 0);
+  size_t g = 0;
+  double cumulative_weight = 0.0;
+  for (size_t k = 0; k < num_cells; ++k)
+  {
+    const uint64_t c = sorted_cells[k];
+    groups[k] = g;
+    cumulative_weight += weights[c];
+
+    const bool at_target = cumulative_weight >= total_weight * double(g + 1) / double(n);
+    const bool at_coordinate_change =
+      (k + 1 == num_cells) or (centroids[sorted_cells[k + 1]][d] > centroids[c][d]);
+    if (g + 1 < n and at_target and at_coordinate_change)
+      ++g;
+  }
+
+  return groups;
+}
+
+/**Returns the cells sorted by their centroid coordinate in direction `d`.*/
+std::vector<uint64_t>
+SortByCoordinate(std::vector<uint64_t> cells, const std::vector<Vector3>& centroids, const size_t d)
+{
+  std::stable_sort(cells.begin(),
+                   cells.end(),
+                   [&centroids, d](uint64_t a, uint64_t b)
+                   { return centroids[a][d] < centroids[b][d]; });
+  return cells;
+}
+
+} // namespace
+
+InputParameters
+SweepGraphPartitioner::GetInputParameters()
+{
+  InputParameters params = GraphPartitioner::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Sweep-aware, KBA-style columnar partitioner with automatically chosen cuts. Cells are "
+    "weighted by their estimated work (the number of nodes per cell), cuts are placed such "
+    "that each block carries the same weight and the number of blocks per direction is chosen "
+    "to balance load against the number of sweep stages.");
+  params.SetDocGroup("Graphs");
+
+  params.AddOptionalParameter(
+    "nx", 0, "The number of partitions in x. A value of 0 lets the partitioner choose.");
+  params.AddOptionalParameter(
+    "ny", 0, "The number of partitions in y. A value of 0 lets the partitioner choose.");
+  params.AddOptionalParameter(
+    "nz", 0, "The number of partitions in z. A value of 0 lets the partitioner choose.");
+
+  params.AddOptionalParameter("max_sweep_stages",
+                              0,
+                              "Upper bound on the number of sweep stages, nx+ny+nz-2, of a "
+                              "single octant. A value of 0 means no bound.");
+
+  params.AddOptionalParameter("pipeline_length",
+                              8.0,
+                              "Estimated number of angle sets pipelined per octant. Used to "
+                              "weigh sweep stages against load imbalance when the number of "
+                              "blocks per direction is chosen automatically.");
+
+  params.AddOptionalParameter("nested_cuts",
+                              false,
+                              "If true, y-cuts are placed independently within each x-slab "
+                              "and z-cuts within each xy-column. This improves load balance on "
+                              "heterogeneous meshes at the cost of a less regular sweep graph.");
+
+  params.ConstrainParameterRange("nx", AllowableRangeLowLimit::New(0));
+  params.ConstrainParameterRange("ny", AllowableRangeLowLimit::New(0));
+  params.ConstrainParameterRange("nz", AllowableRangeLowLimit::New(0));
+  params.ConstrainParameterRange("max_sweep_stages", AllowableRangeLowLimit::New(0));
+  params.ConstrainParameterRange("pipeline_length", AllowableRangeLowLimit::New(1.0));
+
+  return params;
+}
+
+SweepGraphPartitioner::SweepGraphPartitioner(const InputParameters& params)
+  : GraphPartitioner(params),
+    nxyz_({params.GetParamValue<size_t>("nx"),
+           params.GetParamValue<size_t>("ny"),
+           params.GetParamValue<size_t>("nz")}),
+    max_sweep_stages_(params.GetParamValue<int>("max_sweep_stages")),
+    pipeline_length_(params.GetParamValue<double>("pipeline_length")),
+    nested_cuts_(params.GetParamValue<bool>("nested_cuts"))
+{
+}
+
+std::vector<int64_t>
+SweepGraphPartitioner::Partition(const std::vector<std::vector<uint64_t>>& graph,
+                                 const std::vector<Vector3>& centroids,
+                                 int number_of_parts)
+{
+  return PartitionWeighted(
+    graph, centroids, std::vector<double>(graph.size(), 1.0), number_of_parts);
+}
+
+std::vector<int64_t>
+SweepGraphPartitioner::PartitionWeighted(const std::vector<std::vector<uint64_t>>& graph,
+                                         const std::vector<Vector3>& centroids,
+                                         const std::vector<double>& weights,
+                                         int number_of_parts)
+{
+  log.Log0Verbose1() << "Partitioning with SweepGraphPartitioner";
+
+  OpenSnLogicalErrorIf(centroids.size() != graph.size(),
+                       "Graph number of entries not equal to centroids' number of entries.");
+  OpenSnLogicalErrorIf(weights.size() != graph.size(),
+                       "Graph number of entries not equal to weights' number of entries.");
+
+  const auto candidates = MakeCandidateBlockCounts(centroids, number_of_parts);
+  OpenSnInvalidArgumentIf(candidates.empty(),
+                          "No block decomposition of " + std::to_string(number_of_parts) +
+                            " partitions satisfies the supplied nx, ny, nz and "
+                            "max_sweep_stages.");
+
+  const double total_weight = std::accumulate(weights.begin(), weights.end(), 0.0);
+  const double avg_weight = total_weight / number_of_parts;
+
+  std::vector<int64_t> best_pids;
+  std::array<size_t, 3> best_nxyz = {1, 1, 1};
+  double best_cost = std::numeric_limits<double>::max();
+  double best_max_load = 0.0;
+  for (const auto& nxyz : candidates)
+  {
+    auto [pids, max_load] = PartitionBlocks(centroids, weights, nxyz);
+
+    const auto num_stages = static_cast<double>(nxyz[0] + nxyz[1] + nxyz[2] - 2);
+    const double cost = max_load * (1.0 + num_stages / pipeline_length_);
+
+    log.Log0Verbose2() << "SweepGraphPartitioner candidate " << nxyz[0] << "x" << nxyz[1] << "x"
+                       << nxyz[2] << " imbalance=" << max_load / avg_weight
+                       << " stages=" << num_stages << " cost=" << cost;
+
+    if (best_pids.empty() or cost < best_cost)
+    {
+      best_cost = cost;
+      best_nxyz = nxyz;
+      best_max_load = max_load;
+      best_pids = std::move(pids);
+    }
+  }
+
+  if (best_max_load == std::numeric_limits<double>::max())
+    log.Log0Warning() << "SweepGraphPartitioner could not find a decomposition without empty "
+                         "partitions.";
+
+  log.Log() << "SweepGraphPartitioner selected " << best_nxyz[0] << "x" << best_nxyz[1] << "x"
+            << best_nxyz[2] << " blocks, " << best_nxyz[0] + best_nxyz[1] + best_nxyz[2] - 2
+            << " sweep stages, weighted load imbalance (max/avg) "
+            << best_max_load / avg_weight;
+
+  log.Log0Verbose1() << "Done partitioning with SweepGraphPartitioner";
+
+  return best_pids;
+}
+
+std::vector<std::array<size_t, 3>>
+SweepGraphPartitioner::MakeCandidateBlockCounts(const std::vector<Vector3>& centroids,
+                                                int number_of_parts) const
+{
+  // Directions without extent cannot be cut
+  std::array<bool, 3> has_extent = {false, false, false};
+  if (not centroids.empty())
+    for (size_t d = 0; d < 3; ++d)
+    {
+      double min_val = centroids.front()[d];
+      double max_val = min_val;
+      for (const auto& centroid : centroids)
+      {
+        min_val = std::min(min_val, centroid[d]);
+        max_val = std::max(max_val, centroid[d]);
+      }
+      has_extent[d] = max_val > min_val;
+    }
+
+  const auto P = static_cast<size_t>(number_of_parts);
+  std::vector<std::array<size_t, 3>> candidates;
+  for (size_t nx = 1; nx <= P; ++nx)
+  {
+    if (P % nx != 0)
+      continue;
+    for (size_t ny = 1; ny <= P / nx; ++ny)
+    {
+      if ((P / nx) % ny != 0)
+        continue;
+      const std::array<size_t, 3> nxyz = {nx, ny, P / (nx * ny)};
+
+      bool valid = true;
+      for (size_t d = 0; d < 3; ++d)
+      {
+        if (nxyz_[d] > 0 and nxyz[d] != nxyz_[d])
+          valid = false;
+        if (nxyz_[d] == 0 and nxyz[d] > 1 and not has_extent[d])
+          valid = false;
+      }
+      const size_t num_stages = nxyz[0] + nxyz[1] + nxyz[2] - 2;
+      if (max_sweep_stages_ > 0 and num_stages > static_cast<size_t>(max_sweep_stages_))
+        valid = false;
+
+      if (valid)
+        candidates.push_back(nxyz);
+    }
+  }
+
+  return candidates;
+}
+
+std::pair<std::vector<int64_t>, double>
+SweepGraphPartitioner::PartitionBlocks(const std::vector<Vector3>& centroids,
+                                       const std::vector<double>& weights,
+                                       const std::array<size_t, 3>& nxyz) const
+{
+  const size_t num_cells = centroids.size();
+  std::vector<uint64_t> all_cells(num_cells);
+  std::iota(all_cells.begin(), all_cells.end(), 0);
+
+  // Block index of every cell in each direction
+  std::array<std::vector<size_t>, 3> ijk;
+  for (auto& block_indices : ijk)
+    block_indices.assign(num_cells, 0);
+
+  if (not nested_cuts_)
+  {
+    // Cuts are global, i.e., aligned across the whole domain
+    for (size_t d = 0; d < 3; ++d)
+    {
+      if (nxyz[d] == 1)
+        continue;
+      const auto sorted_cells = SortByCoordinate(all_cells, centroids, d);
+      const auto groups = SplitSortedByWeight(sorted_cells, centroids, weights, d, nxyz[d]);
+      for (size_t k = 0; k < num_cells; ++k)
+        ijk[d][sorted_cells[k]] = groups[k];
+    }
+  }
+  else
+  {
+    // Cuts in y are made per x-slab and cuts in z per xy-column
+    std::vector<std::vector<uint64_t>> blocks = {all_cells};
+    for (size_t d = 0; d < 3; ++d)
+    {
+      std::vector<std::vector<uint64_t>> sub_blocks;
+      sub_blocks.reserve(blocks.size() * nxyz[d]);
+      for (const auto& block : blocks)
+      {
+        std::vector<std::vector<uint64_t>> block_groups(nxyz[d]);
+        const auto sorted_cells = SortByCoordinate(block, centroids, d);
+        const auto groups = SplitSortedByWeight(sorted_cells, centroids, weights, d, nxyz[d]);
+        for (size_t k = 0; k < sorted_cells.size(); ++k)
+        {
+          ijk[d][sorted_cells[k]] = groups[k];
+          block_groups[groups[k]].push_back(sorted_cells[k]);
+        }
+        for (auto& group : block_groups)
+          sub_blocks.push_back(std::move(group));
+      }
+      blocks = std::move(sub_blocks);
+    }
+  }
+
+  const size_t num_parts = nxyz[0] * nxyz[1] * nxyz[2];
+  std::vector<double> loads(num_parts, 0.0);
+  std::vector<int64_t> pids(num_cells, 0);
+  for (size_t c = 0; c < num_cells; ++c)
+  {
+    const size_t pid = ijk[0][c] + nxyz[0] * (ijk[1][c] + nxyz[1] * ijk[2][c]);
+    pids[c] = static_cast<int64_t>(pid);
+    loads[pid] += weights[c];
+  }
+
+  if (std::find(loads.begin(), loads.end(), 0.0) != loads.end())
+    return {pids, std::numeric_limits<double>::max()};
+
+  return {pids, *std::max_element(loads.begin(), loads.end())};
+}
+
+} // namespace opensn
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "framework/graphs/graph_partitioner.h"
+
+#include <array>
+
+namespace opensn
+{
+
+/**
+ * KBA-style columnar partitioner for unstructured meshes that chooses its own
+ * cuts. The number of blocks in each direction is either supplied or selected
+ * automatically by minimizing a simple pipelined-sweep cost model,
+ *
+ * \f[
+ *   T \propto W_{max} \left(1 + \frac{N_{stages}}{N_{pipeline}} \right),
+ * \f]
+ *
+ * where \f$ W_{max} \f$ is the maximum weighted partition load,
+ * \f$ N_{stages} = n_x + n_y + n_z - 2 \f$ is the number of sweep stages of a
+ * single octant and \f$ N_{pipeline} \f$ is the number of work units (angle
+ * sets) pipelined per octant. The cuts themselves are placed at weighted
+ * quantiles of the cell centroids so that each block carries the same work.
+ */
+class SweepGraphPartitioner : public GraphPartitioner
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit SweepGraphPartitioner(const InputParameters& params);
+
+  std::vector<int64_t> Partition(const std::vector<std::vector<uint64_t>>& graph,
+                                 const std::vector<Vector3>& centroids,
+                                 int number_of_parts) override;
+
+  std::vector<int64_t> PartitionWeighted(const std::vector<std::vector<uint64_t>>& graph,
+                                         const std::vector<Vector3>& centroids,
+                                         const std::vector<double>& weights,
+                                         int number_of_parts) override;
+
+protected:
+  /**Partitions with a fixed number of blocks per direction and returns
+   * the partition ids along with the maximum weighted partition load.*/
+  std::pair<std::vector<int64_t>, double> PartitionBlocks(const std::vector<Vector3>& centroids,
+                                                          const std::vector<double>& weights,
+                                                          const std::array<size_t, 3>& nxyz) const;
+
+  /**Returns all (nx,ny,nz) with nx*ny*nz = number_of_parts that respect
+   * the user-supplied block counts, the mesh dimensionality and the stage bound.*/
+  std::vector<std::array<size_t, 3>>
+  MakeCandidateBlockCounts(const std::vector<Vector3>& centroids, int number_of_parts) const;
+
+  const std::array<size_t, 3> nxyz_;
+  const int max_sweep_stages_;
+  const double pipeline_length_;
+  const bool nested_cuts_;
+};
+
+} // namespace opensn
@@ -1,6 +1,7 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
+#include "framework/memory_usage.h"
 
 #include "framework/logging/stringstream_color.h"
 
@@ -26,6 +27,9 @@ Logger::Logger() noexcept
 
   ref_rep_event.Events().emplace_back(
     program_timer.GetTime(), EventType::EVENT_CREATED, std::make_shared<EventInfo>());
+
+  RegisterMemoryConsumer(
+    this, "logging history", [this] { return ComputeEventHistoryMemoryUsage(); });
 }
 
 LogStream
@@ -349,4 +353,18 @@ Logger::ProcessEvent(size_t ev_tag, Logger::EventOperation ev_operation)
   return ret_val;
 }
 
+size_t
+Logger::ComputeEventHistoryMemoryUsage() const
+{
+  size_t bytes = VectorMemoryUsage(repeating_events);
+  for (const auto& repeating_event : repeating_events)
+  {
+    bytes += VectorMemoryUsage(repeating_event.Events());
+    for (const auto& event : repeating_event.Events())
+      if (event.ev_info)
+        bytes += sizeof(EventInfo) + event.ev_info->arb_info.capacity();
+  }
+  return bytes;
+}
+
 } // namespace opensn
@@ -286,6 +286,9 @@ public:
   /**Processes an event given an event operation. See Logger for further
    * reference.*/
   double ProcessEvent(size_t ev_tag, EventOperation ev_operation);
+  /**Returns the number of bytes allocated for the history of all repeating
+   * events.*/
+  size_t ComputeEventHistoryMemoryUsage() const;
 };
 
 /** */
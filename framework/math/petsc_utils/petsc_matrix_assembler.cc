@@ -0,0 +1,176 @@
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
+#include "framework/math/petsc_utils/petsc_utils.h"
+#include "framework/math/spatial_discretization/spatial_discretization.h"
+
+#include "framework/runtime.h"
+
+namespace opensn
+{
+
+Mat
+CreatePreallocatedSquareMatrix(const SpatialDiscretization& sdm, const UnknownManager& uk_man)
+{
+  const auto n = static_cast<int64_t>(sdm.GetNumLocalDOFs(uk_man));
+  const auto N = static_cast<int64_t>(sdm.GetNumGlobalDOFs(uk_man));
+
+  std::vector<int64_t> nodal_nnz_in_diag;
+  std::vector<int64_t> nodal_nnz_off_diag;
+  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man);
+
+  Mat A = CreateSquareMatrix(n, N);
+  InitMatrixSparsity(A, nodal_nnz_in_diag, nodal_nnz_off_diag);
+
+  return A;
+}
+
+MatrixAssembler::MatrixAssembler(Mat A, Mode mode) : A_(A), mode_(mode)
+{
+}
+
+void
+MatrixAssembler::Begin()
+{
+  run_row_ = -1;
+  run_cols_.clear();
+  run_values_.clear();
+
+  coo_cursor_ = 0;
+  coo_pattern_changed_ = coo_rows_.empty();
+
+  if (assembled_ and mode_ == Mode::SET_VALUES)
+    MatZeroEntries(A_);
+}
+
+void
+MatrixAssembler::Add(int64_t row, int64_t col, double value)
+{
+  if (mode_ == Mode::COO)
+  {
+    AddCOO(row, col, value);
+    return;
+  }
+
+  if (row != run_row_)
+  {
+    FlushRow();
+    run_row_ = row;
+  }
+  run_cols_.push_back(col);
+  run_values_.push_back(value);
+}
+
+void
+MatrixAssembler::AddElementMatrix(const std::vector<int64_t>& rows,
+                                  const std::vector<int64_t>& cols,
+                                  const std::vector<double>& values)
+{
+  const size_t num_rows = rows.size();
+  const size_t num_cols = cols.size();
+
+  if (mode_ == Mode::COO)
+  {
+    for (size_t i = 0; i < num_rows; ++i)
+      for (size_t j = 0; j < num_cols; ++j)
+        AddCOO(rows[i], cols[j], values[i * num_cols + j]);
+    return;
+  }
+
+  FlushRow();
+  element_rows_.assign(rows.begin(), rows.end());
+  element_cols_.assign(cols.begin(), cols.end());
+  MatSetValues(A_,
+               static_cast<PetscInt>(num_rows),
+               element_rows_.data(),
+               static_cast<PetscInt>(num_cols),
+               element_cols_.data(),
+               values.data(),
+               ADD_VALUES);
+}
+
+void
+MatrixAssembler::AddElementMatrix(const std::vector<int64_t>& rows,
+                                  const std::vector<int64_t>& cols,
+                                  const MatDbl& values)
+{
+  const size_t num_cols = cols.size();
+  std::vector<double> flat_values(rows.size() * num_cols);
+  for (size_t i = 0; i < rows.size(); ++i)
+    std::copy(values[i].begin(), values[i].begin() + num_cols, &flat_values[i * num_cols]);
+
+  AddElementMatrix(rows, cols, flat_values);
+}
+
+void
+MatrixAssembler::Assemble()
+{
+  if (mode_ == Mode::SET_VALUES)
+    FlushRow();
+  else
+  {
+    if (coo_cursor_ != coo_rows_.size())
+    {
+      coo_rows_.resize(coo_cursor_);
+      coo_cols_.resize(coo_cursor_);
+      coo_values_.resize(coo_cursor_);
+      coo_pattern_changed_ = true;
+    }
+
+    if (coo_pattern_changed_)
+    {
+      // PETSc may reorder the index arrays it is given
+      std::vector<PetscInt> rows = coo_rows_;
+      std::vector<PetscInt> cols = coo_cols_;
+      MatSetPreallocationCOO(A_, static_cast<PetscCount>(rows.size()), rows.data(), cols.data());
+      coo_pattern_changed_ = false;
+    }
+
+    // Duplicate entries are summed
+    MatSetValuesCOO(A_, coo_values_.data(), INSERT_VALUES);
+  }
+
+  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
+  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+
+  assembled_ = true;
+}
+
+void
+MatrixAssembler::FlushRow()
+{
+  if (run_cols_.empty())
+    return;
+
+  MatSetValues(A_,
+               1,
+               &run_row_,
+               static_cast<PetscInt>(run_cols_.size()),
+               run_cols_.data(),
+               run_values_.data(),
+               ADD_VALUES);
+
+  run_cols_.clear();
+  run_values_.clear();
+}
+
+void
+MatrixAssembler::AddCOO(int64_t row, int64_t col, double value)
+{
+  const size_t k = coo_cursor_++;
+  if (not coo_pattern_changed_ and k < coo_rows_.size() and coo_rows_[k] == row and
+      coo_cols_[k] == col)
+  {
+    coo_values_[k] = value;
+    return;
+  }
+
+  // The pattern differs from the recorded one from here on
+  coo_pattern_changed_ = true;
+  coo_rows_.resize(k);
+  coo_cols_.resize(k);
+  coo_values_.resize(k);
+  coo_rows_.push_back(row);
+  coo_cols_.push_back(col);
+  coo_values_.push_back(value);
+}
+
+} // namespace opensn
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "framework/math/math.h"
+#include <petscksp.h>
+#include <vector>
+
+namespace opensn
+{
+class SpatialDiscretization;
+
+/**
+ * Creates a square parallel AIJ matrix for the unknowns of the given
+ * spatial discretization, preallocated with the exact per-row nonzero
+ * counts of the discretization's sparsity pattern.
+ */
+Mat CreatePreallocatedSquareMatrix(const SpatialDiscretization& sdm,
+                                   const UnknownManager& uk_man);
+
+/**
+ * Batched assembly of a PETSc matrix. Instead of inserting entries one at a
+ * time with `MatSetValue`, entries are either
+ *
+ * - inserted with one `MatSetValues` call per element matrix or per run of
+ *   scalar entries in the same row (`Mode::SET_VALUES`), or
+ * - collected in coordinate (COO) form and inserted with a single
+ *   `MatSetValuesCOO` call (`Mode::COO`).
+ *
+ * In COO mode the symbolic structure is computed on the first assembly only.
+ * As long as subsequent assemblies add the entries in the same order, which
+ * is the case when the same cell/face loops are re-run with different
+ * coefficients, only the values are copied. A change of the pattern is
+ * detected and triggers a new symbolic setup.
+ *
+ * All entries are added, i.e., `ADD_VALUES` semantics. Entries with negative
+ * row or column indices are ignored.
+ */
+class MatrixAssembler
+{
+public:
+  enum class Mode
+  {
+    SET_VALUES = 0,
+    COO = 1
+  };
+
+  explicit MatrixAssembler(Mat A, Mode mode = Mode::SET_VALUES);
+
+  /**Starts a new assembly. If the matrix has already been assembled by this
+   * assembler, all its entries are zeroed.*/
+  void Begin();
+
+  /**Adds a single entry. Consecutive entries of the same row are batched.*/
+  void Add(int64_t row, int64_t col, double value);
+
+  /**Adds a dense element matrix with row-major `values`.*/
+  void AddElementMatrix(const std::vector<int64_t>& rows,
+                        const std::vector<int64_t>& cols,
+                        const std::vector<double>& values);
+
+  /**Adds a dense element matrix.*/
+  void AddElementMatrix(const std::vector<int64_t>& rows,
+                        const std::vector<int64_t>& cols,
+                        const MatDbl& values);
+
+  /**Inserts all pending entries and finalizes the assembly of the matrix.*/
+  void Assemble();
+
+  /**Returns the matrix being assembled.*/
+  Mat GetMatrix() const { return A_; }
+
+private:
+  /**Inserts the pending run of scalar entries (SET_VALUES mode).*/
+  void FlushRow();
+  /**Records or replays a COO entry.*/
+  void AddCOO(int64_t row, int64_t col, double value);
+
+  Mat A_;
+  const Mode mode_;
+  bool assembled_ = false;
+
+  // SET_VALUES mode: current run of entries of a single row
+  PetscInt run_row_ = -1;
+  std::vector<PetscInt> run_cols_;
+  std::vector<PetscScalar> run_values_;
+  std::vector<PetscInt> element_rows_;
+  std::vector<PetscInt> element_cols_;
+
+  // COO mode: pattern of the last symbolic setup and current values
+  std::vector<PetscInt> coo_rows_;
+  std::vector<PetscInt> coo_cols_;
+  std::vector<PetscScalar> coo_values_;
+  size_t coo_cursor_ = 0;
+  bool coo_pattern_changed_ = true;
+};
+
+} // namespace opensn
@@ -82,6 +82,7 @@ ProductQuadrature::AssembleCosines(const std::vector<double>& azimuthal,
 
   // Create omega list
   omegas_.clear();
+  ClearDirectionMaps();
   for (const auto& qpoint : abscissae_)
   {
     Vector3 new_omega;
@@ -5,12 +5,33 @@
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 
+#include <cmath>
 #include <iomanip>
 #include <numeric>
 
 namespace opensn
 {
 
+namespace
+{
+
+/**Hashes the cell of a grid with spacing `AngularQuadrature::DIRECTION_TOLERANCE`
+ * with the given integer coordinates.*/
+size_t
+HashDirectionCell(const int64_t i, const int64_t j, const int64_t k)
+{
+  return static_cast<size_t>(i * 73856093) ^ static_cast<size_t>(j * 19349663) ^
+         static_cast<size_t>(k * 83492791);
+}
+
+int64_t
+DirectionCellIndex(const double component)
+{
+  return std::llround(component / AngularQuadrature::DIRECTION_TOLERANCE);
+}
+
+} // namespace
+
 void
 AngularQuadrature::OptimizeForPolarSymmetry(const double normalization)
 {
@@ -36,6 +57,7 @@ AngularQuadrature::OptimizeForPolarSymmetry(const double normalization)
   abscissae_ = std::move(new_abscissae);
   weights_ = std::move(new_weights);
   omegas_ = std::move(new_omegas);
+  ClearDirectionMaps();
 }
 
 void
@@ -184,6 +206,98 @@ AngularQuadrature::GetMomentToHarmonicsIndexMap() const
   return m_to_ell_em_map_;
 }
 
+int
+AngularQuadrature::FindDirection(const Vector3& omega) const
+{
+  // Directions are binned on a grid with a spacing equal to the tolerance, so a
+  // matching direction lies in the cell of `omega` or one of its neighbors
+  if (direction_lookup_.size() != omegas_.size())
+  {
+    direction_lookup_.clear();
+    for (int n = 0; n < static_cast<int>(omegas_.size()); ++n)
+    {
+      const auto& omega_n = omegas_[n];
+      direction_lookup_.emplace(HashDirectionCell(DirectionCellIndex(omega_n.x),
+                                                  DirectionCellIndex(omega_n.y),
+                                                  DirectionCellIndex(omega_n.z)),
+                                n);
+    }
+  }
+
+  const auto i = DirectionCellIndex(omega.x);
+  const auto j = DirectionCellIndex(omega.y);
+  const auto k = DirectionCellIndex(omega.z);
+
+  int closest = -1;
+  double closest_distance = DIRECTION_TOLERANCE * DIRECTION_TOLERANCE;
+  for (int64_t di = -1; di <= 1; ++di)
+    for (int64_t dj = -1; dj <= 1; ++dj)
+      for (int64_t dk = -1; dk <= 1; ++dk)
+      {
+        const auto [begin, end] =
+          direction_lookup_.equal_range(HashDirectionCell(i + di, j + dj, k + dk));
+        for (auto it = begin; it != end; ++it)
+        {
+          const double distance = (omegas_[it->second] - omega).NormSquare();
+          if (distance < closest_distance)
+          {
+            closest = it->second;
+            closest_distance = distance;
+          }
+        }
+      }
+  return closest;
+}
+
+std::vector<int>
+AngularQuadrature::MapDirections(const std::function<Vector3(const Vector3&)>& transform) const
+{
+  std::vector<int> direction_map(omegas_.size(), -1);
+  for (size_t n = 0; n < omegas_.size(); ++n)
+    direction_map[n] = FindDirection(transform(omegas_[n]));
+  return direction_map;
+}
+
+const std::vector<int>&
+AngularQuadrature::GetReflectedDirectionMap(const Vector3& normal) const
+{
+  for (const auto& [map_normal, direction_map] : reflected_direction_maps_)
+    if ((map_normal - normal).NormSquare() < DIRECTION_TOLERANCE * DIRECTION_TOLERANCE)
+      return direction_map;
+
+  reflected_direction_maps_.emplace_back(
+    normal,
+    MapDirections([&normal](const Vector3& omega)
+                  { return omega - 2.0 * normal * omega.Dot(normal); }));
+  return reflected_direction_maps_.back().second;
+}
+
+const std::vector<int>&
+AngularQuadrature::GetOpposingDirectionMap(const int dimension) const
+{
+  auto& direction_map = opposing_direction_maps_[dimension];
+  if (direction_map.size() != omegas_.size())
+  {
+    if (dimension == 1)
+      direction_map =
+        MapDirections([](const Vector3& omega) { return Vector3(omega.x, omega.y, -omega.z); });
+    else if (dimension == 2)
+      direction_map =
+        MapDirections([](const Vector3& omega) { return Vector3(-omega.x, -omega.y, omega.z); });
+    else
+      direction_map = MapDirections([](const Vector3& omega) { return -1.0 * omega; });
+  }
+  return direction_map;
+}
+
+void
+AngularQuadrature::ClearDirectionMaps()
+{
+  direction_lookup_.clear();
+  reflected_direction_maps_.clear();
+  opposing_direction_maps_.clear();
+}
+
 AngularQuadratureCustom::AngularQuadratureCustom(std::vector<double>& azimuthal,
                                                  std::vector<double>& polar,
                                                  std::vector<double>& weights,
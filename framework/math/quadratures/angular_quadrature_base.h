@@ -1,5 +1,10 @@
 #pragma once
 
+#include <deque>
+#include <functional>
+#include <map>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "framework/mesh/mesh.h"
@@ -97,6 +102,42 @@ public:
   /**Returns a reference to the precomputed harmonic index map. This will
    * throw a std::logic_error if the map has not been built yet.*/
   const std::vector<HarmonicIndices>& GetMomentToHarmonicsIndexMap() const;
+
+  /**Returns the index of the direction closest to `omega` if it is within
+   * `DIRECTION_TOLERANCE`, otherwise -1. Lookups use a hash of the rounded
+   * direction components, which is built on first use.*/
+  int FindDirection(const Vector3& omega) const;
+
+  /**Returns a map from each direction to its reflection about the plane with
+   * the given unit normal, with -1 for directions whose reflection is not in the
+   * quadrature. The map is computed once per normal and the reference stays
+   * valid until the directions change.*/
+  const std::vector<int>& GetReflectedDirectionMap(const Vector3& normal) const;
+
+  /**Returns a map from each direction to the opposing direction in a problem
+   * of the given dimension, with -1 for directions whose opposite is not in the
+   * quadrature. Only the components along the spatial axes of the problem are
+   * reversed, i.e., z in 1D and x and y in 2D, since the solution is symmetric
+   * in the others. The map is computed once per dimension.*/
+  const std::vector<int>& GetOpposingDirectionMap(int dimension) const;
+
+  /// Maximum distance between directions that are considered equal
+  static constexpr double DIRECTION_TOLERANCE = 1.0e-4;
+
+protected:
+  /**Clears the direction lookup and the cached direction maps. This must be
+   * called whenever the directions change after they have been used.*/
+  void ClearDirectionMaps();
+
+private:
+  /**Maps each direction to the index of its transformed direction, or -1.*/
+  std::vector<int> MapDirections(const std::function<Vector3(const Vector3&)>& transform) const;
+
+  /// Direction indices keyed by a hash of the rounded direction components
+  mutable std::unordered_multimap<size_t, int> direction_lookup_;
+  /// Maps per normal. A deque keeps references valid when maps are added.
+  mutable std::deque<std::pair<Vector3, std::vector<int>>> reflected_direction_maps_;
+  mutable std::map<int, std::vector<int>> opposing_direction_maps_;
 };
 
 class AngularQuadratureCustom : public AngularQuadrature
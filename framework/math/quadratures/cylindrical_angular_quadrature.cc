@@ -143,6 +143,7 @@ CylindricalAngularQuadrature::Initialize(const Quadrature& quad_polar,
   weights_.clear();
   abscissae_.clear();
   omegas_.clear();
+  ClearDirectionMaps();
   for (size_t p = 0; p < azimu_quad_vec.size(); ++p)
   {
     const auto pol_wei = polar_quad.weights_[p];
@@ -639,6 +639,7 @@ SimplifiedLDFESQ::Quadrature::PopulateQuadratureAbscissae()
   abscissae_.clear();
   weights_.clear();
   omegas_.clear();
+  ClearDirectionMaps();
 
   for (const auto& sq : deployed_SQs_)
   {
@@ -89,6 +89,7 @@ SphericalAngularQuadrature::Initialize(const Quadrature& quad_polar, const bool
   weights_.clear();
   abscissae_.clear();
   omegas_.clear();
+  ClearDirectionMaps();
   for (size_t p = 0; p < polar_quad.weights_.size(); ++p)
   {
     const auto pol_wei = polar_quad.weights_[p];
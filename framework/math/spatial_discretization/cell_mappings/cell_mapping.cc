@@ -1,6 +1,7 @@
 #include "framework/math/spatial_discretization/cell_mappings/cell_mapping.h"
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/memory_usage.h"
 
 #include <utility>
 
@@ -173,4 +174,11 @@ CellMapping::GetNodeLocations() const
   return node_locations_;
 }
 
+size_t
+CellMapping::ComputeMemoryUsage() const
+{
+  return VectorMemoryUsage(node_locations_) + VectorMemoryUsage(areas_) +
+         VectorMemoryUsage(face_node_mappings_);
+}
+
 } // namespace opensn
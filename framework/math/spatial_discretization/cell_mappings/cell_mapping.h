@@ -68,6 +68,10 @@ public:
    * face.*/
   virtual SurfaceFiniteElementData MakeSurfaceFiniteElementData(size_t face_index) const = 0;
 
+  /**Returns the number of bytes allocated for the data of this element,
+   * excluding the size of the object itself.*/
+  virtual size_t ComputeMemoryUsage() const;
+
   virtual ~CellMapping() = default;
 
 protected:
@@ -1,5 +1,6 @@
 #include "framework/math/spatial_discretization/cell_mappings/finite_element/piecewise_linear/piecewise_linear_polygon_mapping.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/memory_usage.h"
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 
 namespace opensn
@@ -445,4 +446,11 @@ PieceWiseLinearPolygonMapping::MakeSurfaceFiniteElementData(size_t face_index) c
                                   F_num_nodes);
 }
 
+size_t
+PieceWiseLinearPolygonMapping::ComputeMemoryUsage() const
+{
+  return CellMapping::ComputeMemoryUsage() + VectorMemoryUsage(sides_) +
+         VectorMemoryUsage(node_to_side_map_);
+}
+
 } // namespace opensn
@@ -45,6 +45,8 @@ public:
 
   void GradShapeValues(const Vector3& xyz, std::vector<Vector3>& gradshape_values) const override;
 
+  size_t ComputeMemoryUsage() const override;
+
 private:
   /**
    * Define standard triangle linear shape functions
@@ -1,5 +1,6 @@
 #include "framework/math/spatial_discretization/cell_mappings/finite_element/piecewise_linear/piecewise_linear_polyhedron_mapping.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/memory_usage.h"
 #include "framework/logging/log.h"
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 
@@ -723,4 +724,24 @@ PieceWiseLinearPolyhedronMapping::MakeSurfaceFiniteElementData(size_t face_index
                                   F_num_nodes);
 }
 
+size_t
+PieceWiseLinearPolyhedronMapping::ComputeMemoryUsage() const
+{
+  size_t bytes = CellMapping::ComputeMemoryUsage() + VectorMemoryUsage(face_betaf_) +
+                 VectorMemoryUsage(face_data_) + VectorMemoryUsage(node_side_maps_);
+  for (const auto& face : face_data_)
+  {
+    bytes += VectorMemoryUsage(face.sides);
+    for (const auto& side : face.sides)
+      bytes += VectorMemoryUsage(side.v_index);
+  }
+  for (const auto& node_map : node_side_maps_)
+  {
+    bytes += VectorMemoryUsage(node_map.face_map);
+    for (const auto& face_map : node_map.face_map)
+      bytes += VectorMemoryUsage(face_map.side_map);
+  }
+  return bytes;
+}
+
 } // namespace opensn
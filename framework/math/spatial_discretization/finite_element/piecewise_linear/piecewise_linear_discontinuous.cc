@@ -4,6 +4,7 @@
 #include "framework/utils/timer.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
+#include "framework/memory_usage.h"
 #include "framework/mpi/mpi_utils.h"
 
 namespace opensn
@@ -409,4 +410,12 @@ PieceWiseLinearDiscontinuous::GetGhostDOFIndices(const UnknownManager& unknown_m
   return {};
 }
 
+size_t
+PieceWiseLinearDiscontinuous::ComputeMemoryUsage() const
+{
+  return SpatialDiscretization::ComputeMemoryUsage() +
+         VectorMemoryUsage(cell_local_block_address_) +
+         VectorMemoryUsage(neighbor_cell_block_address_);
+}
+
 } // namespace opensn
@@ -52,6 +52,8 @@ public:
 
   std::vector<int64_t> GetGhostDOFIndices(const UnknownManager& unknown_manager) const override;
 
+  size_t ComputeMemoryUsage() const override;
+
 protected:
   /**
    * Reorders the nodes for parallel computation in a Continuous Finite Element calculation.
@@ -4,6 +4,7 @@
 #include "framework/math/petsc_utils/petsc_utils.h"
 
 #include "framework/logging/log.h"
+#include "framework/memory_usage.h"
 
 namespace opensn
 {
@@ -280,4 +281,16 @@ SpatialDiscretization::GetSpatialWeightingFunction() const
   }
 }
 
+size_t
+SpatialDiscretization::ComputeMemoryUsage() const
+{
+  size_t bytes = VectorMemoryUsage(cell_mappings_) + MapMemoryUsage(nb_cell_mappings_) +
+                 VectorMemoryUsage(locJ_block_address_) + VectorMemoryUsage(locJ_block_size_);
+  for (const auto& cell_mapping : cell_mappings_)
+    bytes += cell_mapping->ComputeMemoryUsage();
+  for (const auto& [global_id, cell_mapping] : nb_cell_mappings_)
+    bytes += cell_mapping->ComputeMemoryUsage();
+  return bytes;
+}
+
 } // namespace opensn
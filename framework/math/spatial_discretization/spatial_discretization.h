@@ -178,6 +178,10 @@ public:
    * coordinate system.*/
   SpatialWeightFunction GetSpatialWeightingFunction() const;
 
+  /**Returns the number of bytes allocated for the cell mappings and the
+   * DOF addressing data of this discretization.*/
+  virtual size_t ComputeMemoryUsage() const;
+
   virtual ~SpatialDiscretization() = default;
 
 protected:
@@ -1,4 +1,10 @@
 #include "framework/memory_usage.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <algorithm>
+#include <iomanip>
+#include <set>
+#include <sstream>
 #if defined(__MACH__)
 #include <mach/mach.h>
 #else
@@ -51,4 +57,140 @@ GetMemoryUsageInMB()
   return mem_struct.memory_mbytes;
 }
 
+namespace
+{
+
+struct MemoryConsumer
+{
+  const void* owner;
+  std::string subsystem;
+  std::function<size_t()> bytes_function;
+};
+
+/**Registered consumers. Never destroyed, so that objects in static storage can
+ * unregister regardless of destruction order.*/
+std::vector<MemoryConsumer>&
+MemoryConsumers()
+{
+  static auto* consumers = new std::vector<MemoryConsumer>;
+  return *consumers;
+}
+
+} // namespace
+
+void
+RegisterMemoryConsumer(const void* owner,
+                       const std::string& subsystem,
+                       std::function<size_t()> bytes_function)
+{
+  MemoryConsumers().push_back({owner, subsystem, std::move(bytes_function)});
+}
+
+void
+UnregisterMemoryConsumers(const void* owner)
+{
+  auto& consumers = MemoryConsumers();
+  consumers.erase(std::remove_if(consumers.begin(),
+                                 consumers.end(),
+                                 [owner](const MemoryConsumer& consumer)
+                                 { return consumer.owner == owner; }),
+                  consumers.end());
+}
+
+std::map<std::string, double>
+GetSubsystemMemoryUsage()
+{
+  std::map<std::string, double> usage;
+  for (const auto& consumer : MemoryConsumers())
+    usage[consumer.subsystem] += static_cast<double>(consumer.bytes_function());
+  return usage;
+}
+
+std::map<std::string, double>
+GetMaxSubsystemMemoryUsage()
+{
+  const auto local_usage = GetSubsystemMemoryUsage();
+
+  // Processes may not share the same subsystems, so reduce over the union
+  std::vector<char> local_names;
+  for (const auto& [subsystem, bytes] : local_usage)
+  {
+    local_names.insert(local_names.end(), subsystem.begin(), subsystem.end());
+    local_names.push_back('\0');
+  }
+  std::vector<char> all_names;
+  mpi_comm.all_gather(local_names, all_names);
+
+  std::set<std::string> subsystems;
+  for (size_t i = 0; i < all_names.size();)
+  {
+    const std::string subsystem(&all_names[i]);
+    subsystems.insert(subsystem);
+    i += subsystem.size() + 1;
+  }
+
+  std::vector<double> local_values;
+  double local_total = 0.0;
+  for (const auto& subsystem : subsystems)
+  {
+    const auto it = local_usage.find(subsystem);
+    local_values.push_back(it != local_usage.end() ? it->second : 0.0);
+    local_total += local_values.back();
+  }
+  local_values.push_back(local_total);
+
+  std::vector<double> max_values(local_values.size(), 0.0);
+  mpi_comm.all_reduce(local_values.data(),
+                      static_cast<int>(local_values.size()),
+                      max_values.data(),
+                      mpi::op::max<double>());
+
+  std::map<std::string, double> usage;
+  size_t i = 0;
+  for (const auto& subsystem : subsystems)
+    usage[subsystem] = max_values[i++];
+  usage["total"] = max_values.back();
+  return usage;
+}
+
+double
+LookupSubsystemMemoryUsage(const std::map<std::string, double>& usage,
+                           const std::string& subsystem)
+{
+  const auto it = usage.find(subsystem);
+  if (it == usage.end())
+  {
+    std::string registered;
+    for (const auto& [name, bytes] : usage)
+      registered += (registered.empty() ? "\"" : ", \"") + name + "\"";
+    OpenSnInvalidArgument("No memory consumer is registered for subsystem \"" + subsystem +
+                          "\". Registered subsystems: " + registered + ".");
+  }
+  return it->second;
+}
+
+void
+LogSubsystemMemoryUsage()
+{
+  const auto usage = GetMaxSubsystemMemoryUsage();
+
+  double process_memory = 0.0;
+  mpi_comm.all_reduce(GetMemoryUsageInMB(), process_memory, mpi::op::max<double>());
+
+  std::stringstream outstr;
+  auto AddRow = [&outstr](const std::string& name, double mbytes)
+  {
+    outstr << "\n  " << std::left << std::setw(28) << name << std::right << std::fixed
+           << std::setprecision(3) << std::setw(12) << mbytes << " MB";
+  };
+
+  outstr << "Memory usage by subsystem (max over processes):";
+  for (const auto& [subsystem, bytes] : usage)
+    if (subsystem != "total")
+      AddRow(subsystem, CSTMemory(bytes).memory_mbytes);
+  AddRow("total", CSTMemory(usage.at("total")).memory_mbytes);
+  AddRow("process", process_memory);
+  log.Log() << outstr.str();
+}
+
 } // namespace opensn
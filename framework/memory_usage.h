@@ -1,5 +1,10 @@
 #pragma once
 
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
 namespace opensn
 {
 
@@ -36,4 +41,78 @@ CSTMemory GetMemoryUsage();
  */
 double GetMemoryUsageInMB();
 
+/**
+ * Returns the number of bytes allocated for the elements of a vector.
+ */
+template <typename T>
+size_t
+VectorMemoryUsage(const std::vector<T>& vector)
+{
+  return vector.capacity() * sizeof(T);
+}
+
+/**
+ * Returns the number of bytes allocated for the elements of a vector of vectors.
+ */
+template <typename T>
+size_t
+VectorMemoryUsage(const std::vector<std::vector<T>>& vector)
+{
+  size_t bytes = vector.capacity() * sizeof(std::vector<T>);
+  for (const auto& entry : vector)
+    bytes += entry.capacity() * sizeof(T);
+  return bytes;
+}
+
+/**
+ * Returns an estimate of the number of bytes allocated for the nodes of a map.
+ */
+template <typename K, typename V>
+size_t
+MapMemoryUsage(const std::map<K, V>& map)
+{
+  return map.size() * (sizeof(typename std::map<K, V>::value_type) + 4 * sizeof(void*));
+}
+
+/**
+ * Registers a function returning the number of bytes currently held by a data
+ * structure of the named subsystem, e.g., "mesh" or "fluds". The functions of
+ * all owners registered for the same subsystem are summed. An owner must
+ * unregister its functions before it is destroyed.
+ */
+void RegisterMemoryConsumer(const void* owner,
+                            const std::string& subsystem,
+                            std::function<size_t()> bytes_function);
+
+/**
+ * Removes all memory consumers registered by the given owner.
+ */
+void UnregisterMemoryConsumers(const void* owner);
+
+/**
+ * Returns the memory, in bytes, held by each registered subsystem on this process.
+ */
+std::map<std::string, double> GetSubsystemMemoryUsage();
+
+/**
+ * Returns the maximum over all processes of the memory, in bytes, held by each
+ * registered subsystem. The entry "total" holds the maximum over all processes
+ * of the sum of all subsystems. This is a collective call.
+ */
+std::map<std::string, double> GetMaxSubsystemMemoryUsage();
+
+/**
+ * Returns the entry of the named subsystem in a map returned by
+ * `GetSubsystemMemoryUsage` or `GetMaxSubsystemMemoryUsage`. Throws if no
+ * consumer is registered for the subsystem.
+ */
+double LookupSubsystemMemoryUsage(const std::map<std::string, double>& usage,
+                                  const std::string& subsystem);
+
+/**
+ * Logs a table of the per-subsystem memory usage, maximized over processes,
+ * together with the maximum process memory. This is a collective call.
+ */
+void LogSubsystemMemoryUsage();
+
 } // namespace opensn
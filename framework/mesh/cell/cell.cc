@@ -115,7 +115,7 @@ CellFace::GetNeighborLocalID(const MeshContinuum& grid) const
 {
   if (not has_neighbor_)
     return -1;
-  if (opensn::mpi_comm.size() == 1)
+  if (opensn::mpi_comm.size() == 1 and not grid.LocalCellsRenumbered())
     return neighbor_id_; // cause global_ids=local_ids
 
   auto& adj_cell = grid.cells[neighbor_id_];
@@ -0,0 +1,154 @@
+#include "framework/mesh/mesh_continuum/cell_spatial_index.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/cell/cell.h"
+#include "framework/memory_usage.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace opensn
+{
+
+CellSpatialIndex::CellSpatialIndex(const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+  cell_boxes_.reserve(num_cells);
+  for (const auto& cell : grid.local_cells)
+  {
+    Vector3 box_min = grid.vertices[cell.vertex_ids_.front()];
+    Vector3 box_max = box_min;
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& vertex = grid.vertices[vid];
+      for (size_t d = 0; d < 3; ++d)
+      {
+        box_min(d) = std::min(box_min[d], vertex[d]);
+        box_max(d) = std::max(box_max[d], vertex[d]);
+      }
+    }
+    cell_boxes_.push_back({box_min, box_max});
+  }
+
+  if (num_cells == 0)
+  {
+    bin_offsets_.assign(2, 0);
+    return;
+  }
+
+  // Domain bounding box and tolerance
+  for (size_t d = 0; d < 3; ++d)
+  {
+    xyz_min_[d] = cell_boxes_.front()[0][d];
+    xyz_max_[d] = cell_boxes_.front()[1][d];
+  }
+  for (const auto& box : cell_boxes_)
+    for (size_t d = 0; d < 3; ++d)
+    {
+      xyz_min_[d] = std::min(xyz_min_[d], box[0][d]);
+      xyz_max_[d] = std::max(xyz_max_[d], box[1][d]);
+    }
+
+  double diagonal = 0.0;
+  for (size_t d = 0; d < 3; ++d)
+    diagonal += (xyz_max_[d] - xyz_min_[d]) * (xyz_max_[d] - xyz_min_[d]);
+  const double tolerance = 1.0e-10 * std::max(std::sqrt(diagonal), 1.0);
+
+  for (auto& box : cell_boxes_)
+    for (size_t d = 0; d < 3; ++d)
+    {
+      box[0](d) -= tolerance;
+      box[1](d) += tolerance;
+    }
+  for (size_t d = 0; d < 3; ++d)
+  {
+    xyz_min_[d] -= tolerance;
+    xyz_max_[d] += tolerance;
+  }
+
+  // Bin counts such that there is about one cell per bin. Directions without
+  // extent, e.g., z for 2D meshes, get a single bin.
+  size_t num_dims = 0;
+  double volume = 1.0;
+  for (size_t d = 0; d < 3; ++d)
+    if (xyz_max_[d] - xyz_min_[d] > 2.0 * tolerance)
+    {
+      ++num_dims;
+      volume *= xyz_max_[d] - xyz_min_[d];
+    }
+  const double bin_size =
+    num_dims > 0 ? std::pow(volume / static_cast<double>(num_cells), 1.0 / num_dims) : 1.0;
+  for (size_t d = 0; d < 3; ++d)
+  {
+    const double extent = xyz_max_[d] - xyz_min_[d];
+    num_bins_[d] = 1;
+    if (extent > 2.0 * tolerance)
+      num_bins_[d] = std::clamp(
+        static_cast<size_t>(std::ceil(extent / bin_size)), static_cast<size_t>(1), num_cells);
+    inv_bin_size_[d] = static_cast<double>(num_bins_[d]) / extent;
+  }
+
+  // Two passes: count the cells per bin, then fill the bins in local-id order
+  const size_t total_bins = num_bins_[0] * num_bins_[1] * num_bins_[2];
+  auto ForEachBin = [this](const std::array<Vector3, 2>& box, auto&& function)
+  {
+    std::array<size_t, 3> lo{}, hi{};
+    for (size_t d = 0; d < 3; ++d)
+    {
+      lo[d] = BinIndex(box[0][d], d);
+      hi[d] = BinIndex(box[1][d], d);
+    }
+    for (size_t k = lo[2]; k <= hi[2]; ++k)
+      for (size_t j = lo[1]; j <= hi[1]; ++j)
+        for (size_t i = lo[0]; i <= hi[0]; ++i)
+          function(i + num_bins_[0] * (j + num_bins_[1] * k));
+  };
+
+  bin_offsets_.assign(total_bins + 1, 0);
+  for (const auto& box : cell_boxes_)
+    ForEachBin(box, [this](size_t bin) { ++bin_offsets_[bin + 1]; });
+  for (size_t b = 0; b < total_bins; ++b)
+    bin_offsets_[b + 1] += bin_offsets_[b];
+
+  bin_cells_.resize(bin_offsets_.back());
+  std::vector<size_t> fill(bin_offsets_.begin(), bin_offsets_.end() - 1);
+  for (uint64_t c = 0; c < num_cells; ++c)
+    ForEachBin(cell_boxes_[c], [this, &fill, c](size_t bin) { bin_cells_[fill[bin]++] = c; });
+}
+
+size_t
+CellSpatialIndex::BinIndex(const double coordinate, const size_t d) const
+{
+  const double position = (coordinate - xyz_min_[d]) * inv_bin_size_[d];
+  if (not(position > 0.0))
+    return 0;
+  return std::min(static_cast<size_t>(position), num_bins_[d] - 1);
+}
+
+void
+CellSpatialIndex::FindCandidateCells(const Vector3& point, std::vector<uint64_t>& local_ids) const
+{
+  local_ids.clear();
+  for (size_t d = 0; d < 3; ++d)
+    if (point[d] < xyz_min_[d] or point[d] > xyz_max_[d])
+      return;
+
+  const size_t bin = BinIndex(point.x, 0) +
+                     num_bins_[0] * (BinIndex(point.y, 1) + num_bins_[1] * BinIndex(point.z, 2));
+  for (size_t k = bin_offsets_[bin]; k < bin_offsets_[bin + 1]; ++k)
+  {
+    const uint64_t c = bin_cells_[k];
+    const auto& box = cell_boxes_[c];
+    if (point.x >= box[0].x and point.x <= box[1].x and point.y >= box[0].y and
+        point.y <= box[1].y and point.z >= box[0].z and point.z <= box[1].z)
+      local_ids.push_back(c);
+  }
+}
+
+size_t
+CellSpatialIndex::ComputeMemoryUsage() const
+{
+  return VectorMemoryUsage(cell_boxes_) + VectorMemoryUsage(bin_offsets_) +
+         VectorMemoryUsage(bin_cells_);
+}
+
+} // namespace opensn
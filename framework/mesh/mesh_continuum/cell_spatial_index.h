@@ -0,0 +1,54 @@
+#pragma once
+
+#include "framework/mesh/mesh.h"
+
+#include <array>
+#include <vector>
+#include <cstdint>
+
+namespace opensn
+{
+class MeshContinuum;
+
+/**
+ * Uniform grid of bins over the bounding boxes of the local cells of a mesh.
+ * Each bin lists, in ascending local-id order, the cells whose bounding box
+ * overlaps the bin, so that the cells that may contain a point are found by
+ * looking up a single bin instead of testing every local cell. The number of
+ * bins is chosen such that there is roughly one cell per bin. Bounding boxes
+ * are enlarged by a small relative tolerance so that points on cell faces are
+ * never missed.
+ */
+class CellSpatialIndex
+{
+public:
+  /**Builds the index over the current local cells of the grid.*/
+  explicit CellSpatialIndex(const MeshContinuum& grid);
+
+  /**Returns the number of cells the index was built over.*/
+  size_t NumCells() const { return cell_boxes_.size(); }
+
+  /**Returns the local-ids, in ascending order, of the cells whose bounding
+   * box contains the point. These are the only cells that can contain it.*/
+  void FindCandidateCells(const Vector3& point, std::vector<uint64_t>& local_ids) const;
+
+  /**Returns the number of bytes allocated for the index.*/
+  size_t ComputeMemoryUsage() const;
+
+private:
+  /**Returns the bin index of the point along direction `d`, clamped to the grid.*/
+  size_t BinIndex(double coordinate, size_t d) const;
+
+  std::array<double, 3> xyz_min_ = {0.0, 0.0, 0.0};
+  std::array<double, 3> xyz_max_ = {0.0, 0.0, 0.0};
+  std::array<double, 3> inv_bin_size_ = {0.0, 0.0, 0.0};
+  std::array<size_t, 3> num_bins_ = {1, 1, 1};
+
+  /// Enlarged bounding box {min, max} of each local cell
+  std::vector<std::array<Vector3, 2>> cell_boxes_;
+  /// Cells per bin in CSR form
+  std::vector<size_t> bin_offsets_;
+  std::vector<uint64_t> bin_cells_;
+};
+
+} // namespace opensn
@@ -0,0 +1,301 @@
+#include "framework/mesh/mesh_continuum/grid_vtu_writer.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/cell/cell.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+#include <vtkCellType.h>
+#include <fstream>
+#include <sstream>
+
+namespace opensn
+{
+
+namespace
+{
+
+int
+VTKCellType(const Cell& cell)
+{
+  if (cell.Type() == CellType::SLAB)
+    return VTK_LINE;
+  if (cell.Type() == CellType::POLYGON)
+    switch (cell.SubType())
+    {
+      case CellType::QUADRILATERAL:
+        return VTK_QUAD;
+      case CellType::TRIANGLE:
+        return VTK_TRIANGLE;
+      default:
+        return VTK_POLYGON;
+    }
+  if (cell.Type() == CellType::POLYHEDRON)
+    switch (cell.SubType())
+    {
+      case CellType::PYRAMID:
+        return VTK_PYRAMID;
+      case CellType::WEDGE:
+        return VTK_WEDGE;
+      case CellType::HEXAHEDRON:
+        return VTK_HEXAHEDRON;
+      case CellType::TETRAHEDRON:
+        return VTK_TETRA;
+      default:
+        return VTK_POLYHEDRON;
+    }
+  OpenSnLogicalError("Unsupported cell type encountered.");
+}
+
+const char*
+VTKTypeName(const double*)
+{
+  return "Float64";
+}
+const char*
+VTKTypeName(const int64_t*)
+{
+  return "Int64";
+}
+const char*
+VTKTypeName(const int32_t*)
+{
+  return "Int32";
+}
+const char*
+VTKTypeName(const uint32_t*)
+{
+  return "UInt32";
+}
+const char*
+VTKTypeName(const uint8_t*)
+{
+  return "UInt8";
+}
+
+/**An array of the appended data section of a `.vtu` file.*/
+struct AppendedArray
+{
+  std::string name;
+  const char* type;
+  int num_components;
+  const char* data;
+  uint64_t num_bytes;
+};
+
+template <typename T>
+AppendedArray
+MakeAppendedArray(const std::string& name, const std::vector<T>& values, int num_components = 1)
+{
+  return {name,
+          VTKTypeName(values.data()),
+          num_components,
+          reinterpret_cast<const char*>(values.data()),
+          values.size() * sizeof(T)};
+}
+
+const char*
+ByteOrder()
+{
+  const uint16_t one = 1;
+  return *reinterpret_cast<const uint8_t*>(&one) == 1 ? "LittleEndian" : "BigEndian";
+}
+
+/**Writes the data array elements of a section and advances the appended offset.*/
+void
+WriteDataArrayElements(std::ostream& xml,
+                       const std::vector<AppendedArray>& arrays,
+                       uint64_t& offset)
+{
+  for (const auto& array : arrays)
+  {
+    xml << "        <DataArray type=\"" << array.type << "\"";
+    if (not array.name.empty())
+      xml << " Name=\"" << array.name << "\"";
+    if (array.num_components > 1)
+      xml << " NumberOfComponents=\"" << array.num_components << "\"";
+    xml << " format=\"appended\" offset=\"" << offset << "\"/>\n";
+    offset += sizeof(uint64_t) + array.num_bytes;
+  }
+}
+
+void
+WritePVTUFile(const std::string& file_base_name,
+              const std::vector<VTUDataArray>& point_data,
+              const std::vector<VTUDataArray>& cell_data,
+              const int num_pieces)
+{
+  const std::string pvtu_file_name = file_base_name + ".pvtu";
+  std::ofstream file(pvtu_file_name);
+  OpenSnLogicalErrorIf(not file.is_open(), "Failed to open \"" + pvtu_file_name + "\".");
+
+  // Pieces are referenced relative to the .pvtu file
+  const size_t slash = file_base_name.find_last_of('/');
+  const std::string piece_base_name =
+    slash == std::string::npos ? file_base_name : file_base_name.substr(slash + 1);
+
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\" byte_order=\"" << ByteOrder()
+       << "\" header_type=\"UInt64\">\n"
+       << "  <PUnstructuredGrid GhostLevel=\"0\">\n"
+       << "    <PPointData>\n";
+  for (const auto& array : point_data)
+    file << "      <PDataArray type=\"Float64\" Name=\"" << array.name << "\"/>\n";
+  file << "    </PPointData>\n"
+       << "    <PCellData>\n"
+       << "      <PDataArray type=\"Int32\" Name=\"Material\"/>\n"
+       << "      <PDataArray type=\"UInt32\" Name=\"Partition\"/>\n";
+  for (const auto& array : cell_data)
+    file << "      <PDataArray type=\"Float64\" Name=\"" << array.name << "\"/>\n";
+  file << "    </PCellData>\n"
+       << "    <PPoints>\n"
+       << "      <PDataArray type=\"Float64\" NumberOfComponents=\"3\"/>\n"
+       << "    </PPoints>\n";
+  for (int p = 0; p < num_pieces; ++p)
+    file << "    <Piece Source=\"" << piece_base_name << "_" << p << ".vtu\"/>\n";
+  file << "  </PUnstructuredGrid>\n"
+       << "</VTKFile>\n";
+}
+
+} // namespace
+
+VTUGeometry::VTUGeometry(const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+  offsets.reserve(num_cells);
+  types.reserve(num_cells);
+  material_ids.reserve(num_cells);
+  partition_ids.reserve(num_cells);
+  cell_node_offsets.reserve(num_cells);
+  face_offsets.reserve(num_cells);
+
+  for (const auto& cell : grid.local_cells)
+  {
+    const size_t num_verts = cell.vertex_ids_.size();
+    const auto first_node = static_cast<int64_t>(NumPoints());
+    cell_node_offsets.push_back(NumPoints());
+    for (size_t v = 0; v < num_verts; ++v)
+    {
+      const auto& vertex = grid.vertices[cell.vertex_ids_[v]];
+      points.insert(points.end(), {vertex.x, vertex.y, vertex.z});
+      connectivity.push_back(first_node + static_cast<int64_t>(v));
+    }
+    offsets.push_back(static_cast<int64_t>(connectivity.size()));
+
+    const int vtk_type = VTKCellType(cell);
+    types.push_back(static_cast<uint8_t>(vtk_type));
+    material_ids.push_back(cell.material_id_);
+    partition_ids.push_back(static_cast<uint32_t>(cell.partition_id_));
+
+    // General polyhedra need the face stream {num_faces, {num_face_verts, verts}...}
+    if (vtk_type == VTK_POLYHEDRON)
+    {
+      faces.push_back(static_cast<int64_t>(cell.faces_.size()));
+      for (const auto& face : cell.faces_)
+      {
+        faces.push_back(static_cast<int64_t>(face.vertex_ids_.size()));
+        for (const uint64_t fvid : face.vertex_ids_)
+        {
+          size_t v = 0;
+          for (size_t cv = 0; cv < num_verts; ++cv)
+            if (cell.vertex_ids_[cv] == fvid)
+            {
+              v = cv;
+              break;
+            }
+          faces.push_back(first_node + static_cast<int64_t>(v));
+        }
+      }
+      face_offsets.push_back(static_cast<int64_t>(faces.size()));
+    }
+    else
+      face_offsets.push_back(-1);
+  }
+
+  if (faces.empty())
+    face_offsets.clear();
+}
+
+void
+WriteVTUFiles(const std::string& file_base_name,
+              const VTUGeometry& geometry,
+              const std::vector<VTUDataArray>& point_data,
+              const std::vector<VTUDataArray>& cell_data)
+{
+  for (const auto& array : point_data)
+    OpenSnLogicalErrorIf(array.values.size() != geometry.NumPoints(),
+                         "Point data array \"" + array.name + "\" has the wrong size.");
+  for (const auto& array : cell_data)
+    OpenSnLogicalErrorIf(array.values.size() != geometry.NumCells(),
+                         "Cell data array \"" + array.name + "\" has the wrong size.");
+
+  if (opensn::mpi_comm.rank() == 0)
+    WritePVTUFile(file_base_name, point_data, cell_data, opensn::mpi_comm.size());
+
+  std::vector<AppendedArray> point_arrays;
+  for (const auto& array : point_data)
+    point_arrays.push_back(MakeAppendedArray(array.name, array.values));
+
+  std::vector<AppendedArray> cell_arrays = {
+    MakeAppendedArray("Material", geometry.material_ids),
+    MakeAppendedArray("Partition", geometry.partition_ids)};
+  for (const auto& array : cell_data)
+    cell_arrays.push_back(MakeAppendedArray(array.name, array.values));
+
+  const std::vector<AppendedArray> point_coordinates = {
+    MakeAppendedArray("", geometry.points, 3)};
+
+  std::vector<AppendedArray> cell_topology = {
+    MakeAppendedArray("connectivity", geometry.connectivity),
+    MakeAppendedArray("offsets", geometry.offsets),
+    MakeAppendedArray("types", geometry.types)};
+  if (not geometry.faces.empty())
+  {
+    cell_topology.push_back(MakeAppendedArray("faces", geometry.faces));
+    cell_topology.push_back(MakeAppendedArray("faceoffsets", geometry.face_offsets));
+  }
+
+  std::ostringstream xml;
+  uint64_t offset = 0;
+  xml << "<?xml version=\"1.0\"?>\n"
+      << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"" << ByteOrder()
+      << "\" header_type=\"UInt64\">\n"
+      << "  <UnstructuredGrid>\n"
+      << "    <Piece NumberOfPoints=\"" << geometry.NumPoints() << "\" NumberOfCells=\""
+      << geometry.NumCells() << "\">\n"
+      << "      <PointData>\n";
+  WriteDataArrayElements(xml, point_arrays, offset);
+  xml << "      </PointData>\n"
+      << "      <CellData>\n";
+  WriteDataArrayElements(xml, cell_arrays, offset);
+  xml << "      </CellData>\n"
+      << "      <Points>\n";
+  WriteDataArrayElements(xml, point_coordinates, offset);
+  xml << "      </Points>\n"
+      << "      <Cells>\n";
+  WriteDataArrayElements(xml, cell_topology, offset);
+  xml << "      </Cells>\n"
+      << "    </Piece>\n"
+      << "  </UnstructuredGrid>\n"
+      << "  <AppendedData encoding=\"raw\">\n"
+      << "   _";
+
+  const std::string vtu_file_name =
+    file_base_name + "_" + std::to_string(opensn::mpi_comm.rank()) + ".vtu";
+  std::ofstream file(vtu_file_name, std::ios::binary);
+  OpenSnLogicalErrorIf(not file.is_open(), "Failed to open \"" + vtu_file_name + "\".");
+
+  file << xml.str();
+  const std::vector<AppendedArray>* sections[] = {
+    &point_arrays, &cell_arrays, &point_coordinates, &cell_topology};
+  for (const auto* section : sections)
+    for (const auto& array : *section)
+    {
+      file.write(reinterpret_cast<const char*>(&array.num_bytes), sizeof(uint64_t));
+      file.write(array.data, static_cast<std::streamsize>(array.num_bytes));
+    }
+  file << "\n  </AppendedData>\n"
+       << "</VTKFile>\n";
+
+  OpenSnLogicalErrorIf(not file.good(), "Failed to write \"" + vtu_file_name + "\".");
+}
+
+} // namespace opensn
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace opensn
+{
+class MeshContinuum;
+
+/**
+ * The local cells of a grid in the layout of a VTK unstructured grid, with
+ * the nodes of each cell stored separately (discontinuous). The arrays are
+ * written as-is to the appended data section of `.vtu` files, so building
+ * them once per grid makes repeated exports cheap. Node `n` of the cell with
+ * local-id `c` is point `cell_node_offsets[c] + n`.
+ */
+struct VTUGeometry
+{
+  explicit VTUGeometry(const MeshContinuum& grid);
+
+  size_t NumPoints() const { return points.size() / 3; }
+  size_t NumCells() const { return types.size(); }
+
+  std::vector<double> points;
+  std::vector<int64_t> connectivity;
+  std::vector<int64_t> offsets;
+  std::vector<uint8_t> types;
+  /// Face streams of general polyhedra. Empty if there are none.
+  std::vector<int64_t> faces;
+  std::vector<int64_t> face_offsets;
+  std::vector<int32_t> material_ids;
+  std::vector<uint32_t> partition_ids;
+  std::vector<size_t> cell_node_offsets;
+};
+
+/**A named array of doubles with one value per point or per cell.*/
+struct VTUDataArray
+{
+  std::string name;
+  std::vector<double> values;
+};
+
+/**
+ * Writes the geometry and the supplied point and cell data to a `.vtu` file
+ * per process and, on the root process, a `.pvtu` file referencing all pieces.
+ * All arrays are written as raw binary appended data, i.e., without encoding
+ * or an intermediate VTK data set. This is a collective call.
+ */
+void WriteVTUFiles(const std::string& file_base_name,
+                   const VTUGeometry& geometry,
+                   const std::vector<VTUDataArray>& point_data,
+                   const std::vector<VTUDataArray>& cell_data);
+
+} // namespace opensn
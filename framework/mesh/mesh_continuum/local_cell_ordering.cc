@@ -0,0 +1,245 @@
+#include "framework/mesh/mesh_continuum/local_cell_ordering.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <queue>
+
+namespace opensn
+{
+
+namespace
+{
+
+/**Local cell graph in CSR form.*/
+struct LocalCellGraph
+{
+  std::vector<size_t> offsets;
+  std::vector<uint64_t> neighbors;
+
+  size_t Degree(uint64_t c) const { return offsets[c + 1] - offsets[c]; }
+};
+
+LocalCellGraph
+MakeLocalCellGraph(const MeshContinuum& grid)
+{
+  LocalCellGraph graph;
+  graph.offsets.reserve(grid.local_cells.size() + 1);
+  graph.offsets.push_back(0);
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces_)
+      if (face.has_neighbor_ and face.IsNeighborLocal(grid))
+        graph.neighbors.push_back(face.GetNeighborLocalID(grid));
+    graph.offsets.push_back(graph.neighbors.size());
+  }
+  return graph;
+}
+
+/**Executes a breadth-first search from `root` over cells not yet numbered and
+ * returns the nodes of the last level along with the number of levels.*/
+std::pair<std::vector<uint64_t>, size_t>
+LastBFSLevel(const LocalCellGraph& graph, uint64_t root, const std::vector<bool>& numbered)
+{
+  const size_t num_cells = graph.offsets.size() - 1;
+  std::vector<bool> seen(num_cells, false);
+  std::vector<uint64_t> level = {root};
+  seen[root] = true;
+  size_t num_levels = 1;
+  while (true)
+  {
+    std::vector<uint64_t> next_level;
+    for (const uint64_t c : level)
+      for (size_t k = graph.offsets[c]; k < graph.offsets[c + 1]; ++k)
+      {
+        const uint64_t n = graph.neighbors[k];
+        if (not seen[n] and not numbered[n])
+        {
+          seen[n] = true;
+          next_level.push_back(n);
+        }
+      }
+    if (next_level.empty())
+      break;
+    level = std::move(next_level);
+    ++num_levels;
+  }
+  return {level, num_levels};
+}
+
+/**Interleaves the bits of the Hilbert transpose of three coordinates, each
+ * quantized to `bits` bits, into a single index. See J. Skilling,
+ * "Programming the Hilbert curve", AIP Conf. Proc. 707 (2004).*/
+uint64_t
+HilbertIndex3D(std::array<uint32_t, 3> x, const int bits)
+{
+  const uint32_t M = 1u << (bits - 1);
+
+  // Inverse undo excess work
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+  {
+    const uint32_t P = Q - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (x[i] & Q)
+        x[0] ^= P;
+      else
+      {
+        const uint32_t t = (x[0] ^ x[i]) & P;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i = 1; i < 3; ++i)
+    x[i] ^= x[i - 1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1)
+    if (x[2] & Q)
+      t ^= Q - 1;
+  for (int i = 0; i < 3; ++i)
+    x[i] ^= t;
+
+  uint64_t index = 0;
+  for (int b = bits - 1; b >= 0; --b)
+    for (int i = 0; i < 3; ++i)
+      index = (index << 1) | ((x[i] >> b) & 1u);
+
+  return index;
+}
+
+} // namespace
+
+std::vector<uint64_t>
+MakeHilbertLocalCellOrdering(const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+  std::vector<uint64_t> new_to_old(num_cells);
+  std::iota(new_to_old.begin(), new_to_old.end(), 0);
+  if (num_cells == 0)
+    return new_to_old;
+
+  std::array<double, 3> xyz_min = {grid.local_cells[0].centroid_[0],
+                                   grid.local_cells[0].centroid_[1],
+                                   grid.local_cells[0].centroid_[2]};
+  std::array<double, 3> xyz_max = xyz_min;
+  for (const auto& cell : grid.local_cells)
+    for (int d = 0; d < 3; ++d)
+    {
+      xyz_min[d] = std::min(xyz_min[d], cell.centroid_[d]);
+      xyz_max[d] = std::max(xyz_max[d], cell.centroid_[d]);
+    }
+
+  // 21 bits per dimension fills a 63-bit index
+  constexpr int bits = 21;
+  constexpr double max_coord = static_cast<double>((1u << bits) - 1);
+
+  std::vector<uint64_t> keys(num_cells);
+  for (const auto& cell : grid.local_cells)
+  {
+    std::array<uint32_t, 3> q = {0, 0, 0};
+    for (int d = 0; d < 3; ++d)
+    {
+      const double extent = xyz_max[d] - xyz_min[d];
+      if (extent > 0.0)
+        q[d] = static_cast<uint32_t>((cell.centroid_[d] - xyz_min[d]) / extent * max_coord);
+    }
+    keys[cell.local_id_] = HilbertIndex3D(q, bits);
+  }
+
+  std::stable_sort(new_to_old.begin(),
+                   new_to_old.end(),
+                   [&keys](uint64_t a, uint64_t b) { return keys[a] < keys[b]; });
+
+  return new_to_old;
+}
+
+std::vector<uint64_t>
+MakeRCMLocalCellOrdering(const MeshContinuum& grid)
+{
+  const size_t num_cells = grid.local_cells.size();
+  const auto graph = MakeLocalCellGraph(grid);
+
+  auto LowerDegree = [&graph](uint64_t a, uint64_t b) { return graph.Degree(a) < graph.Degree(b); };
+
+  // Cells sorted by degree are used to pick the start of each component
+  std::vector<uint64_t> by_degree(num_cells);
+  std::iota(by_degree.begin(), by_degree.end(), 0);
+  std::stable_sort(by_degree.begin(), by_degree.end(), LowerDegree);
+
+  std::vector<bool> numbered(num_cells, false);
+  std::vector<uint64_t> order;
+  order.reserve(num_cells);
+
+  std::vector<uint64_t> neighbors;
+  for (const uint64_t start : by_degree)
+  {
+    if (numbered[start])
+      continue;
+
+    // Find a pseudo-peripheral root (George-Liu)
+    uint64_t root = start;
+    auto [last_level, eccentricity] = LastBFSLevel(graph, root, numbered);
+    while (true)
+    {
+      const uint64_t candidate =
+        *std::min_element(last_level.begin(), last_level.end(), LowerDegree);
+      auto [cand_last_level, cand_eccentricity] = LastBFSLevel(graph, candidate, numbered);
+      if (cand_eccentricity <= eccentricity)
+        break;
+      root = candidate;
+      last_level = std::move(cand_last_level);
+      eccentricity = cand_eccentricity;
+    }
+
+    // Cuthill-McKee traversal of the component
+    std::queue<uint64_t> queue;
+    queue.push(root);
+    numbered[root] = true;
+    while (not queue.empty())
+    {
+      const uint64_t c = queue.front();
+      queue.pop();
+      order.push_back(c);
+
+      neighbors.clear();
+      for (size_t k = graph.offsets[c]; k < graph.offsets[c + 1]; ++k)
+      {
+        const uint64_t n = graph.neighbors[k];
+        if (not numbered[n])
+        {
+          numbered[n] = true;
+          neighbors.push_back(n);
+        }
+      }
+      std::stable_sort(neighbors.begin(), neighbors.end(), LowerDegree);
+      for (const uint64_t n : neighbors)
+        queue.push(n);
+    }
+  }
+
+  std::reverse(order.begin(), order.end());
+  return order;
+}
+
+uint64_t
+ComputeLocalCellGraphBandwidth(const MeshContinuum& grid)
+{
+  const auto graph = MakeLocalCellGraph(grid);
+  const size_t num_cells = graph.offsets.size() - 1;
+
+  uint64_t bandwidth = 0;
+  for (uint64_t c = 0; c < num_cells; ++c)
+    for (size_t k = graph.offsets[c]; k < graph.offsets[c + 1]; ++k)
+    {
+      const uint64_t n = graph.neighbors[k];
+      bandwidth = std::max(bandwidth, n > c ? n - c : c - n);
+    }
+
+  return bandwidth;
+}
+
+} // namespace opensn
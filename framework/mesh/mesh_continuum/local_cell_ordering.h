@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace opensn
+{
+class MeshContinuum;
+
+/**
+ * Computes an ordering of the local cells along a 3D Hilbert space-filling
+ * curve through the cell centroids. The result maps new local-ids to old
+ * local-ids and can be passed to `MeshContinuum::RenumberLocalCells`.
+ */
+std::vector<uint64_t> MakeHilbertLocalCellOrdering(const MeshContinuum& grid);
+
+/**
+ * Computes a Reverse Cuthill-McKee ordering of the local cell graph, i.e.,
+ * the graph of local cells connected through faces shared with other local
+ * cells. Each connected component is started from a pseudo-peripheral cell.
+ * The result maps new local-ids to old local-ids and can be passed to
+ * `MeshContinuum::RenumberLocalCells`.
+ */
+std::vector<uint64_t> MakeRCMLocalCellOrdering(const MeshContinuum& grid);
+
+/**
+ * Computes the bandwidth of the local cell graph under the current local-ids,
+ * i.e., the maximum local-id difference between two face-connected local cells.
+ */
+uint64_t ComputeLocalCellGraphBandwidth(const MeshContinuum& grid);
+
+} // namespace opensn
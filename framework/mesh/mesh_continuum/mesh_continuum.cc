@@ -4,6 +4,7 @@
 #include "framework/mesh/logical_volume/logical_volume.h"
 #include "framework/mesh/cell/cell.h"
 #include "framework/data_types/ndarray.h"
+#include "framework/data_types/byte_array.h"
 #include "framework/mpi/mpi_comm_set.h"
 #include "framework/utils/timer.h"
 #include "framework/logging/log.h"
@@ -17,10 +18,143 @@
 #include <vtkCellData.h>
 #include <algorithm>
 #include <set>
+#include <limits>
 
 namespace opensn
 {
 
+void
+MeshContinuum::PackLocalCells()
+{
+  // Copy rather than move so that the per-cell vertex and face lists are
+  // reallocated in local-id order as well
+  std::vector<Cell> packed_cells;
+  packed_cells.reserve(local_cells_.size());
+  for (const auto& cell_ptr : local_cells_)
+    packed_cells.push_back(*cell_ptr);
+
+  local_cells_.clear();
+  packed_local_cells_ = std::move(packed_cells);
+
+  local_cells_.reserve(packed_local_cells_.size());
+  for (auto& cell : packed_local_cells_)
+    local_cells_.push_back(LocalCellPtr(&cell, LocalCellDeleter{false}));
+
+  face_table_.Build(*this);
+  cell_spatial_index_.reset();
+  vtu_geometry_.reset();
+
+  log.Log0Verbose1() << "Packed " << packed_local_cells_.size() << " local cells with "
+                     << face_table_.NumFaces() << " faces into contiguous storage.";
+}
+
+void
+MeshContinuum::RenumberLocalCells(const std::vector<uint64_t>& new_to_old)
+{
+  const size_t num_local_cells = local_cells_.size();
+  OpenSnInvalidArgumentIf(new_to_old.size() != num_local_cells,
+                          "Renumbering map size " + std::to_string(new_to_old.size()) +
+                            " does not match the number of local cells " +
+                            std::to_string(num_local_cells) + ".");
+
+  std::vector<LocalCellPtr> renumbered_cells(num_local_cells);
+  for (uint64_t new_id = 0; new_id < num_local_cells; ++new_id)
+  {
+    const uint64_t old_id = new_to_old[new_id];
+    OpenSnInvalidArgumentIf(old_id >= num_local_cells or local_cells_[old_id] == nullptr,
+                            "Renumbering map is not a permutation of the local cells.");
+
+    auto& cell_ptr = renumbered_cells[new_id];
+    cell_ptr = std::move(local_cells_[old_id]);
+    cell_ptr->local_id_ = new_id;
+    global_cell_id_to_local_id_map_[cell_ptr->global_id_] = new_id;
+    if (old_id != new_id)
+      local_cells_renumbered_ = true;
+  }
+  local_cells_ = std::move(renumbered_cells);
+  cell_spatial_index_.reset();
+  vtu_geometry_.reset();
+
+  if (HasPackedLocalCells())
+    PackLocalCells();
+}
+
+std::shared_ptr<MeshContinuum>
+MeshContinuum::MakeRepartitioned(const std::vector<int64_t>& cell_partition_ids) const
+{
+  const size_t num_local_cells = local_cells_.size();
+  OpenSnInvalidArgumentIf(cell_partition_ids.size() != num_local_cells,
+                          "Partition id count " + std::to_string(cell_partition_ids.size()) +
+                            " does not match the number of local cells " +
+                            std::to_string(num_local_cells) + ".");
+
+  // Serialize the local cells with their new partition ids, each followed by
+  // the coordinates of its vertices
+  ByteArray local_data;
+  for (const auto& cell : local_cells)
+  {
+    const int64_t pid = cell_partition_ids[cell.local_id_];
+    OpenSnInvalidArgumentIf(pid < 0 or pid >= opensn::mpi_comm.size(),
+                            "Invalid partition id " + std::to_string(pid) + " for cell " +
+                              std::to_string(cell.global_id_) + ".");
+
+    Cell moved_cell(cell);
+    moved_cell.partition_id_ = static_cast<uint64_t>(pid);
+    local_data.Append(moved_cell.Serialize());
+    for (const uint64_t vid : cell.vertex_ids_)
+      local_data.Write<Vector3>(vertices[vid]);
+  }
+
+  std::vector<std::byte> global_data;
+  mpi_comm.all_gather(local_data.Data(), global_data);
+
+  // Deserialize all cells in ascending global-id order
+  const ByteArray raw(std::move(global_data));
+  std::map<uint64_t, std::unique_ptr<Cell>> global_cells;
+  std::map<uint64_t, Vector3> global_vertices;
+  size_t address = 0;
+  while (address < raw.Size())
+  {
+    auto cell = std::make_unique<Cell>(Cell::DeSerialize(raw, address));
+    for (const uint64_t vid : cell->vertex_ids_)
+      global_vertices[vid] = raw.Read<Vector3>(address, &address);
+    cell->local_id_ = 0;
+    global_cells[cell->global_id_] = std::move(cell);
+  }
+
+  // Cells sharing a vertex with a new local cell are ghosts
+  const auto location_id = static_cast<uint64_t>(opensn::mpi_comm.rank());
+  std::set<uint64_t> local_vertex_ids;
+  for (const auto& [global_id, cell] : global_cells)
+    if (cell->partition_id_ == location_id)
+      local_vertex_ids.insert(cell->vertex_ids_.begin(), cell->vertex_ids_.end());
+
+  auto new_grid = MeshContinuum::New();
+  for (auto& [global_id, cell] : global_cells)
+  {
+    const bool has_local_scope =
+      cell->partition_id_ == location_id or
+      std::any_of(cell->vertex_ids_.begin(),
+                  cell->vertex_ids_.end(),
+                  [&local_vertex_ids](uint64_t vid) { return local_vertex_ids.count(vid) > 0; });
+    if (not has_local_scope)
+      continue;
+
+    for (const uint64_t vid : cell->vertex_ids_)
+      new_grid->vertices.Insert(vid, global_vertices.at(vid));
+    new_grid->cells.push_back(std::move(cell));
+  }
+
+  new_grid->boundary_id_map_ = boundary_id_map_;
+  new_grid->SetAttributes(attributes,
+                          {ortho_attributes.Nx, ortho_attributes.Ny, ortho_attributes.Nz});
+  new_grid->SetGlobalVertexCount(global_vertex_count_);
+  if (HasPackedLocalCells())
+    new_grid->PackLocalCells();
+
+  return new_grid;
+}
+
 std::shared_ptr<MPICommunicatorSet>
 MeshContinuum::MakeMPILocalCommunicatorSet() const
 {
@@ -944,7 +1078,7 @@ MeshContinuum::CheckPointInsideCell(const Cell& cell, const Vector3& point) cons
 
     const double v0p_dot_v01 = v0p.Dot(v01);
 
-    if (not(v0p_dot_v01 >= 0 and v0p_dot_v01 < v01.Norm()))
+    if (not(v0p_dot_v01 >= 0 and v0p_dot_v01 < v01.NormSquare()))
       inside = false;
   } // slab
 
@@ -1015,6 +1149,144 @@ MeshContinuum::CheckPointInsideCell(const Cell& cell, const Vector3& point) cons
   return inside;
 }
 
+const VTUGeometry&
+MeshContinuum::GetVTUGeometry() const
+{
+  if (not vtu_geometry_ or vtu_geometry_->NumCells() != local_cells.size())
+    vtu_geometry_ = std::make_unique<VTUGeometry>(*this);
+
+  // Material ids may be changed at any time and are cheap to refresh
+  for (const auto& cell : local_cells)
+    vtu_geometry_->material_ids[cell.local_id_] = cell.material_id_;
+
+  return *vtu_geometry_;
+}
+
+const CellSpatialIndex&
+MeshContinuum::GetCellSpatialIndex() const
+{
+  if (not cell_spatial_index_ or cell_spatial_index_->NumCells() != local_cells.size())
+    cell_spatial_index_ = std::make_unique<CellSpatialIndex>(*this);
+  return *cell_spatial_index_;
+}
+
+size_t
+MeshContinuum::ComputeMemoryUsage() const
+{
+  auto CellMemoryUsage = [](const Cell& cell)
+  {
+    size_t bytes = VectorMemoryUsage(cell.vertex_ids_) + VectorMemoryUsage(cell.faces_);
+    for (const auto& face : cell.faces_)
+      bytes += VectorMemoryUsage(face.vertex_ids_);
+    return bytes;
+  };
+
+  // Packed local cells live in one buffer, otherwise each is allocated separately
+  size_t bytes = VectorMemoryUsage(local_cells_) + VectorMemoryUsage(packed_local_cells_);
+  for (const auto& cell : local_cells_)
+    bytes += CellMemoryUsage(*cell) + (HasPackedLocalCells() ? 0 : sizeof(Cell));
+
+  bytes += VectorMemoryUsage(ghost_cells_);
+  for (const auto& cell : ghost_cells_)
+    bytes += CellMemoryUsage(*cell) + sizeof(Cell);
+
+  bytes += vertices.ComputeMemoryUsage() + face_table_.ComputeMemoryUsage() +
+           MapMemoryUsage(global_cell_id_to_local_id_map_) +
+           MapMemoryUsage(global_cell_id_to_nonlocal_id_map_);
+
+  if (cell_spatial_index_)
+    bytes += cell_spatial_index_->ComputeMemoryUsage();
+  if (vtu_geometry_)
+  {
+    const auto& geometry = *vtu_geometry_;
+    bytes += VectorMemoryUsage(geometry.points) + VectorMemoryUsage(geometry.connectivity) +
+             VectorMemoryUsage(geometry.offsets) + VectorMemoryUsage(geometry.types) +
+             VectorMemoryUsage(geometry.faces) + VectorMemoryUsage(geometry.face_offsets) +
+             VectorMemoryUsage(geometry.material_ids) + VectorMemoryUsage(geometry.partition_ids) +
+             VectorMemoryUsage(geometry.cell_node_offsets);
+  }
+  return bytes;
+}
+
+std::vector<uint64_t>
+MeshContinuum::FindLocalCellsContainingPoint(const Vector3& point) const
+{
+  std::vector<uint64_t> candidates;
+  GetCellSpatialIndex().FindCandidateCells(point, candidates);
+
+  std::vector<uint64_t> local_ids;
+  for (const uint64_t local_id : candidates)
+    if (CheckPointInsideCell(local_cells[local_id], point))
+      local_ids.push_back(local_id);
+  return local_ids;
+}
+
+bool
+MeshContinuum::LocateLocalCellByNeighborWalk(const uint64_t start_local_id,
+                                             const Vector3& point,
+                                             uint64_t& local_id) const
+{
+  // Signed distance of the point to the surfaces bounding the cell. For
+  // polyhedra these are the triangles of the side tetrahedra used by
+  // CheckPointInsideCell, since faces need not be planar.
+  auto MaxSignedDistance = [this](const Cell& cell, const Vector3& point)
+  {
+    double max_distance = -std::numeric_limits<double>::max();
+    for (const auto& face : cell.faces_)
+    {
+      if (cell.Type() != CellType::POLYHEDRON)
+      {
+        max_distance = std::max(max_distance, (point - face.centroid_).Dot(face.normal_));
+        continue;
+      }
+      const size_t num_sides = face.vertex_ids_.size();
+      for (size_t s = 0; s < num_sides; ++s)
+      {
+        const auto& v0 = vertices[face.vertex_ids_[s]];
+        const auto& v1 = vertices[face.vertex_ids_[(s + 1) % num_sides]];
+        auto n = (v0 - face.centroid_).Cross(v1 - face.centroid_).Normalized();
+        if (n.Dot(face.normal_) < 0.0)
+          n = n * -1.0;
+        max_distance = std::max(max_distance, (point - face.centroid_).Dot(n));
+      }
+    }
+    return max_distance;
+  };
+
+  uint64_t current = start_local_id;
+  const size_t max_steps = local_cells.size();
+  for (size_t step = 0; step <= max_steps; ++step)
+  {
+    const auto& cell = local_cells[current];
+    if (CheckPointInsideCell(cell, point))
+    {
+      const double scale = (cell.faces_.front().centroid_ - cell.centroid_).Norm();
+      if (MaxSignedDistance(cell, point) > -1.0e-8 * scale)
+        return false;
+      local_id = current;
+      return true;
+    }
+
+    // Move through the face the point lies furthest beyond
+    const CellFace* exit_face = nullptr;
+    double max_distance = 0.0;
+    for (const auto& face : cell.faces_)
+    {
+      const double distance = (point - face.centroid_).Dot(face.normal_);
+      if (distance > max_distance)
+      {
+        max_distance = distance;
+        exit_face = &face;
+      }
+    }
+    if (exit_face == nullptr or not exit_face->has_neighbor_ or
+        not exit_face->IsNeighborLocal(*this))
+      return false;
+    current = exit_face->GetNeighborLocalID(*this);
+  }
+  return false;
+}
+
 std::array<size_t, 3>
 MeshContinuum::GetIJKInfo() const
 {
@@ -1204,6 +1476,9 @@ MeshContinuum::SetBoundaryIDFromLogical(const LogicalVolume& log_vol,
 
   if (global_num_faces_modified > 0 and grid_bndry_id_map.count(bndry_id) == 0)
     grid_bndry_id_map[bndry_id] = boundary_name;
+
+  if (not face_table_.Empty())
+    face_table_.Build(*this);
 }
 
 } // namespace opensn
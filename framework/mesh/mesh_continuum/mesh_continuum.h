@@ -7,6 +7,10 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum_local_cell_handler.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum_global_cell_handler.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum_vertex_handler.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum_face_table.h"
+#include "framework/mesh/mesh_continuum/cell_spatial_index.h"
+#include "framework/mesh/mesh_continuum/grid_vtu_writer.h"
+#include "framework/memory_usage.h"
 
 namespace opensn
 {
@@ -22,13 +26,18 @@ class MeshGenerator;
 class MeshContinuum
 {
 private:
-  std::vector<std::unique_ptr<Cell>> local_cells_; ///< Actual local cells
+  std::vector<LocalCellPtr> local_cells_;          ///< Actual local cells
   std::vector<std::unique_ptr<Cell>> ghost_cells_; ///< Locally stored ghosts
+  std::vector<Cell> packed_local_cells_;           ///< Contiguous local cell storage
+  CellFaceTable face_table_;                       ///< SoA face data of local cells
+  mutable std::unique_ptr<CellSpatialIndex> cell_spatial_index_; ///< Built on first use
+  mutable std::unique_ptr<VTUGeometry> vtu_geometry_;             ///< Built on first export
 
   std::map<uint64_t, uint64_t> global_cell_id_to_local_id_map_;
   std::map<uint64_t, uint64_t> global_cell_id_to_nonlocal_id_map_;
 
   uint64_t global_vertex_count_ = 0;
+  bool local_cells_renumbered_ = false;
 
 public:
   VertexHandler vertices;
@@ -55,8 +64,11 @@ public:
             global_cell_id_to_local_id_map_,
             global_cell_id_to_nonlocal_id_map_)
   {
+    RegisterMemoryConsumer(this, "mesh", [this] { return ComputeMemoryUsage(); });
   }
 
+  ~MeshContinuum() { UnregisterMemoryConsumers(this); }
+
   void SetGlobalVertexCount(const uint64_t count) { global_vertex_count_ = count; }
   uint64_t GetGlobalVertexCount() const { return global_vertex_count_; }
 
@@ -78,6 +90,10 @@ public:
   void ClearCellReferences()
   {
     local_cells_.clear();
+    packed_local_cells_.clear();
+    face_table_.Clear();
+    cell_spatial_index_.reset();
+    vtu_geometry_.reset();
     ghost_cells_.clear();
     global_cell_id_to_local_id_map_.clear();
     global_cell_id_to_nonlocal_id_map_.clear();
@@ -102,6 +118,13 @@ public:
                            bool suppress_node_sets = false,
                            bool suppress_side_sets = false) const;
 
+  /**
+   * Returns the local cells in the layout used for `.vtu` exports. The
+   * geometry is built on first use and reused by subsequent exports until the
+   * local cells change. Material ids are refreshed on every call.
+   */
+  const VTUGeometry& GetVTUGeometry() const;
+
   /**
    * Populates a face histogram.
    *
@@ -120,6 +143,50 @@ public:
   std::shared_ptr<GridFaceHistogram> MakeGridFaceHistogram(double master_tolerance = 100.0,
                                                            double slave_tolerance = 1.1) const;
 
+  /**
+   * Moves all local cells into a single contiguous array, in local-id order,
+   * and builds the structure-of-arrays face table. The existing `Cell`/`CellFace`
+   * interface remains valid; only the storage changes. Calling this again
+   * (e.g. after cells were added or reordered) repacks the cells.
+   */
+  void PackLocalCells();
+
+  /**
+   * Renumbers the local cells. `new_to_old[i]` is the current local-id of the
+   * cell that will have local-id `i`. Must be called before any spatial
+   * discretization is built on the grid. Packed cells are repacked in the new
+   * order.
+   */
+  void RenumberLocalCells(const std::vector<uint64_t>& new_to_old);
+
+  /**
+   * Returns true if the local cells have been renumbered, i.e., local-ids are
+   * no longer in the order of ascending global-ids.
+   */
+  bool LocalCellsRenumbered() const { return local_cells_renumbered_; }
+
+  /**
+   * Returns true if the local cells are stored contiguously.
+   */
+  bool HasPackedLocalCells() const { return not packed_local_cells_.empty(); }
+
+  /**
+   * Returns a copy of the grid with the cells moved to new partitions.
+   * `cell_partition_ids[i]` is the new partition of the local cell with
+   * local-id `i`. As in mesh generation, the ghost cells of each partition are
+   * the cells that share a vertex with its local cells and the local cells are
+   * numbered in ascending global-id order. Boundary names, attributes and
+   * packed storage carry over. This is a collective call.
+   */
+  std::shared_ptr<MeshContinuum>
+  MakeRepartitioned(const std::vector<int64_t>& cell_partition_ids) const;
+
+  /**
+   * Returns the structure-of-arrays face table of the local cells. The table
+   * is empty unless `PackLocalCells` has been called.
+   */
+  const CellFaceTable& GetFaceTable() const { return face_table_; }
+
   /**
    * Check whether a cell is local by attempting to find the key in
    * the native index map.
@@ -188,6 +255,39 @@ public:
    */
   bool CheckPointInsideCell(const Cell& cell, const Vector3& point) const;
 
+  /**
+   * Returns the spatial index of the local cells. The index is built on first
+   * use and rebuilt whenever the local cells have changed.
+   */
+  const CellSpatialIndex& GetCellSpatialIndex() const;
+
+  /**
+   * Returns the number of bytes allocated on this process for the cells,
+   * vertices, face table, id maps and cached lookup/export structures.
+   */
+  size_t ComputeMemoryUsage() const;
+
+  /**
+   * Returns the local-ids, in ascending order, of all local cells that contain
+   * the point according to `CheckPointInsideCell`. Only the cells returned by
+   * the spatial index are tested.
+   */
+  std::vector<uint64_t> FindLocalCellsContainingPoint(const Vector3& point) const;
+
+  /**
+   * Locates a point by walking from the local cell `start_local_id` through
+   * local face neighbors towards the point. This is cheap for a sequence of
+   * nearby points, e.g., points along a line, where each walk starts from the
+   * cell of the previous point. Returns true, with `local_id` set, only if the
+   * point lies strictly inside the cell found, i.e., it is the only cell that
+   * contains the point. Returns false if the point is on or near the boundary
+   * of that cell or if the walk leaves the local cells, in which case callers
+   * should use `FindLocalCellsContainingPoint`.
+   */
+  bool LocateLocalCellByNeighborWalk(uint64_t start_local_id,
+                                     const Vector3& point,
+                                     uint64_t& local_id) const;
+
   MeshAttributes Attributes() const { return attributes; }
 
   /**
@@ -0,0 +1,94 @@
+#include "framework/mesh/mesh_continuum/mesh_continuum_face_table.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/runtime.h"
+#include "framework/memory_usage.h"
+
+namespace opensn
+{
+
+void
+CellFaceTable::Build(const MeshContinuum& grid)
+{
+  Clear();
+
+  const size_t num_local_cells = grid.local_cells.size();
+
+  size_t num_faces = 0;
+  size_t num_face_vertices = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    num_faces += cell.faces_.size();
+    for (const auto& face : cell.faces_)
+      num_face_vertices += face.vertex_ids_.size();
+  }
+
+  face_offsets.reserve(num_local_cells + 1);
+  normals.reserve(num_faces);
+  centroids.reserve(num_faces);
+  areas.reserve(num_faces);
+  neighbor_ids.reserve(num_faces);
+  neighbor_local_ids.reserve(num_faces);
+  neighbor_partition_ids.reserve(num_faces);
+  has_neighbor.reserve(num_faces);
+  vertex_offsets.reserve(num_faces + 1);
+  vertex_ids.reserve(num_face_vertices);
+
+  const auto location_id = static_cast<uint64_t>(opensn::mpi_comm.rank());
+
+  face_offsets.push_back(0);
+  vertex_offsets.push_back(0);
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const auto& face : cell.faces_)
+    {
+      normals.push_back(face.normal_);
+      centroids.push_back(face.centroid_);
+      areas.push_back(face.ComputeFaceArea(grid));
+      neighbor_ids.push_back(face.neighbor_id_);
+      has_neighbor.push_back(face.has_neighbor_ ? 1 : 0);
+
+      uint64_t nbr_local_id = NOT_LOCAL;
+      int nbr_partition_id = -1;
+      if (face.has_neighbor_)
+      {
+        const auto& adj_cell = grid.cells[face.neighbor_id_];
+        nbr_partition_id = static_cast<int>(adj_cell.partition_id_);
+        if (adj_cell.partition_id_ == location_id)
+          nbr_local_id = adj_cell.local_id_;
+      }
+      neighbor_local_ids.push_back(nbr_local_id);
+      neighbor_partition_ids.push_back(nbr_partition_id);
+
+      vertex_ids.insert(vertex_ids.end(), face.vertex_ids_.begin(), face.vertex_ids_.end());
+      vertex_offsets.push_back(vertex_ids.size());
+    }
+    face_offsets.push_back(normals.size());
+  }
+}
+
+void
+CellFaceTable::Clear()
+{
+  face_offsets = {};
+  normals = {};
+  centroids = {};
+  areas = {};
+  neighbor_ids = {};
+  neighbor_local_ids = {};
+  neighbor_partition_ids = {};
+  has_neighbor = {};
+  vertex_offsets = {};
+  vertex_ids = {};
+}
+
+size_t
+CellFaceTable::ComputeMemoryUsage() const
+{
+  return VectorMemoryUsage(face_offsets) + VectorMemoryUsage(normals) +
+         VectorMemoryUsage(centroids) + VectorMemoryUsage(areas) +
+         VectorMemoryUsage(neighbor_ids) + VectorMemoryUsage(neighbor_local_ids) +
+         VectorMemoryUsage(neighbor_partition_ids) + VectorMemoryUsage(has_neighbor) +
+         VectorMemoryUsage(vertex_offsets) + VectorMemoryUsage(vertex_ids);
+}
+
+} // namespace opensn
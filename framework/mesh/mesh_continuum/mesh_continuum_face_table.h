@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#include "framework/mesh/mesh_vector.h"
+
+namespace opensn
+{
+class MeshContinuum;
+
+/**
+ * Structure-of-arrays copy of the face data of all local cells. Faces are stored
+ * in CSR-form, i.e., the faces of local cell `c` occupy the index range
+ * `[face_offsets[c], face_offsets[c+1])` in each of the per-face arrays. The
+ * table is a read-only companion to the `Cell`/`CellFace` objects and must be
+ * rebuilt whenever the underlying face data changes.
+ */
+class CellFaceTable
+{
+public:
+  /**Sentinel stored in `neighbor_local_ids` for non-local neighbors and boundaries.*/
+  static constexpr uint64_t NOT_LOCAL = static_cast<uint64_t>(-1);
+
+  std::vector<size_t> face_offsets;           ///< Size num_local_cells+1
+  std::vector<Vector3> normals;               ///< Face normals
+  std::vector<Vector3> centroids;             ///< Face centroids
+  std::vector<double> areas;                  ///< Face areas
+  std::vector<uint64_t> neighbor_ids;         ///< Neighbor global-id or boundary-id
+  std::vector<uint64_t> neighbor_local_ids;   ///< Neighbor local-id or NOT_LOCAL
+  std::vector<int> neighbor_partition_ids;    ///< Neighbor partition-id, -1 for boundaries
+  std::vector<unsigned char> has_neighbor;    ///< 1 if the face has a neighbor, 0 otherwise
+  std::vector<size_t> vertex_offsets;         ///< Size num_faces+1
+  std::vector<uint64_t> vertex_ids;           ///< Concatenated face vertex-ids
+
+  /**(Re)builds the table from the local cells of the grid.*/
+  void Build(const MeshContinuum& grid);
+
+  /**Releases all storage.*/
+  void Clear();
+
+  /**Returns the number of bytes allocated for the table.*/
+  size_t ComputeMemoryUsage() const;
+
+  /**Returns true if the table has not been built.*/
+  bool Empty() const { return face_offsets.empty(); }
+
+  /**Returns the number of local cells the table was built for.*/
+  size_t NumCells() const { return face_offsets.empty() ? 0 : face_offsets.size() - 1; }
+
+  /**Returns the total number of faces in the table.*/
+  size_t NumFaces() const { return normals.size(); }
+
+  /**Returns the number of faces of the given local cell.*/
+  size_t NumFaces(uint64_t cell_local_id) const
+  {
+    return face_offsets[cell_local_id + 1] - face_offsets[cell_local_id];
+  }
+
+  /**Maps a (local cell, face) pair to the flat face index.*/
+  size_t FaceIndex(uint64_t cell_local_id, unsigned int f) const
+  {
+    return face_offsets[cell_local_id] + f;
+  }
+
+  /**Returns true if the neighbor of the flat face index is a local cell.*/
+  bool IsNeighborLocal(size_t face_index) const
+  {
+    return neighbor_local_ids[face_index] != NOT_LOCAL;
+  }
+};
+
+} // namespace opensn
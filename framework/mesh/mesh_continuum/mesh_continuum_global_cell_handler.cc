@@ -13,7 +13,7 @@ GlobalCellHandler::push_back(std::unique_ptr<Cell> new_cell)
   {
     new_cell->local_id_ = local_cells_ref_.size();
 
-    local_cells_ref_.push_back(std::move(new_cell));
+    local_cells_ref_.push_back(LocalCellPtr(new_cell.release()));
 
     const auto& cell = local_cells_ref_.back();
 
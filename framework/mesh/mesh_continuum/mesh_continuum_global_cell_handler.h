@@ -1,6 +1,6 @@
 #pragma once
 
-#include "framework/mesh/cell/cell.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum_local_cell_handler.h"
 
 #include <map>
 
@@ -13,14 +13,14 @@ class GlobalCellHandler
   friend class MeshContinuum;
 
 private:
-  std::vector<std::unique_ptr<Cell>>& local_cells_ref_;
+  std::vector<LocalCellPtr>& local_cells_ref_;
   std::vector<std::unique_ptr<Cell>>& ghost_cells_ref_;
 
   std::map<uint64_t, uint64_t>& global_cell_id_to_native_id_map;
   std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map;
 
 private:
-  explicit GlobalCellHandler(std::vector<std::unique_ptr<Cell>>& native_cells,
+  explicit GlobalCellHandler(std::vector<LocalCellPtr>& native_cells,
                              std::vector<std::unique_ptr<Cell>>& foreign_cells,
                              std::map<uint64_t, uint64_t>& global_cell_id_to_native_id_map,
                              std::map<uint64_t, uint64_t>& global_cell_id_to_foreign_id_map)
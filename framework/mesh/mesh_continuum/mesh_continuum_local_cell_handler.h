@@ -2,20 +2,37 @@
 
 #include "framework/mesh/cell/cell.h"
 
+#include <memory>
+
 namespace opensn
 {
 
+/**Deleter for local cells. Cells that live in the packed storage of a
+ * MeshContinuum are not individually allocated and are therefore not deleted.*/
+struct LocalCellDeleter
+{
+  bool owned = true;
+
+  void operator()(Cell* cell) const
+  {
+    if (owned)
+      delete cell;
+  }
+};
+
+using LocalCellPtr = std::unique_ptr<Cell, LocalCellDeleter>;
+
 /**Stores references to global cells to enable an iterator.*/
 class LocalCellHandler
 {
   friend class MeshContinuum;
 
 public:
-  std::vector<std::unique_ptr<Cell>>& native_cells;
+  std::vector<LocalCellPtr>& native_cells;
 
 private:
   /**Constructor.*/
-  explicit LocalCellHandler(std::vector<std::unique_ptr<Cell>>& native_cells)
+  explicit LocalCellHandler(std::vector<LocalCellPtr>& native_cells)
     : native_cells(native_cells)
   {
   }
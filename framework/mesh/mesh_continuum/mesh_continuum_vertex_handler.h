@@ -1,6 +1,7 @@
 #pragma once
 
 #include "framework/mesh/mesh_vector.h"
+#include "framework/memory_usage.h"
 
 #include <map>
 
@@ -39,6 +40,8 @@ public:
 
   size_t NumLocallyStored() const { return m_global_id_vertex_map.size(); }
 
+  size_t ComputeMemoryUsage() const { return MapMemoryUsage(m_global_id_vertex_map); }
+
   void Clear() { m_global_id_vertex_map.clear(); }
 };
 
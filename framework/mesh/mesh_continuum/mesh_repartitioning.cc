@@ -0,0 +1,112 @@
+#include "framework/mesh/mesh_continuum/mesh_repartitioning.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/graphs/graph_partitioner.h"
+#include "framework/logging/log.h"
+#include "framework/logging/log_exceptions.h"
+#include "framework/runtime.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+namespace opensn
+{
+
+std::vector<int64_t>
+PartitionLocalCellsWeighted(const MeshContinuum& grid,
+                            const std::vector<double>& local_cell_weights,
+                            GraphPartitioner& partitioner)
+{
+  const size_t num_local_cells = grid.local_cells.size();
+  OpenSnInvalidArgumentIf(local_cell_weights.size() != num_local_cells,
+                          "Cell weight count " + std::to_string(local_cell_weights.size()) +
+                            " does not match the number of local cells " +
+                            std::to_string(num_local_cells) + ".");
+
+  // Flatten the local rows of the cell graph
+  std::vector<uint64_t> local_global_ids;
+  std::vector<uint64_t> local_num_neighbors;
+  std::vector<uint64_t> local_neighbors;
+  std::vector<double> local_centroids;
+  local_global_ids.reserve(num_local_cells);
+  local_num_neighbors.reserve(num_local_cells);
+  local_centroids.reserve(3 * num_local_cells);
+  for (const auto& cell : grid.local_cells)
+  {
+    uint64_t num_neighbors = 0;
+    for (const auto& face : cell.faces_)
+      if (face.has_neighbor_)
+      {
+        local_neighbors.push_back(face.neighbor_id_);
+        ++num_neighbors;
+      }
+
+    local_global_ids.push_back(cell.global_id_);
+    local_num_neighbors.push_back(num_neighbors);
+    local_centroids.insert(
+      local_centroids.end(), {cell.centroid_.x, cell.centroid_.y, cell.centroid_.z});
+  }
+
+  // Gather the graph. Rows are ordered by rank and then by local-id.
+  std::vector<uint64_t> global_ids;
+  std::vector<uint64_t> num_neighbors;
+  std::vector<uint64_t> neighbors;
+  std::vector<double> centroids;
+  std::vector<double> weights;
+  mpi_comm.all_gather(local_global_ids, global_ids);
+  mpi_comm.all_gather(local_num_neighbors, num_neighbors);
+  mpi_comm.all_gather(local_neighbors, neighbors);
+  mpi_comm.all_gather(local_centroids, centroids);
+  mpi_comm.all_gather(local_cell_weights, weights);
+
+  const int num_partitions = mpi_comm.size();
+  const size_t num_global_cells = global_ids.size();
+
+  std::vector<int64_t> cell_pids;
+  if (mpi_comm.rank() == 0)
+  {
+    std::map<uint64_t, uint64_t> global_id_to_row;
+    for (size_t c = 0; c < num_global_cells; ++c)
+      global_id_to_row[global_ids[c]] = c;
+
+    std::vector<std::vector<uint64_t>> cell_graph(num_global_cells);
+    std::vector<Vector3> cell_centroids;
+    cell_centroids.reserve(num_global_cells);
+    size_t offset = 0;
+    for (size_t c = 0; c < num_global_cells; ++c)
+    {
+      for (size_t n = 0; n < num_neighbors[c]; ++n)
+        cell_graph[c].push_back(global_id_to_row.at(neighbors[offset + n]));
+      offset += num_neighbors[c];
+
+      cell_centroids.emplace_back(centroids[3 * c], centroids[3 * c + 1], centroids[3 * c + 2]);
+    }
+
+    cell_pids = partitioner.PartitionWeighted(cell_graph, cell_centroids, weights, num_partitions);
+    OpenSnLogicalErrorIf(cell_pids.size() != num_global_cells,
+                         "The partitioner returned " + std::to_string(cell_pids.size()) +
+                           " partition ids for " + std::to_string(num_global_cells) + " cells.");
+
+    std::vector<double> partI_weight(num_partitions, 0.0);
+    for (size_t c = 0; c < num_global_cells; ++c)
+      partI_weight[cell_pids[c]] += weights[c];
+
+    const double max_weight = *std::max_element(partI_weight.begin(), partI_weight.end());
+    const double avg_weight =
+      std::accumulate(partI_weight.begin(), partI_weight.end(), 0.0) / num_partitions;
+    log.Log() << "Repartitioned weighted load imbalance (max/avg) = "
+              << (avg_weight > 0.0 ? max_weight / avg_weight : 1.0);
+  }
+
+  mpi_comm.broadcast(cell_pids, 0);
+
+  // Extract the rows of the local cells
+  std::vector<uint64_t> num_cells_per_rank;
+  mpi_comm.all_gather(static_cast<uint64_t>(num_local_cells), num_cells_per_rank);
+  const auto first_row = std::accumulate(
+    num_cells_per_rank.begin(), num_cells_per_rank.begin() + mpi_comm.rank(), uint64_t(0));
+
+  return {cell_pids.begin() + first_row, cell_pids.begin() + first_row + num_local_cells};
+}
+
+} // namespace opensn
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace opensn
+{
+class MeshContinuum;
+class GraphPartitioner;
+
+/**
+ * Repartitions the cells of a distributed grid according to an estimate of the
+ * work of each cell. `local_cell_weights` holds the weight of each local cell in
+ * local-id order. As in mesh generation, the cell graph, centroids and weights
+ * are gathered and partitioned on the root process. The result holds the new
+ * partition id of each local cell in local-id order and can be passed to
+ * `MeshContinuum::MakeRepartitioned`. This is a collective call.
+ */
+std::vector<int64_t> PartitionLocalCellsWeighted(const MeshContinuum& grid,
+                                                 const std::vector<double>& local_cell_weights,
+                                                 GraphPartitioner& partitioner);
+
+} // namespace opensn
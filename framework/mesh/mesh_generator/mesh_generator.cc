@@ -1,11 +1,13 @@
 #include "framework/mesh/mesh_generator/mesh_generator.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh_continuum/local_cell_ordering.h"
 #include "framework/graphs/graph_partitioner.h"
 #include "framework/graphs/petsc_graph_partitioner.h"
 #include "framework/object_factory.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/mesh/cell/cell.h"
+#include <numeric>
 
 namespace opensn
 {
@@ -36,13 +38,30 @@ MeshGenerator::GetInputParameters()
     false,
     "Flag, when set, makes the mesh appear in full fidelity on each process");
 
+  params.AddOptionalParameter(
+    "local_cell_ordering",
+    "none",
+    "Renumbering applied to the local cells of each partition after partitioning. "
+    "\"hilbert\" orders cells along a space-filling curve through the cell centroids and "
+    "\"rcm\" applies a Reverse Cuthill-McKee ordering to the local cell graph.");
+  params.ConstrainParameterRange("local_cell_ordering",
+                                 AllowableRangeList::New({"none", "hilbert", "rcm"}));
+
+  params.AddOptionalParameter(
+    "packed_cells",
+    false,
+    "Flag, when set, stores the local cells of the generated mesh contiguously and "
+    "builds a structure-of-arrays face table for them.");
+
   return params;
 }
 
 MeshGenerator::MeshGenerator(const InputParameters& params)
   : Object(params),
     scale_(params.GetParamValue<double>("scale")),
-    replicated_(params.GetParamValue<bool>("replicated_mesh"))
+    replicated_(params.GetParamValue<bool>("replicated_mesh")),
+    local_cell_ordering_(params.GetParamValue<std::string>("local_cell_ordering")),
+    packed_cells_(params.GetParamValue<bool>("packed_cells"))
 {
   // Convert input handles
   auto input_handles = params.GetParamVectorValue<size_t>("inputs");
@@ -153,14 +172,16 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh, int num_parti
 
   OpenSnLogicalErrorIf(num_raw_cells == 0, "No cells in final input mesh");
 
-  // Build cell graph and centroids
+  // Build cell graph, centroids and work estimates
   typedef std::vector<uint64_t> CellGraphNode;
   typedef std::vector<CellGraphNode> CellGraph;
   CellGraph cell_graph;
   std::vector<Vector3> cell_centroids;
+  std::vector<double> cell_weights;
 
   cell_graph.reserve(num_raw_cells);
   cell_centroids.reserve(num_raw_cells);
+  cell_weights.reserve(num_raw_cells);
   {
     for (const auto& raw_cell_ptr : raw_cells)
     {
@@ -171,19 +192,28 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh, int num_parti
 
       cell_graph.push_back(cell_graph_node);
       cell_centroids.push_back(raw_cell_ptr->centroid);
+      cell_weights.push_back(static_cast<double>(raw_cell_ptr->vertex_ids.size())); // <-- Note B
     }
   }
 
   // Note A: We do not add the diagonal here. If we do it, ParMETIS seems
   // to produce sub-optimal partitions
 
+  // Note B: The work per cell scales with the number of nodes, which for the
+  // piecewise-linear discretizations equals the number of vertices. Groups and
+  // angles are the same for all cells and therefore do not change the balance.
+
   // Execute partitioner
   std::vector<int64_t> cell_pids =
-    partitioner_->Partition(cell_graph, cell_centroids, num_partitions);
+    partitioner_->PartitionWeighted(cell_graph, cell_centroids, cell_weights, num_partitions);
 
   std::vector<size_t> partI_num_cells(num_partitions, 0);
-  for (int64_t pid : cell_pids)
-    partI_num_cells[pid] += 1;
+  std::vector<double> partI_weight(num_partitions, 0.0);
+  for (size_t c = 0; c < num_raw_cells; ++c)
+  {
+    partI_num_cells[cell_pids[c]] += 1;
+    partI_weight[cell_pids[c]] += cell_weights[c];
+  }
 
   size_t max_num_cells = partI_num_cells.front();
   size_t min_num_cells = partI_num_cells.front();
@@ -199,6 +229,11 @@ MeshGenerator::PartitionMesh(const UnpartitionedMesh& input_umesh, int num_parti
   log.Log() << "Partitioner num_cells allocated max,min,avg = " << max_num_cells << ","
             << min_num_cells << "," << avg_num_cells;
 
+  const double max_weight = *std::max_element(partI_weight.begin(), partI_weight.end());
+  const double avg_weight =
+    std::accumulate(partI_weight.begin(), partI_weight.end(), 0.0) / num_partitions;
+  log.Log() << "Partitioner weighted load imbalance (max/avg) = " << max_weight / avg_weight;
+
   return cell_pids;
 }
 
@@ -243,11 +278,41 @@ MeshGenerator::SetupMesh(std::unique_ptr<UnpartitionedMesh> input_umesh_ptr,
 
   grid_ptr->SetGlobalVertexCount(input_umesh_ptr->GetVertices().size());
 
+  PostProcessLocalCells(*grid_ptr);
+
   ComputeAndPrintStats(*grid_ptr);
 
   return grid_ptr;
 }
 
+void
+MeshGenerator::PostProcessLocalCells(MeshContinuum& grid) const
+{
+  if (local_cell_ordering_ != "none")
+  {
+    const uint64_t old_bandwidth = ComputeLocalCellGraphBandwidth(grid);
+
+    if (local_cell_ordering_ == "hilbert")
+      grid.RenumberLocalCells(MakeHilbertLocalCellOrdering(grid));
+    else if (local_cell_ordering_ == "rcm")
+      grid.RenumberLocalCells(MakeRCMLocalCellOrdering(grid));
+
+    const uint64_t new_bandwidth = ComputeLocalCellGraphBandwidth(grid);
+
+    uint64_t max_old_bandwidth = 0;
+    uint64_t max_new_bandwidth = 0;
+    mpi_comm.all_reduce(old_bandwidth, max_old_bandwidth, mpi::op::max<uint64_t>());
+    mpi_comm.all_reduce(new_bandwidth, max_new_bandwidth, mpi::op::max<uint64_t>());
+
+    log.Log() << "Local cells renumbered with \"" << local_cell_ordering_
+              << "\" ordering. Max local cell graph bandwidth " << max_old_bandwidth << " -> "
+              << max_new_bandwidth;
+  }
+
+  if (packed_cells_)
+    grid.PackLocalCells();
+}
+
 void
 MeshGenerator::BroadcastPIDs(std::vector<int64_t>& cell_pids,
                              int root,
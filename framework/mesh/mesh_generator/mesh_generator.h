@@ -98,6 +98,12 @@ protected:
                                          uint64_t partition_id,
                                          const VertexListHelper& vertices);
 
+  /**
+   * Applies the requested local cell renumbering and, if requested, packs
+   * the local cells into contiguous storage.
+   */
+  void PostProcessLocalCells(MeshContinuum& grid) const;
+
   static void SetGridAttributes(MeshContinuum& grid,
                                 MeshAttributes new_attribs,
                                 std::array<size_t, 3> ortho_cells_per_dimension);
@@ -106,6 +112,8 @@ protected:
 
   const double scale_;
   const bool replicated_;
+  const std::string local_cell_ordering_;
+  const bool packed_cells_;
   std::vector<MeshGenerator*> inputs_;
   GraphPartitioner* partitioner_ = nullptr;
 };
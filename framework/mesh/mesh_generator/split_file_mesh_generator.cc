@@ -100,6 +100,7 @@ SplitFileMeshGenerator::Execute()
     auto mesh_info = ReadSplitMesh();
 
     auto grid_ptr = SetupLocalMesh(mesh_info);
+    PostProcessLocalCells(*grid_ptr);
     mesh_stack.push_back(grid_ptr);
 
     log.Log() << "Done reading split-mesh files";
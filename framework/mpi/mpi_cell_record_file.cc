@@ -0,0 +1,503 @@
+#include "framework/mpi/mpi_cell_record_file.h"
+#include "framework/mpi/mpi_utils.h"
+#include "framework/logging/log.h"
+#include "framework/runtime.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <unordered_map>
+
+namespace opensn
+{
+
+namespace
+{
+
+/**"OSNCELLS" in ASCII.*/
+constexpr uint64_t CELL_RECORD_FILE_MAGIC = 0x534C4C45434E534FULL;
+constexpr uint64_t CELL_RECORD_FILE_VERSION = 1;
+
+/**Header layout: magic, version, num_records, num_values, num_metadata, metadata...*/
+constexpr size_t NUM_HEADER_FIELDS = 5;
+
+/**Each index entry is a {global_id, offset, size} triplet.*/
+constexpr size_t INDEX_ENTRY_SIZE = 3;
+
+constexpr uint64_t NOT_FOUND = std::numeric_limits<uint64_t>::max();
+
+/**Largest number of bytes moved by a single MPI-IO call (the count is an int).*/
+constexpr uint64_t MAX_IO_CHUNK = uint64_t(1) << 30;
+
+/**Collectively writes `num_bytes` bytes at `offset`. Large buffers are written
+ * in chunks; all processes execute the same number of collective calls.*/
+void
+WriteAtAll(MPI_File file,
+           MPI_Offset offset,
+           const void* data,
+           uint64_t num_bytes,
+           const mpi::Communicator& comm)
+{
+  const uint64_t local_num_chunks = (num_bytes + MAX_IO_CHUNK - 1) / MAX_IO_CHUNK;
+  uint64_t num_chunks = 0;
+  comm.all_reduce(local_num_chunks, num_chunks, mpi::op::max<uint64_t>());
+
+  const auto* bytes = static_cast<const char*>(data);
+  for (uint64_t k = 0; k < num_chunks; ++k)
+  {
+    const uint64_t begin = std::min(k * MAX_IO_CHUNK, num_bytes);
+    const uint64_t count = std::min(MAX_IO_CHUNK, num_bytes - begin);
+    MPI_File_write_at_all(file,
+                          offset + static_cast<MPI_Offset>(begin),
+                          bytes + begin,
+                          static_cast<int>(count),
+                          MPI_BYTE,
+                          MPI_STATUS_IGNORE);
+  }
+}
+
+/**Collective counterpart of WriteAtAll for reading.*/
+void
+ReadAtAll(MPI_File file,
+          MPI_Offset offset,
+          void* data,
+          uint64_t num_bytes,
+          const mpi::Communicator& comm)
+{
+  const uint64_t local_num_chunks = (num_bytes + MAX_IO_CHUNK - 1) / MAX_IO_CHUNK;
+  uint64_t num_chunks = 0;
+  comm.all_reduce(local_num_chunks, num_chunks, mpi::op::max<uint64_t>());
+
+  auto* bytes = static_cast<char*>(data);
+  for (uint64_t k = 0; k < num_chunks; ++k)
+  {
+    const uint64_t begin = std::min(k * MAX_IO_CHUNK, num_bytes);
+    const uint64_t count = std::min(MAX_IO_CHUNK, num_bytes - begin);
+    MPI_File_read_at_all(file,
+                         offset + static_cast<MPI_Offset>(begin),
+                         bytes + begin,
+                         static_cast<int>(count),
+                         MPI_BYTE,
+                         MPI_STATUS_IGNORE);
+  }
+}
+
+/**Header, local index entries and local file offsets of a cell record file.*/
+struct CellRecordFileLayout
+{
+  std::vector<uint64_t> header;
+  std::vector<uint64_t> index;
+  MPI_Offset index_offset = 0;
+  MPI_Offset values_offset = 0;
+  uint64_t num_records = 0;
+  uint64_t num_values = 0;
+};
+
+/**Computes the header, the local part of the index with offsets relative to
+ * the global values and the file offsets of the local index and values.*/
+CellRecordFileLayout
+MakeCellRecordFileLayout(const std::vector<uint64_t>& metadata,
+                         const CellRecords& records,
+                         const mpi::Communicator& comm)
+{
+  const int rank = comm.rank();
+  const int num_ranks = comm.size();
+
+  const auto record_extents = BuildLocationExtents(records.NumRecords(), comm);
+  const auto value_extents = BuildLocationExtents(records.values.size(), comm);
+
+  CellRecordFileLayout layout;
+  layout.num_records = record_extents[num_ranks];
+  layout.num_values = value_extents[num_ranks];
+
+  layout.header = {CELL_RECORD_FILE_MAGIC,
+                   CELL_RECORD_FILE_VERSION,
+                   layout.num_records,
+                   layout.num_values,
+                   static_cast<uint64_t>(metadata.size())};
+  layout.header.insert(layout.header.end(), metadata.begin(), metadata.end());
+
+  const auto index_start = static_cast<MPI_Offset>(layout.header.size() * sizeof(uint64_t));
+  const MPI_Offset values_start =
+    index_start +
+    static_cast<MPI_Offset>(layout.num_records * INDEX_ENTRY_SIZE * sizeof(uint64_t));
+
+  layout.index_offset =
+    index_start +
+    static_cast<MPI_Offset>(record_extents[rank] * INDEX_ENTRY_SIZE * sizeof(uint64_t));
+  layout.values_offset =
+    values_start + static_cast<MPI_Offset>(value_extents[rank] * sizeof(double));
+
+  layout.index.reserve(records.NumRecords() * INDEX_ENTRY_SIZE);
+  for (size_t r = 0; r < records.NumRecords(); ++r)
+  {
+    layout.index.push_back(records.global_ids[r]);
+    layout.index.push_back(value_extents[rank] + records.offsets[r]);
+    layout.index.push_back(records.RecordSize(r));
+  }
+
+  return layout;
+}
+
+/**Nonblocking counterpart of WriteAtAll. Appends the requests of all chunks.*/
+void
+IWriteAtAll(MPI_File file,
+            MPI_Offset offset,
+            const void* data,
+            uint64_t num_bytes,
+            const mpi::Communicator& comm,
+            std::vector<MPI_Request>& requests)
+{
+  const uint64_t local_num_chunks = (num_bytes + MAX_IO_CHUNK - 1) / MAX_IO_CHUNK;
+  uint64_t num_chunks = 0;
+  comm.all_reduce(local_num_chunks, num_chunks, mpi::op::max<uint64_t>());
+
+  const auto* bytes = static_cast<const char*>(data);
+  for (uint64_t k = 0; k < num_chunks; ++k)
+  {
+    const uint64_t begin = std::min(k * MAX_IO_CHUNK, num_bytes);
+    const uint64_t count = std::min(MAX_IO_CHUNK, num_bytes - begin);
+    requests.emplace_back();
+    MPI_File_iwrite_at_all(file,
+                           offset + static_cast<MPI_Offset>(begin),
+                           bytes + begin,
+                           static_cast<int>(count),
+                           MPI_BYTE,
+                           &requests.back());
+  }
+}
+
+/**The process holding the index entry of a global-id.*/
+int
+DirectoryRank(uint64_t global_id, const mpi::Communicator& comm)
+{
+  return static_cast<int>(global_id % static_cast<uint64_t>(comm.size()));
+}
+
+} // namespace
+
+void
+WriteCellRecordsCollective(const std::string& file_name,
+                           const std::vector<uint64_t>& metadata,
+                           const CellRecords& records,
+                           const mpi::Communicator& comm)
+{
+  const auto layout = MakeCellRecordFileLayout(metadata, records, comm);
+
+  MPI_File file;
+  const int error = MPI_File_open(
+    comm, file_name.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+  OpenSnLogicalErrorIf(error != MPI_SUCCESS, "Failed to open " + file_name + " for writing.");
+  MPI_File_set_size(file, 0);
+
+  if (comm.rank() == 0)
+    MPI_File_write_at(file,
+                      0,
+                      layout.header.data(),
+                      static_cast<int>(layout.header.size() * sizeof(uint64_t)),
+                      MPI_BYTE,
+                      MPI_STATUS_IGNORE);
+
+  WriteAtAll(file,
+             layout.index_offset,
+             layout.index.data(),
+             layout.index.size() * sizeof(uint64_t),
+             comm);
+
+  WriteAtAll(file,
+             layout.values_offset,
+             records.values.data(),
+             records.values.size() * sizeof(double),
+             comm);
+
+  MPI_File_close(&file);
+
+  log.Log0Verbose1() << "Wrote " << layout.num_records << " cell records (" << layout.num_values
+                     << " values) to " << file_name;
+}
+
+std::vector<uint64_t>
+ReadCellRecordsCollective(const std::string& file_name,
+                          const std::vector<uint64_t>& global_ids,
+                          CellRecords& records,
+                          const mpi::Communicator& comm)
+{
+  const int rank = comm.rank();
+  const int num_ranks = comm.size();
+
+  MPI_File file;
+  const int error =
+    MPI_File_open(comm, file_name.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+  OpenSnLogicalErrorIf(error != MPI_SUCCESS, "Failed to open " + file_name + " for reading.");
+
+  // Read the header on the root and broadcast it
+  std::vector<uint64_t> header(NUM_HEADER_FIELDS, 0);
+  if (rank == 0)
+    MPI_File_read_at(file,
+                     0,
+                     header.data(),
+                     static_cast<int>(NUM_HEADER_FIELDS * sizeof(uint64_t)),
+                     MPI_BYTE,
+                     MPI_STATUS_IGNORE);
+  comm.broadcast(header.data(), static_cast<int>(NUM_HEADER_FIELDS), 0);
+
+  OpenSnLogicalErrorIf(header[0] != CELL_RECORD_FILE_MAGIC,
+                       file_name + " is not a cell record file.");
+  OpenSnLogicalErrorIf(header[1] != CELL_RECORD_FILE_VERSION,
+                       "Unsupported cell record file version in " + file_name + ".");
+
+  const uint64_t num_records = header[2];
+  const uint64_t num_metadata = header[4];
+
+  std::vector<uint64_t> metadata(num_metadata, 0);
+  if (rank == 0 and num_metadata > 0)
+    MPI_File_read_at(file,
+                     static_cast<MPI_Offset>(NUM_HEADER_FIELDS * sizeof(uint64_t)),
+                     metadata.data(),
+                     static_cast<int>(num_metadata * sizeof(uint64_t)),
+                     MPI_BYTE,
+                     MPI_STATUS_IGNORE);
+  if (num_metadata > 0)
+    comm.broadcast(metadata.data(), static_cast<int>(num_metadata), 0);
+
+  const MPI_Offset index_start =
+    static_cast<MPI_Offset>((NUM_HEADER_FIELDS + num_metadata) * sizeof(uint64_t));
+  const MPI_Offset values_start =
+    index_start + static_cast<MPI_Offset>(num_records * INDEX_ENTRY_SIZE * sizeof(uint64_t));
+
+  // Each process reads an equal slice of the index and forwards the entries
+  // to the process owning the global-id in the distributed directory
+  const uint64_t slice_begin = num_records * rank / num_ranks;
+  const uint64_t slice_end = num_records * (rank + 1) / num_ranks;
+  std::vector<uint64_t> index_slice((slice_end - slice_begin) * INDEX_ENTRY_SIZE, 0);
+  ReadAtAll(file,
+            index_start +
+              static_cast<MPI_Offset>(slice_begin * INDEX_ENTRY_SIZE * sizeof(uint64_t)),
+            index_slice.data(),
+            index_slice.size() * sizeof(uint64_t),
+            comm);
+
+  std::map<int, std::vector<uint64_t>> directory_entries;
+  for (size_t e = 0; e < index_slice.size(); e += INDEX_ENTRY_SIZE)
+  {
+    auto& entries = directory_entries[DirectoryRank(index_slice[e], comm)];
+    entries.insert(entries.end(), &index_slice[e], &index_slice[e] + INDEX_ENTRY_SIZE);
+  }
+  index_slice = std::vector<uint64_t>();
+
+  std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> directory;
+  for (const auto& [pid, entries] : MapAllToAll(directory_entries, comm))
+    for (size_t e = 0; e < entries.size(); e += INDEX_ENTRY_SIZE)
+      directory.emplace(entries[e], std::make_pair(entries[e + 1], entries[e + 2]));
+  directory_entries.clear();
+
+  // Query the directory for the locations of the requested records
+  std::map<int, std::vector<uint64_t>> queries;
+  for (const uint64_t global_id : global_ids)
+    queries[DirectoryRank(global_id, comm)].push_back(global_id);
+
+  std::map<int, std::vector<uint64_t>> answers;
+  for (const auto& [pid, query_ids] : MapAllToAll(queries, comm))
+  {
+    auto& answer = answers[pid];
+    for (const uint64_t global_id : query_ids)
+    {
+      const auto it = directory.find(global_id);
+      answer.push_back(global_id);
+      answer.push_back(it == directory.end() ? NOT_FOUND : it->second.first);
+      answer.push_back(it == directory.end() ? 0 : it->second.second);
+    }
+  }
+
+  std::unordered_map<uint64_t, std::pair<uint64_t, uint64_t>> locations;
+  for (const auto& [pid, answer] : MapAllToAll(answers, comm))
+    for (size_t e = 0; e < answer.size(); e += INDEX_ENTRY_SIZE)
+      locations.emplace(answer[e], std::make_pair(answer[e + 1], answer[e + 2]));
+
+  // Size the records in the requested order
+  const size_t num_local_records = global_ids.size();
+  std::vector<uint64_t> file_offsets(num_local_records, 0);
+  records.global_ids = global_ids;
+  records.offsets.assign(1, 0);
+  bool all_found = true;
+  for (size_t r = 0; r < num_local_records; ++r)
+  {
+    const auto& [file_offset, size] = locations.at(global_ids[r]);
+    all_found = all_found and file_offset != NOT_FOUND;
+    file_offsets[r] = file_offset;
+    records.offsets.push_back(records.offsets.back() + size);
+  }
+  records.values.assign(records.offsets.back(), 0.0);
+
+  bool global_all_found = true;
+  comm.all_reduce(all_found, global_all_found, mpi::op::logical_and<bool>());
+  if (not global_all_found)
+  {
+    MPI_File_close(&file);
+    OpenSnLogicalError("One or more requested cells are not present in " + file_name + ".");
+  }
+
+  // Read all records with a single collective read. The file view must be
+  // monotonically non-decreasing, hence the records are visited in file order
+  // and scattered directly into place with a matching memory datatype.
+  std::vector<size_t> file_order(num_local_records);
+  std::iota(file_order.begin(), file_order.end(), 0);
+  std::sort(file_order.begin(),
+            file_order.end(),
+            [&file_offsets](size_t a, size_t b) { return file_offsets[a] < file_offsets[b]; });
+
+  std::vector<int> block_lengths;
+  std::vector<MPI_Aint> file_displacements;
+  std::vector<MPI_Aint> memory_displacements;
+  block_lengths.reserve(num_local_records);
+  file_displacements.reserve(num_local_records);
+  memory_displacements.reserve(num_local_records);
+  for (const size_t r : file_order)
+  {
+    if (records.RecordSize(r) == 0)
+      continue;
+    block_lengths.push_back(static_cast<int>(records.RecordSize(r)));
+    file_displacements.push_back(static_cast<MPI_Aint>(file_offsets[r] * sizeof(double)));
+    memory_displacements.push_back(static_cast<MPI_Aint>(records.offsets[r] * sizeof(double)));
+  }
+
+  MPI_Datatype file_type;
+  MPI_Datatype memory_type;
+  MPI_Type_create_hindexed(static_cast<int>(block_lengths.size()),
+                           block_lengths.data(),
+                           file_displacements.data(),
+                           MPI_DOUBLE,
+                           &file_type);
+  MPI_Type_create_hindexed(static_cast<int>(block_lengths.size()),
+                           block_lengths.data(),
+                           memory_displacements.data(),
+                           MPI_DOUBLE,
+                           &memory_type);
+  MPI_Type_commit(&file_type);
+  MPI_Type_commit(&memory_type);
+
+  char native[] = "native";
+  MPI_File_set_view(file, values_start, MPI_DOUBLE, file_type, native, MPI_INFO_NULL);
+  MPI_File_read_all(file, records.values.data(), 1, memory_type, MPI_STATUS_IGNORE);
+
+  MPI_Type_free(&file_type);
+  MPI_Type_free(&memory_type);
+  MPI_File_close(&file);
+
+  log.Log0Verbose1() << "Read cell records from " << file_name;
+
+  return metadata;
+}
+
+AsyncCellRecordWriter::AsyncCellRecordWriter(const mpi::Communicator& comm) : comm_(comm)
+{
+}
+
+void
+AsyncCellRecordWriter::Start(const std::string& file_name,
+                             std::vector<uint64_t> metadata,
+                             CellRecords&& records)
+{
+  Wait();
+
+  file_name_ = file_name;
+  records_ = std::move(records);
+  auto layout = MakeCellRecordFileLayout(metadata, records_, comm_);
+  header_ = std::move(layout.header);
+  index_ = std::move(layout.index);
+
+  const auto part_file_name = file_name_ + ".part";
+  const int error = MPI_File_open(
+    comm_, part_file_name.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file_);
+  OpenSnLogicalErrorIf(error != MPI_SUCCESS, "Failed to open " + part_file_name + " for writing.");
+  MPI_File_set_size(file_, 0);
+
+  requests_.clear();
+  if (comm_.rank() == 0)
+  {
+    requests_.emplace_back();
+    MPI_File_iwrite_at(file_,
+                       0,
+                       header_.data(),
+                       static_cast<int>(header_.size() * sizeof(uint64_t)),
+                       MPI_BYTE,
+                       &requests_.back());
+  }
+  IWriteAtAll(
+    file_, layout.index_offset, index_.data(), index_.size() * sizeof(uint64_t), comm_, requests_);
+  IWriteAtAll(file_,
+              layout.values_offset,
+              records_.values.data(),
+              records_.values.size() * sizeof(double),
+              comm_,
+              requests_);
+
+  in_flight_ = true;
+  log.Log0Verbose1() << "Started asynchronous write of " << layout.num_records
+                     << " cell records to " << file_name_;
+}
+
+bool
+AsyncCellRecordWriter::Progress()
+{
+  if (not in_flight_)
+    return true;
+
+  int completed = 0;
+  MPI_Testall(
+    static_cast<int>(requests_.size()), requests_.data(), &completed, MPI_STATUSES_IGNORE);
+  return completed != 0;
+}
+
+void
+AsyncCellRecordWriter::Wait()
+{
+  if (not in_flight_)
+    return;
+
+  MPI_Waitall(static_cast<int>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE);
+  MPI_File_close(&file_);
+
+  if (comm_.rank() == 0)
+  {
+    const auto part_file_name = file_name_ + ".part";
+    if (std::rename(part_file_name.c_str(), file_name_.c_str()) != 0)
+      log.Log0Warning() << "Failed to rename " << part_file_name << " to " << file_name_;
+  }
+
+  requests_.clear();
+  header_ = std::vector<uint64_t>();
+  index_ = std::vector<uint64_t>();
+  records_ = CellRecords();
+  in_flight_ = false;
+
+  log.Log0Verbose1() << "Completed asynchronous write of " << file_name_;
+}
+
+size_t
+AsyncCellRecordWriter::StagedBytes() const
+{
+  return records_.values.size() * sizeof(double) +
+         (records_.global_ids.size() + records_.offsets.size() + index_.size()) *
+           sizeof(uint64_t);
+}
+
+bool
+IsCellRecordFile(const std::string& file_name, const mpi::Communicator& comm)
+{
+  int is_cell_record_file = 0;
+  if (comm.rank() == 0)
+  {
+    std::ifstream file(file_name, std::ios::in | std::ios::binary);
+    uint64_t magic = 0;
+    if (file.is_open() and file.read((char*)&magic, sizeof(uint64_t)))
+      is_cell_record_file = magic == CELL_RECORD_FILE_MAGIC ? 1 : 0;
+  }
+  comm.broadcast(&is_cell_record_file, 1, 0);
+  return is_cell_record_file == 1;
+}
+
+} // namespace opensn
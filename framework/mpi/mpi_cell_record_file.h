@@ -0,0 +1,120 @@
+#pragma once
+
+#include "framework/runtime.h"
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace opensn
+{
+
+/**
+ * Variable-length, per-cell records of doubles stored contiguously. Record `r`
+ * belongs to the cell with global-id `global_ids[r]` and occupies the index
+ * range `[offsets[r], offsets[r+1])` of `values`.
+ */
+struct CellRecords
+{
+  std::vector<uint64_t> global_ids;
+  std::vector<uint64_t> offsets = {0};
+  std::vector<double> values;
+
+  /**Returns the number of records.*/
+  size_t NumRecords() const { return global_ids.size(); }
+
+  /**Closes the record for the given cell, i.e., all values appended to
+   * `values` since the previous record was closed belong to this cell.*/
+  void CloseRecord(uint64_t global_id)
+  {
+    global_ids.push_back(global_id);
+    offsets.push_back(values.size());
+  }
+
+  /**Returns a pointer to the first value of record `r`.*/
+  const double* RecordData(size_t r) const { return values.data() + offsets[r]; }
+
+  /**Returns the number of values in record `r`.*/
+  size_t RecordSize(size_t r) const { return offsets[r + 1] - offsets[r]; }
+};
+
+/**
+ * Collectively writes the records of all processes to a single shared file
+ * using MPI-IO. The file consists of a header containing the user metadata,
+ * an index of `{global_id, offset, size}` triplets and the concatenated record
+ * values. Each process writes its index and value ranges with one large
+ * collective write each. The file does not depend on the number of processes
+ * or the partitioning used to write it.
+ */
+void WriteCellRecordsCollective(const std::string& file_name,
+                                const std::vector<uint64_t>& metadata,
+                                const CellRecords& records,
+                                const mpi::Communicator& comm = opensn::mpi_comm);
+
+/**
+ * Collectively reads the records of the requested cells from a file written
+ * with `WriteCellRecordsCollective`. The number of processes and the
+ * partitioning may differ from those used to write the file. The index is
+ * distributed over the processes by hashing the global-ids so that no process
+ * has to hold the full index. The records are returned in the order of
+ * `global_ids`. Returns the user metadata stored in the file.
+ */
+std::vector<uint64_t> ReadCellRecordsCollective(const std::string& file_name,
+                                                const std::vector<uint64_t>& global_ids,
+                                                CellRecords& records,
+                                                const mpi::Communicator& comm = opensn::mpi_comm);
+
+/**
+ * Writes cell record files, in the format of `WriteCellRecordsCollective`,
+ * with nonblocking collective MPI-IO so that the write overlaps with
+ * subsequent computation. The records are moved into a staging buffer owned
+ * by the writer until the write completes and at most one write is in flight,
+ * which bounds the additional memory to a single staging buffer. The file is
+ * written under a temporary name and renamed once complete, so an interrupted
+ * write never replaces an existing file.
+ *
+ * Starting and finishing a write are collective. Progress is made whenever
+ * the MPI library is entered, e.g., during sweeps, and can be pushed
+ * explicitly with `Progress`. `Wait` must be called before MPI is finalized.
+ */
+class AsyncCellRecordWriter
+{
+public:
+  explicit AsyncCellRecordWriter(const mpi::Communicator& comm = opensn::mpi_comm);
+
+  AsyncCellRecordWriter(const AsyncCellRecordWriter&) = delete;
+  AsyncCellRecordWriter& operator=(const AsyncCellRecordWriter&) = delete;
+
+  /**Starts writing the records. A write still in flight is completed first.*/
+  void Start(const std::string& file_name, std::vector<uint64_t> metadata, CellRecords&& records);
+
+  /**Tests for completion of the write in flight without blocking. Returns true
+   * if no write is in flight or the local part of it has completed.*/
+  bool Progress();
+
+  /**Blocks until the write in flight, if any, has completed and closes the file.*/
+  void Wait();
+
+  /**Returns true if a write has been started but not yet waited for.*/
+  bool InFlight() const { return in_flight_; }
+
+  /**Returns the number of bytes held in the staging buffer.*/
+  size_t StagedBytes() const;
+
+private:
+  const mpi::Communicator& comm_;
+  bool in_flight_ = false;
+  std::string file_name_;
+  MPI_File file_;
+  std::vector<uint64_t> header_;
+  std::vector<uint64_t> index_;
+  CellRecords records_;
+  std::vector<MPI_Request> requests_;
+};
+
+/**Returns true, on all processes, if the file exists and was written with
+ * `WriteCellRecordsCollective`.*/
+bool IsCellRecordFile(const std::string& file_name,
+                      const mpi::Communicator& comm = opensn::mpi_comm);
+
+} // namespace opensn
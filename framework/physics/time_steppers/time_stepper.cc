@@ -79,6 +79,12 @@ TimeStepper::MaxTimeSteps() const
   return max_time_steps_;
 }
 
+double
+TimeStepper::MinimumTimeStepSize() const
+{
+  return dt_min_;
+}
+
 bool
 TimeStepper::IsActive() const
 {
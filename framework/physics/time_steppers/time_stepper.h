@@ -34,6 +34,9 @@ public:
   /**Returns the current controller max time steps.*/
   double MaxTimeSteps() const;
 
+  /**Returns the minimum time step size.*/
+  double MinimumTimeStepSize() const;
+
   /**If start_time <= time <= end_time, this will return true.*/
   bool IsActive() const;
 
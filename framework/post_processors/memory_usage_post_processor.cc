@@ -0,0 +1,64 @@
+#include "framework/post_processors/memory_usage_post_processor.h"
+
+#include "framework/object_factory.h"
+
+#include "framework/event_system/event.h"
+#include "framework/memory_usage.h"
+#include "framework/runtime.h"
+
+namespace opensn
+{
+
+OpenSnRegisterObject(MemoryUsagePostProcessor);
+
+InputParameters
+MemoryUsagePostProcessor::GetInputParameters()
+{
+  InputParameters params = PostProcessor::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "A post processor reporting, in megabytes, the maximum over all processes of "
+    "the memory held by a subsystem, e.g., \"mesh\", \"psi\" or \"fluds\". The "
+    "subsystem \"total\" is the sum over all registered subsystems and \"process\" "
+    "is the resident memory of the process. Subsystems for which no consumer is "
+    "registered when the post processor executes are rejected.");
+  params.SetDocGroup("doc_PostProcessors");
+
+  params.AddOptionalParameter("subsystem", "total", "The subsystem to report.");
+
+  return params;
+}
+
+MemoryUsagePostProcessor::MemoryUsagePostProcessor(const InputParameters& params)
+  : PostProcessor(params, PPType::SCALAR),
+    subsystem_(params.GetParamValue<std::string>("subsystem"))
+{
+}
+
+void
+MemoryUsagePostProcessor::Execute(const Event& event_context)
+{
+  double mbytes = 0.0;
+  if (subsystem_ == "process")
+    mpi_comm.all_reduce(GetMemoryUsageInMB(), mbytes, mpi::op::max<double>());
+  else
+    mbytes = CSTMemory(LookupSubsystemMemoryUsage(GetMaxSubsystemMemoryUsage(), subsystem_))
+               .memory_mbytes;
+  value_ = ParameterBlock("", mbytes);
+
+  const int event_code = event_context.Code();
+  if (event_code == Event::SolverInitialized or event_code == Event::SolverAdvanced)
+  {
+    const auto& event_params = event_context.Parameters();
+
+    if (event_params.Has("timestep_index") and event_params.Has("time"))
+    {
+      const size_t index = event_params.GetParamValue<size_t>("timestep_index");
+      const double time = event_params.GetParamValue<double>("time");
+      TimeHistoryEntry entry{index, time, value_};
+      time_history_.push_back(std::move(entry));
+    }
+  }
+}
+
+} // namespace opensn
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "framework/post_processors/post_processor.h"
+
+namespace opensn
+{
+
+/**Reports the memory held by a registered subsystem, maximized over processes.*/
+class MemoryUsagePostProcessor : public PostProcessor
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit MemoryUsagePostProcessor(const InputParameters& params);
+
+  void Execute(const Event& event_context) override;
+
+private:
+  const std::string subsystem_;
+};
+
+} // namespace opensn
@@ -18,6 +18,8 @@ int GetFieldFunctionHandleByName(lua_State* L);
  *
  * \param FFHandle int Global handle to the field function.
  * \param BaseName char Base name for the exported file.
+ * \param CellAveragesOnly bool Optional. If true, only cell averages are
+ *        written. Default: false.
  *
  * \ingroup LuaFieldFunc
  * \author Jan
@@ -28,6 +30,8 @@ int ExportFieldFunctionToVTK(lua_State* L);
  *
  * \param listFFHandles table Global handles or names to the field functions
  * \param BaseName char Base name for the exported file.
+ * \param CellAveragesOnly bool Optional. If true, only cell averages are
+ *        written. Default: false.
  *
  * \ingroup LuaFieldFunc
  * \author Jan
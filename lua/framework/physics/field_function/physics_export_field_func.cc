@@ -15,11 +15,12 @@ ExportFieldFunctionToVTK(lua_State* L)
 {
   const std::string fname = "ExportFieldFunctionToVTK";
   const int num_args = lua_gettop(L);
-  if (num_args != 2)
+  if (num_args != 2 and num_args != 3)
     LuaPostArgAmountError(fname, 2, num_args);
 
   int ff_handle = lua_tonumber(L, 1);
   const char* base_name = lua_tostring(L, 2);
+  const bool cell_averages_only = num_args == 3 and lua_toboolean(L, 3);
 
   auto ff_base = opensn::GetStackItemPtr(opensn::field_function_stack, ff_handle, fname);
   auto ff = std::dynamic_pointer_cast<FieldFunctionGridBased>(ff_base);
@@ -27,7 +28,7 @@ ExportFieldFunctionToVTK(lua_State* L)
   OpenSnLogicalErrorIf(not ff, "Only grid-based field functions can be exported");
 
   //  ff->ExportToVTK(base_name);
-  FieldFunctionGridBased::ExportMultipleToVTK(base_name, {ff});
+  FieldFunctionGridBased::ExportMultipleToVTK(base_name, {ff}, cell_averages_only);
 
   return 0;
 }
@@ -37,10 +38,11 @@ ExportMultiFieldFunctionToVTK(lua_State* L)
 {
   const std::string fname = "ExportMultiFieldFunctionToVTK";
   const int num_args = lua_gettop(L);
-  if (num_args != 2)
+  if (num_args != 2 and num_args != 3)
     LuaPostArgAmountError(fname, 2, num_args);
 
   const char* base_name = lua_tostring(L, 2);
+  const bool cell_averages_only = num_args == 3 and lua_toboolean(L, 3);
 
   LuaCheckTableValue(fname, L, 1);
 
@@ -88,7 +90,7 @@ ExportMultiFieldFunctionToVTK(lua_State* L)
     ffs.push_back(ff);
   } // for i
 
-  FieldFunctionGridBased::ExportMultipleToVTK(base_name, ffs);
+  FieldFunctionGridBased::ExportMultipleToVTK(base_name, ffs, cell_averages_only);
 
   return 0;
 }
@@ -0,0 +1,79 @@
+#include "framework/console/console.h"
+
+#include "framework/lua.h"
+
+#include "framework/memory_usage.h"
+#include "framework/runtime.h"
+
+namespace opensnlua
+{
+
+/**Returns a table mapping each registered subsystem, e.g., "psi" or "fluds",
+ * to the memory it holds in megabytes. The entry "process" holds the resident
+ * memory of the process.
+ * \param max_over_ranks bool Optional. If true, all values are the maximum over
+ *                       all processes and the entry "total" holds the maximum
+ *                       of the sum over subsystems. This is then a collective
+ *                       call. Default: false.
+ * \param subsystem string Optional. If given, only the value of this
+ *                  subsystem is returned. Subsystems without a registered
+ *                  memory consumer are rejected.
+ * */
+int GetSubsystemMemoryUsage(lua_State* L);
+
+RegisterLuaFunctionAsIs(GetSubsystemMemoryUsage);
+
+int
+GetSubsystemMemoryUsage(lua_State* L)
+{
+  const std::string fname = __FUNCTION__;
+  const int num_args = lua_gettop(L);
+  if (num_args > 2)
+    LuaPostArgAmountError(fname, 2, num_args);
+
+  bool max_over_ranks = false;
+  if (num_args >= 1)
+  {
+    LuaCheckBoolValue(fname, L, 1);
+    max_over_ranks = lua_toboolean(L, 1);
+  }
+  if (num_args == 2)
+    LuaCheckStringValue(fname, L, 2);
+
+  double process_memory = opensn::GetMemoryUsageInMB();
+  std::map<std::string, double> usage;
+  if (max_over_ranks)
+  {
+    usage = opensn::GetMaxSubsystemMemoryUsage();
+    opensn::mpi_comm.all_reduce(
+      opensn::GetMemoryUsageInMB(), process_memory, mpi::op::max<double>());
+  }
+  else
+    usage = opensn::GetSubsystemMemoryUsage();
+
+  if (num_args == 2)
+  {
+    const std::string subsystem = lua_tostring(L, 2);
+    if (subsystem == "process")
+      lua_pushnumber(L, process_memory);
+    else
+      lua_pushnumber(
+        L, opensn::CSTMemory(opensn::LookupSubsystemMemoryUsage(usage, subsystem)).memory_mbytes);
+    return 1;
+  }
+
+  lua_newtable(L);
+  for (const auto& [subsystem, bytes] : usage)
+  {
+    lua_pushstring(L, subsystem.c_str());
+    lua_pushnumber(L, opensn::CSTMemory(bytes).memory_mbytes);
+    lua_settable(L, -3);
+  }
+  lua_pushstring(L, "process");
+  lua_pushnumber(L, process_memory);
+  lua_settable(L, -3);
+
+  return 1;
+}
+
+} // namespace opensnlua
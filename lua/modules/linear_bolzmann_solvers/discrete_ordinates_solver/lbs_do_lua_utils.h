@@ -45,4 +45,26 @@ int LBSComputeLeakage(lua_State* L);
  */
 int ComputeLeakage(lua_State* L);
 
+/**
+ * Repartitions the grid of a discrete ordinates solver if its sweeps are
+ * imbalanced, moving the solution along with the cells. The measured time of
+ * each process is spread over its cells in proportion to their number of
+ * nodes and the cells are repartitioned with these weights. Meant to be called
+ * between steady-state solves. Solvers used by transient or k-eigenvalue
+ * executors cannot be rebalanced.
+ *
+ * \param SolverIndex int Handle to the solver.
+ * \param ImbalanceThreshold double Optional. The solver is only rebalanced if
+ *      the maximum over the average sweep time of the processes exceeds this
+ *      value. Default 1.1.
+ * \param PartitionerHandle int Optional. Handle to a GraphPartitioner that
+ *      honors cell weights. Defaults to a SweepGraphPartitioner.
+ *
+ * \return True if the solver was rebalanced, and the number of cells that moved
+ *         to another process.
+ *
+ * \ingroup LBSLuaFunctions
+ */
+int RebalanceLoad(lua_State* L);
+
 } // namespace opensnlua::lbs
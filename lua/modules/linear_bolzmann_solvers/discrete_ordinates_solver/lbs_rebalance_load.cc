@@ -0,0 +1,60 @@
+#include "lbs_do_lua_utils.h"
+
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+
+#include "framework/graphs/sweep_graph_partitioner.h"
+#include "framework/console/console.h"
+#include "framework/runtime.h"
+
+namespace opensnlua::lbs
+{
+
+RegisterLuaFunctionNamespace(RebalanceLoad, lbs, RebalanceLoad);
+
+int
+RebalanceLoad(lua_State* L)
+{
+  const auto fname = "lbs.RebalanceLoad";
+  const auto num_args = lua_gettop(L);
+
+  if (num_args < 1 or num_args > 3)
+    LuaPostArgAmountError(fname, 1, num_args);
+
+  // Get the solver
+  LuaCheckNilValue(fname, L, 1);
+  const auto solver_handle = lua_tointeger(L, 1);
+  auto& solver = opensn::GetStackItem<opensn::lbs::DiscreteOrdinatesSolver>(
+    opensn::object_stack, solver_handle, fname);
+
+  double imbalance_threshold = 1.1;
+  if (num_args > 1)
+  {
+    LuaCheckNumberValue(fname, L, 2);
+    imbalance_threshold = lua_tonumber(L, 2);
+  }
+
+  // Use the given partitioner
+  if (num_args > 2)
+  {
+    LuaCheckIntegerValue(fname, L, 3);
+    const auto partitioner_handle = lua_tointeger(L, 3);
+    auto& partitioner = opensn::GetStackItem<opensn::GraphPartitioner>(
+      opensn::object_stack, partitioner_handle, fname);
+    size_t num_migrated_cells = 0;
+    lua_pushboolean(L, solver.RebalanceLoad(partitioner, imbalance_threshold, &num_migrated_cells));
+    lua_pushinteger(L, static_cast<lua_Integer>(num_migrated_cells));
+    return 2;
+  }
+
+  // Otherwise use a local SweepGraphPartitioner, which honors cell weights
+  auto params = opensn::SweepGraphPartitioner::GetInputParameters();
+  params.AssignParameters(opensn::ParameterBlock());
+  opensn::SweepGraphPartitioner partitioner(params);
+
+  size_t num_migrated_cells = 0;
+  lua_pushboolean(L, solver.RebalanceLoad(partitioner, imbalance_threshold, &num_migrated_cells));
+  lua_pushinteger(L, static_cast<lua_Integer>(num_migrated_cells));
+  return 2;
+}
+
+} // namespace opensnlua::lbs
@@ -631,6 +631,22 @@ int LBSWriteGroupsetAngularFlux(lua_State* L);
  */
 int LBSReadGroupsetAngularFlux(lua_State* L);
 
+/**Writes the angular fluxes of all groupsets of a LBS solver to file, in the
+ * format read by the `angular_fluxes` file prefix of response evaluator buffers.
+ *
+ * \param SolverIndex int Handle to the solver.
+ *
+ * \param file_base string Path+Filename_base to use for the output. Each location
+ *                         will append its id to the back plus an extension ".data"
+ *
+ * \param shared_file_flag bool (Optional) Flag indicating that all locations
+ *                              collectively write a single, smaller file shared
+ *                              by all locations, named file_base plus ".data".
+ *                              Default: false.
+ *
+ */
+int LBSWriteAngularFluxes(lua_State* L);
+
 /**Writes the flux-moments of a LBS solution to file (phi_old_local).
  *
  * \param SolverIndex int Handle to the solver for which the group
@@ -639,6 +655,14 @@ int LBSReadGroupsetAngularFlux(lua_State* L);
  * \param file_base string Path+Filename_base to use for the output. Each location
  *                         will append its id to the back plus an extension ".data"
  *
+ * \param shared_file_flag bool (Optional) Flag indicating that all locations
+ *                              collectively write a single file shared by all
+ *                              locations. The file_base will then be used without
+ *                              adding the location-id, but still with the ".data"
+ *                              appended. Shared files are detected automatically
+ *                              when reading and can be read with a different
+ *                              number of locations. Default: false.
+ *
  */
 int LBSWriteFluxMoments(lua_State* L);
 
@@ -5,6 +5,8 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "framework/lua.h"
 
+#include <utility>
+
 using namespace opensn;
 
 namespace opensnlua::lbs
@@ -44,8 +46,8 @@ LBSWriteGroupsetAngularFlux(lua_State* L)
     opensn::Exit(EXIT_FAILURE);
   }
 
-  const auto& psi = lbs_solver.PsiNewLocal().at(groupset->id_);
-  lbs_solver.WriteGroupsetAngularFluxes(*groupset, psi, file_base);
+  const auto psi = std::as_const(lbs_solver).ScopedPsiNewLocal(groupset->id_);
+  lbs_solver.WriteGroupsetAngularFluxes(*groupset, *psi, file_base);
 
   return 0;
 }
@@ -84,8 +86,46 @@ LBSReadGroupsetAngularFlux(lua_State* L)
     opensn::Exit(EXIT_FAILURE);
   }
 
-  auto& psi = lbs_solver.PsiNewLocal().at(groupset->id_);
-  lbs_solver.ReadGroupsetAngularFluxes(file_base, *groupset, psi);
+  auto psi = lbs_solver.ScopedPsiNewLocal(groupset->id_);
+  lbs_solver.ReadGroupsetAngularFluxes(file_base, *groupset, *psi);
+
+  return 0;
+}
+
+int
+LBSWriteAngularFluxes(lua_State* L)
+{
+  const std::string fname = "LBSWriteAngularFluxes";
+  // Get arguments
+  const int num_args = lua_gettop(L);
+  if ((num_args != 2) and (num_args != 3))
+    LuaPostArgAmountError(fname, 2, num_args);
+
+  LuaCheckNilValue(fname, L, 1);
+  LuaCheckNilValue(fname, L, 2);
+
+  const int solver_handle = lua_tonumber(L, 1);
+  const std::string file_base = lua_tostring(L, 2);
+
+  bool shared_file_flag = false;
+  if (num_args == 3)
+  {
+    LuaCheckBoolValue(fname, L, 3);
+    shared_file_flag = lua_toboolean(L, 3);
+  }
+
+  // Get pointer to solver
+  const auto& lbs_solver =
+    opensn::GetStackItem<opensn::lbs::LBSSolver>(opensn::object_stack, solver_handle, fname);
+
+  // Gather dense copies of all groupsets, which may be stored compressed
+  std::vector<std::vector<double>> psi;
+  for (const auto& groupset : lbs_solver.Groupsets())
+    psi.push_back(*lbs_solver.ScopedPsiNewLocal(groupset.id_));
+  if (shared_file_flag)
+    lbs_solver.WriteAngularFluxesCollective(psi, file_base + ".data");
+  else
+    lbs_solver.WriteAngularFluxes(psi, file_base);
 
   return 0;
 }
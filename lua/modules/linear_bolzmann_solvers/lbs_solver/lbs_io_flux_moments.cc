@@ -15,7 +15,7 @@ LBSWriteFluxMoments(lua_State* L)
   const std::string fname = "LBSWriteFluxMoments";
   // Get arguments
   const int num_args = lua_gettop(L);
-  if (num_args != 2)
+  if ((num_args != 2) and (num_args != 3))
     LuaPostArgAmountError(fname, 2, num_args);
 
   LuaCheckNilValue(fname, L, 1);
@@ -24,11 +24,21 @@ LBSWriteFluxMoments(lua_State* L)
   const int solver_handle = lua_tonumber(L, 1);
   const std::string file_base = lua_tostring(L, 2);
 
+  bool shared_file_flag = false;
+  if (num_args == 3)
+  {
+    LuaCheckBoolValue(fname, L, 3);
+    shared_file_flag = lua_toboolean(L, 3);
+  }
+
   // Get pointer to solver
   auto& lbs_solver =
     opensn::GetStackItem<opensn::lbs::LBSSolver>(opensn::object_stack, solver_handle, fname);
 
-  lbs_solver.WriteFluxMoments(lbs_solver.PhiOldLocal(), file_base);
+  if (shared_file_flag)
+    lbs_solver.WriteFluxMomentsCollective(lbs_solver.PhiOldLocal(), file_base + ".data");
+  else
+    lbs_solver.WriteFluxMoments(lbs_solver.PhiOldLocal(), file_base);
 
   return 0;
 }
@@ -85,6 +85,7 @@ RegisterLuaEntities(lua_State* L)
 
   RegisterFunction(LBSWriteGroupsetAngularFlux);
   RegisterFunction(LBSReadGroupsetAngularFlux);
+  RegisterFunction(LBSWriteAngularFluxes);
 
   RegisterFunction(LBSWriteFluxMoments);
   RegisterFunction(LBSCreateAndWriteSourceMoments);
@@ -127,4 +127,58 @@ EvaluateResponse(lua_State* L)
   return 1;
 }
 
+RegisterLuaFunctionNamespace(EvaluateResponses, lbs, EvaluateResponses);
+
+int
+EvaluateResponses(lua_State* L)
+{
+  const auto num_args = lua_gettop(L);
+  if (num_args != 3)
+    LuaPostArgAmountError(__FUNCTION__, 3, num_args);
+
+  LuaCheckIntegerValue(__FUNCTION__, L, 1);
+  LuaCheckTableValue(__FUNCTION__, L, 2);
+  LuaCheckTableValue(__FUNCTION__, L, 3);
+
+  // Get the response evaluator
+  const auto handle = lua_tointeger(L, 1);
+  auto& response_evaluator =
+    GetStackItem<opensn::lbs::ResponseEvaluator>(object_stack, handle, __FUNCTION__);
+
+  // Get the buffer names
+  const auto buffer_params = TableParserAsParameterBlock::ParseTable(L, 2);
+  buffer_params.RequireBlockTypeIs(ParameterBlockType::ARRAY);
+  std::vector<std::string> buffers;
+  for (size_t p = 0; p < buffer_params.NumParameters(); ++p)
+    buffers.push_back(buffer_params.GetParam(p).GetValue<std::string>());
+
+  // Get the source sets
+  const auto source_params = TableParserAsParameterBlock::ParseTable(L, 3);
+  source_params.RequireBlockTypeIs(ParameterBlockType::ARRAY);
+  std::vector<opensn::lbs::ResponseEvaluator::SourceSet> source_sets;
+  for (size_t p = 0; p < source_params.NumParameters(); ++p)
+  {
+    auto spec = opensn::lbs::ResponseEvaluator::SourceOptionsBlock();
+    spec.AssignParameters(source_params.GetParam(p));
+    source_sets.push_back(response_evaluator.MakeSourceSet(spec));
+  }
+
+  // Compute the responses
+  const auto responses = response_evaluator.EvaluateResponses(buffers, source_sets);
+  lua_newtable(L);
+  for (size_t s = 0; s < responses.size(); ++s)
+  {
+    lua_pushinteger(L, static_cast<lua_Integer>(s + 1));
+    lua_newtable(L);
+    for (size_t b = 0; b < buffers.size(); ++b)
+    {
+      lua_pushstring(L, buffers[b].c_str());
+      lua_pushnumber(L, static_cast<lua_Number>(responses[s][b]));
+      lua_settable(L, -3);
+    }
+    lua_settable(L, -3);
+  }
+  return 1;
+}
+
 } // namespace opensnlua::lbs
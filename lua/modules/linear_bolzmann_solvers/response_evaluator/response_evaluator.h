@@ -28,4 +28,16 @@ ParameterBlock AddResponseSources(const InputParameters& params);
 
 int EvaluateResponse(lua_State* L);
 
+/**
+ * Evaluates the responses of several forward source configurations with several
+ * adjoint buffers in one pass.
+ *
+ * \param ResponseEvaluatorIndex A handle to a response evaluator
+ * \param BufferNames An array of adjoint buffer names
+ * \param Sources An array of tables with the syntax of <TT>SourceOptionsBlock</TT>
+ *
+ * \return A table indexed by source configuration and then by buffer name.
+ */
+int EvaluateResponses(lua_State* L);
+
 } // namespace opensnlua::lbs
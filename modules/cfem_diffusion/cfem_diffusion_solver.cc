@@ -7,6 +7,7 @@
 #include "modules/cfem_diffusion/cfem_diffusion_bndry.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_continuous.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
 
 namespace opensn
 {
@@ -147,16 +148,10 @@ Solver::Initialize()
   const auto n = static_cast<int64_t>(num_local_dofs_);
   const auto N = static_cast<int64_t>(num_globl_dofs_);
 
-  A_ = CreateSquareMatrix(n, N);
+  A_ = CreatePreallocatedSquareMatrix(sdm, OneDofPerNode);
   x_ = CreateVector(n, N);
   b_ = CreateVector(n, N);
 
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
-
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
-
   if (field_functions_.empty())
   {
     std::string solver_name;
@@ -183,6 +178,8 @@ Solver::Execute()
 
   // Assemble the system
   log.Log() << "Assembling system: ";
+  MatrixAssembler assembler(A_);
+  assembler.Begin();
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
@@ -294,12 +291,14 @@ Solver::Execute()
     for (size_t i = 0; i < num_nodes; ++i)
       imap[i] = sdm.MapDOF(cell, i);
 
-    // Assembly into system
+    // Assembly into system. Dirichlet rows and columns are replaced by the
+    // identity; zero entries are ignored by the matrix.
     for (size_t i = 0; i < num_nodes; ++i)
     {
       if (dirichlet_count[i] > 0) // if Dirichlet boundary node
       {
-        MatSetValue(A_, imap[i], imap[i], 1.0, ADD_VALUES);
+        for (size_t j = 0; j < num_nodes; ++j)
+          Acell[i][j] = (j == i) ? 1.0 : 0.0;
         // because we use CFEM, a given node is common to several faces
         const double aux = dirichlet_value[i] / dirichlet_count[i];
         VecSetValue(b_, imap[i], aux, ADD_VALUES);
@@ -308,23 +307,22 @@ Solver::Execute()
       {
         for (size_t j = 0; j < num_nodes; ++j)
         {
-          if (dirichlet_count[j] == 0) // not related to a dirichlet node
-            MatSetValue(A_, imap[i], imap[j], Acell[i][j], ADD_VALUES);
-          else
+          if (dirichlet_count[j] > 0) // related to a dirichlet node
           {
             const double aux = dirichlet_value[j] / dirichlet_count[j];
             cell_rhs[i] -= Acell[i][j] * aux;
+            Acell[i][j] = 0.0;
           }
         } // for j
         VecSetValue(b_, imap[i], cell_rhs[i], ADD_VALUES);
       }
     } // for i
-  }   // for cell
+    assembler.AddElementMatrix(imap, imap, Acell);
+  } // for cell
 
   log.Log() << "Global assembly";
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  assembler.Assemble();
   VecAssemblyBegin(b_);
   VecAssemblyEnd(b_);
 
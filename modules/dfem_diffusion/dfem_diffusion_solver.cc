@@ -7,6 +7,7 @@
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_discontinuous.h"
 #include "framework/math/functions/scalar_spatial_material_function.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
 
 namespace opensn
 {
@@ -148,16 +149,10 @@ Solver::Initialize()
   const auto n = static_cast<int64_t>(num_local_dofs_);
   const auto N = static_cast<int64_t>(num_globl_dofs_);
 
-  A_ = CreateSquareMatrix(n, N);
+  A_ = CreatePreallocatedSquareMatrix(sdm, OneDofPerNode);
   x_ = CreateVector(n, N);
   b_ = CreateVector(n, N);
 
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
-
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
-
   if (field_functions_.empty())
   {
     std::string solver_name;
@@ -187,6 +182,8 @@ Solver::Execute()
   VecSet(b_, 0.0);
 
   log.Log() << "Assembling system: ";
+  MatrixAssembler assembler(A_);
+  assembler.Begin();
 
   for (const auto& cell : grid.local_cells)
   {
@@ -216,7 +213,7 @@ Solver::Execute()
                           fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp)) *
                        fe_vol_data.JxW(qp);
         } // for qp
-        MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
+        assembler.Add(imap, jmap, entry_aij);
       } // for j
       double entry_rhs_i = 0.0;
       for (size_t qp : fe_vol_data.QuadraturePointIndices())
@@ -282,8 +279,8 @@ Solver::Execute()
                 2.0 * fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
                 fe_srf_data.JxW(qp);
 
-            MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-            MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+            assembler.Add(imap, jmmap, aij);
+            assembler.Add(imap, jpmap, -aij);
           } // for fj
         }   // for fi
 
@@ -315,8 +312,8 @@ Solver::Execute()
                          fe_srf_data.JxW(qp);
             const double aij = -0.5 * n_f.Dot(vec_aij);
 
-            MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-            MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+            assembler.Add(imap, jmmap, aij);
+            assembler.Add(imap, jpmap, -aij);
           } // for fj
         }   // for i
 
@@ -341,8 +338,8 @@ Solver::Execute()
                          fe_srf_data.JxW(qp);
             const double aij = -0.5 * n_f.Dot(vec_aij);
 
-            MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
-            MatSetValue(A_, ipmap, jmap, -aij, ADD_VALUES);
+            assembler.Add(immap, jmap, aij);
+            assembler.Add(ipmap, jmap, -aij);
           } // for j
         }   // for fi
 
@@ -384,7 +381,7 @@ Solver::Execute()
                          fe_srf_data.JxW(qp);
                 aij *= (aval / bval);
 
-                MatSetValue(A_, ir, jr, aij, ADD_VALUES);
+                assembler.Add(ir, jr, aij);
               } // for fj
             }   // if a nonzero
 
@@ -429,7 +426,7 @@ Solver::Execute()
                        fe_srf_data.JxW(qp);
               double aij_bc_value = aij * bc_value;
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
+              assembler.Add(imap, jmmap, aij);
               VecSetValue(b_, imap, aij_bc_value, ADD_VALUES);
             } // for fj
           }   // for fi
@@ -457,7 +454,7 @@ Solver::Execute()
               const double aij = -n_f.Dot(vec_aij);
               double aij_bc_value = aij * bc_value;
 
-              MatSetValue(A_, imap, jmap, aij, ADD_VALUES);
+              assembler.Add(imap, jmap, aij);
               VecSetValue(b_, imap, aij_bc_value, ADD_VALUES);
             }   // for fj
           }     // for i
@@ -469,8 +466,7 @@ Solver::Execute()
 
   log.Log() << "Global assembly";
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  assembler.Assemble();
   VecAssemblyBegin(b_);
   VecAssemblyEnd(b_);
 
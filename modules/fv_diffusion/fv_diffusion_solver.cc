@@ -8,6 +8,7 @@
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/math/spatial_discretization/finite_volume/finite_volume.h"
 #include "framework/math/functions/scalar_spatial_material_function.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
 
 namespace opensn
 {
@@ -149,16 +150,10 @@ fv_diffusion::Solver::Initialize()
   const auto n = static_cast<int64_t>(num_local_dofs_);
   const auto N = static_cast<int64_t>(num_globl_dofs_);
 
-  A_ = CreateSquareMatrix(n, N);
+  A_ = CreatePreallocatedSquareMatrix(sdm, OneDofPerNode);
   x_ = CreateVector(n, N);
   b_ = CreateVector(n, N);
 
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, OneDofPerNode);
-
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
-
   if (field_functions_.empty())
   {
     std::string solver_name;
@@ -189,6 +184,8 @@ fv_diffusion::Solver::Execute()
   // P ~ Present cell
   // N ~ Neighbor cell
   log.Log() << "Assembling system: ";
+  MatrixAssembler assembler(A_);
+  assembler.Begin();
   for (const auto& cell_P : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell_P);
@@ -202,7 +199,7 @@ fv_diffusion::Solver::Execute()
     const double D_P = d_coef_function_->Evaluate(imat, x_cc_P);
 
     const int64_t imap = sdm.MapDOF(cell_P, 0);
-    MatSetValue(A_, imap, imap, sigma_a * volume_P, ADD_VALUES);
+    assembler.Add(imap, imap, sigma_a * volume_P);
     VecSetValue(b_, imap, q_ext * volume_P, ADD_VALUES);
 
     for (size_t f = 0; f < cell_P.faces_.size(); ++f)
@@ -229,8 +226,8 @@ fv_diffusion::Solver::Execute()
         const double entry_ij = -entry_ii;
 
         const int64_t jmap = sdm.MapDOF(cell_N, 0);
-        MatSetValue(A_, imap, imap, entry_ii, ADD_VALUES);
-        MatSetValue(A_, imap, jmap, entry_ij, ADD_VALUES);
+        assembler.Add(imap, imap, entry_ii);
+        assembler.Add(imap, jmap, entry_ij);
       } // internal face
       else
       {
@@ -246,7 +243,7 @@ fv_diffusion::Solver::Execute()
             throw std::logic_error("if b=0, this is a Dirichlet BC, not a Robin BC");
 
           if (std::fabs(aval) > 1.0e-8)
-            MatSetValue(A_, imap, imap, A_f * aval / bval, ADD_VALUES);
+            assembler.Add(imap, imap, A_f * aval / bval);
           if (std::fabs(fval) > 1.0e-8)
             VecSetValue(b_, imap, A_f * fval / bval, ADD_VALUES);
         } // if Robin
@@ -261,7 +258,7 @@ fv_diffusion::Solver::Execute()
           const double D_f = D_P;
           const double entry_ii = A_f_n.Dot(D_f * x_PN / x_PN.NormSquare());
 
-          MatSetValue(A_, imap, imap, entry_ii, ADD_VALUES);
+          assembler.Add(imap, imap, entry_ii);
           VecSetValue(b_, imap, entry_ii * boundary_value, ADD_VALUES);
         } // if Dirichlet
       }   // bndry face
@@ -270,8 +267,7 @@ fv_diffusion::Solver::Execute()
 
   log.Log() << "Global assembly";
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  assembler.Assemble();
   VecAssemblyBegin(b_);
   VecAssemblyEnd(b_);
 
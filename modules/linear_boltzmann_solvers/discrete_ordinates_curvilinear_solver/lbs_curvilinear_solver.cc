@@ -197,6 +197,15 @@ DiscreteOrdinatesCurvilinearSolver::PerformInputChecks()
         Exit(EXIT_FAILURE);
       }
     }
+
+    //  the curvilinear sweep chunk lags local cycles
+    if (groupsets_[gs].resolve_local_cycles_)
+    {
+      log.Log0Warning() << "D_DO_RZ_SteadyState::SteadyStateSolver::PerformInputChecks : "
+                        << "resolve_local_cycles is not supported and is ignored, for groupset = "
+                        << gs;
+      groupsets_[gs].resolve_local_cycles_ = false;
+    }
   }
 
   //  boundary of mesh must be rectangular with origin at (0, 0, 0)
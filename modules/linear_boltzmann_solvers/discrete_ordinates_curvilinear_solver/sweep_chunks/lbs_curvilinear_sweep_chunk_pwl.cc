@@ -10,6 +10,67 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**Solves `num_systems` dense systems of size n by Gaussian elimination
+ * without pivoting, like GaussElimination. The systems are interleaved: entry
+ * (i, j) of system s is `A[(i * n + j) * num_systems + s]` and entry i of its
+ * right-hand side `b[i * num_systems + s]`, so that the innermost loops run
+ * over the systems with unit stride. A positive N fixes the size at compile
+ * time for the cells of 1D and 2D meshes; N = 0 uses the runtime size n. The
+ * solution overwrites b.*/
+template <int N>
+void
+BatchedGaussElimination(double* A, double* b, size_t n_runtime, size_t num_systems)
+{
+  const size_t n = N > 0 ? N : n_runtime;
+  const size_t S = num_systems;
+
+  // Forward elimination
+  for (size_t i = 0; i + 1 < n; ++i)
+  {
+    const double* A_ii = &A[(i * n + i) * S];
+    const double* b_i = &b[i * S];
+    for (size_t j = i + 1; j < n; ++j)
+    {
+      double* A_ji = &A[(j * n + i) * S];
+      double* b_j = &b[j * S];
+      for (size_t s = 0; s < S; ++s)
+      {
+        A_ji[s] /= A_ii[s];
+        b_j[s] -= A_ji[s] * b_i[s];
+      }
+      for (size_t k = i + 1; k < n; ++k)
+      {
+        const double* A_ik = &A[(i * n + k) * S];
+        double* A_jk = &A[(j * n + k) * S];
+        for (size_t s = 0; s < S; ++s)
+          A_jk[s] -= A_ji[s] * A_ik[s];
+      }
+    }
+  }
+
+  // Back substitution
+  for (size_t ii = n; ii > 0; --ii)
+  {
+    const size_t i = ii - 1;
+    double* b_i = &b[i * S];
+    for (size_t j = i + 1; j < n; ++j)
+    {
+      const double* A_ij = &A[(i * n + j) * S];
+      const double* b_j = &b[j * S];
+      for (size_t s = 0; s < S; ++s)
+        b_i[s] -= A_ij[s] * b_j[s];
+    }
+    const double* A_ii = &A[(i * n + i) * S];
+    for (size_t s = 0; s < S; ++s)
+      b_i[s] /= A_ii[s];
+  }
+}
+
+} // namespace
+
 SweepChunkPwlrz::SweepChunkPwlrz(
   const MeshContinuum& grid,
   const SpatialDiscretization& discretization_primary,
@@ -73,7 +134,7 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
 {
   const SubSetInfo& grp_ss_info = groupset_.grp_subset_infos_[angle_set.GetGroupSubset()];
 
-  auto gs_ss_size = grp_ss_info.ss_size;
+  const size_t gs_ss_size = grp_ss_info.ss_size;
   auto gs_ss_begin = grp_ss_info.ss_begin;
   auto gs_gi = groupset_.groups_[gs_ss_begin].id_;
 
@@ -84,16 +145,23 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
   const auto& m2d_op = groupset_.quadrature_->GetMomentToDiscreteOperator();
   const auto& d2m_op = groupset_.quadrature_->GetDiscreteToMomentOperator();
 
-  std::vector<std::vector<double>> Amat(max_num_cell_dofs_,
-                                        std::vector<double>(max_num_cell_dofs_));
-  std::vector<std::vector<double>> Atemp(max_num_cell_dofs_,
-                                         std::vector<double>(max_num_cell_dofs_));
-  std::vector<std::vector<double>> b(groupset_.groups_.size(),
-                                     std::vector<double>(max_num_cell_dofs_));
-  std::vector<double> source(max_num_cell_dofs_);
+  // Group-interleaved storage: entry (i, j) of the system of group g is at
+  // (i * n + j) * gs_ss_size + g and entry i of the right-hand side at
+  // i * gs_ss_size + g
+  const size_t max_dofs = max_num_cell_dofs_;
+  std::vector<double> Amat(max_dofs * max_dofs);
+  std::vector<double> A(max_dofs * max_dofs * gs_ss_size);
+  std::vector<double> b(max_dofs * gs_ss_size);
+  std::vector<double> source(max_dofs * gs_ss_size);
+  std::vector<double> sigma_tg(gs_ss_size);
+  std::vector<size_t> sweep_dof_map(max_dofs);
 
   const auto curvilinear_product_quadrature =
     std::dynamic_pointer_cast<opensn::CurvilinearAngularQuadrature>(groupset_.quadrature_);
+  const auto& diamond_difference_factors =
+    curvilinear_product_quadrature->GetDiamondDifferenceFactor();
+  const auto& streaming_operator_factors =
+    curvilinear_product_quadrature->GetStreamingOperatorFactor();
 
   // Loop over each cell
   const auto& spds = angle_set.GetSPDS();
@@ -106,13 +174,16 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
     auto& cell_mapping = discretization_.GetCellMapping(cell);
     auto& cell_transport_view = cell_transport_views_[cell_local_id];
     auto cell_num_faces = cell.faces_.size();
-    auto cell_num_nodes = cell_mapping.NumNodes();
+    const size_t cell_num_nodes = cell_mapping.NumNodes();
+    const size_t n = cell_num_nodes;
 
     const auto& face_orientations = spds.CellFaceOrientations()[cell_local_id];
     std::vector<double> face_mu_values(cell_num_faces);
 
     const auto& rho = densities_[cell.local_id_];
     const auto& sigma_t = xs_.at(cell.material_id_)->SigmaTotal();
+    for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+      sigma_tg[gsg] = rho * sigma_t[gs_gi + gsg];
 
     // Get cell matrices
     const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
@@ -131,32 +202,34 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
       auto wt = groupset_.quadrature_->weights_[direction_num];
 
       const auto polar_level = map_polar_level_[direction_num];
-      const auto fac_diamond_difference =
-        curvilinear_product_quadrature->GetDiamondDifferenceFactor()[direction_num];
-      const auto fac_streaming_operator =
-        curvilinear_product_quadrature->GetStreamingOperatorFactor()[direction_num];
+      const auto fac_diamond_difference = diamond_difference_factors[direction_num];
+      const auto fac_streaming_operator = streaming_operator_factors[direction_num];
 
       deploc_face_counter = ni_deploc_face_counter;
       preloc_face_counter = ni_preloc_face_counter;
 
-      // Reset right-hand side
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-        b[gsg].assign(cell_num_nodes, 0.0);
+      for (size_t i = 0; i < n; ++i)
+        sweep_dof_map[i] =
+          discretization_.MapDOFLocal(cell, i, unknown_manager_, polar_level, gs_gi);
 
-      for (size_t i = 0; i < cell_num_nodes; ++i)
+      // Reset right-hand side and add the angular redistribution of the
+      // sweeping dependency
+      b.assign(n * gs_ss_size, 0.0);
+      for (size_t i = 0; i < n; ++i)
       {
-        for (size_t j = 0; j < cell_num_nodes; ++j)
+        double* b_i = &b[i * gs_ss_size];
+        for (size_t j = 0; j < n; ++j)
         {
-          const auto jr =
-            discretization_.MapDOFLocal(cell, j, unknown_manager_, polar_level, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            b[gsg][i] += fac_streaming_operator * Maux[i][j] * psi_sweep_[jr + gsg];
+          const double coeff = fac_streaming_operator * Maux[i][j];
+          const double* psi_sweep_j = &psi_sweep_[sweep_dof_map[j]];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            b_i[gsg] += coeff * psi_sweep_j[gsg];
         }
       }
 
-      for (int i = 0; i < cell_num_nodes; ++i)
-        for (int j = 0; j < cell_num_nodes; ++j)
-          Amat[i][j] = omega.Dot(G[i][j]) + fac_streaming_operator * Maux[i][j];
+      for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j)
+          Amat[i * n + j] = omega.Dot(G[i][j]) + fac_streaming_operator * Maux[i][j];
 
       // Update face orientations
       for (int f = 0; f < cell_num_faces; ++f)
@@ -178,6 +251,18 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
         else if (not is_boundary_face)
           ++preloc_face_counter;
 
+        //  Determine whether incoming direction is incident on the point
+        //  of symmetry or on the axis of symmetry.
+        //  N.B.: A face is considered to be on the point/axis of symmetry
+        //  if all are true:
+        //    1. The face normal is antiparallel to $\vec{e}_{d}$.
+        //    2. All vertices of the face exhibit $v_{d} = 0$
+        //       with $d = 2$ for 1D geometries and $d = 0$ for 2D geometries.
+        //  Thanks to the verifications performed during initialisation,
+        //  at this point it is necessary to confirm only the orientation.
+        const bool incident_on_symmetric_boundary =
+          is_boundary_face and (cell_face.normal_.Dot(normal_vector_boundary_) < -0.999999);
+
         // IntSf_mu_psi_Mij_dA
         const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
         for (int fi = 0; fi < num_face_nodes; ++fi)
@@ -189,106 +274,93 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
             const int j = cell_mapping.MapFaceNode(f, fj);
 
             const double mu_Nij = -face_mu_values[f] * M_surf[f][i][j];
-            Amat[i][j] += mu_Nij;
+            Amat[i * n + j] += mu_Nij;
 
             const double* psi;
             if (is_local_face)
               psi = fluds.UpwindPsi(spls_index, in_face_counter, fj, 0, as_ss_idx);
             else if (not is_boundary_face)
               psi = fluds.NLUpwindPsi(preloc_face_counter, fj, 0, as_ss_idx);
+            else if (not incident_on_symmetric_boundary)
+              psi = angle_set.PsiBoundary(cell_face.neighbor_id_,
+                                          direction_num,
+                                          cell_local_id,
+                                          f,
+                                          fj,
+                                          gs_gi,
+                                          gs_ss_begin,
+                                          IsSurfaceSourceActive());
             else
-            {
-              //  Determine whether incoming direction is incident on the point
-              //  of symmetry or on the axis of symmetry.
-              //  N.B.: A face is considered to be on the point/axis of symmetry
-              //  if all are true:
-              //    1. The face normal is antiparallel to $\vec{e}_{d}$.
-              //    2. All vertices of the face exhibit $v_{d} = 0$
-              //       with $d = 2$ for 1D geometries and $d = 0$ for 2D geometries.
-              //  Thanks to the verifications performed during initialisation,
-              //  at this point it is necessary to confirm only the orientation.
-              const bool incident_on_symmetric_boundary =
-                (cell_face.normal_.Dot(normal_vector_boundary_) < -0.999999);
-              if (!incident_on_symmetric_boundary)
-              {
-                for (int fi = 0; fi < num_face_nodes; ++fi)
-                {
-                  const int i = cell_mapping.MapFaceNode(f, fi);
-
-                  for (int fj = 0; fj < num_face_nodes; ++fj)
-                  {
-                    const int j = cell_mapping.MapFaceNode(f, fj);
-
-                    psi = angle_set.PsiBoundary(cell_face.neighbor_id_,
-                                                direction_num,
-                                                cell_local_id,
-                                                f,
-                                                fj,
-                                                gs_gi,
-                                                gs_ss_begin,
-                                                IsSurfaceSourceActive());
-                  }
-                }
-              }
-              else
-                psi = nullptr;
-            }
+              psi = nullptr;
 
             if (not psi)
               continue;
 
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              b[gsg][i] += psi[gsg] * mu_Nij;
+            double* b_i = &b[i * gs_ss_size];
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+              b_i[gsg] += psi[gsg] * mu_Nij;
           } // for face node j
         }   // for face node i
       }     // for f
 
-      // Looping over groups, assembling mass terms
-      for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+      // Contribute source moments q = M_n^T * q_moms
+      source.assign(n * gs_ss_size, 0.0);
+      for (size_t i = 0; i < n; ++i)
       {
-        double sigma_tg = rho * sigma_t[gs_gi + gsg];
-
-        // Contribute source moments q = M_n^T * q_moms
-        for (int i = 0; i < cell_num_nodes; ++i)
+        double* source_i = &source[i * gs_ss_size];
+        for (int m = 0; m < num_moments_; ++m)
         {
-          double temp_src = 0.0;
-          for (int m = 0; m < num_moments_; ++m)
-          {
-            const size_t ir = cell_transport_view.MapDOF(i, m, static_cast<int>(gs_gi + gsg));
-            temp_src += m2d_op[m][direction_num] * source_moments_[ir];
-          }
-          source[i] = temp_src;
+          const double m2d = m2d_op[m][direction_num];
+          const double* q = &source_moments_[cell_transport_view.MapDOF(i, m, gs_gi)];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            source_i[gsg] += m2d * q[gsg];
         }
+      }
 
-        // Mass matrix and source
-        // Atemp = Amat + sigma_tgr * M
-        // b += M * q
-        for (int i = 0; i < cell_num_nodes; ++i)
+      // Mass matrix and source for all groups
+      // A = Amat + sigma_tg * M
+      // b += M * q
+      for (size_t i = 0; i < n; ++i)
+      {
+        double* b_i = &b[i * gs_ss_size];
+        for (size_t j = 0; j < n; ++j)
         {
-          double temp = 0.0;
-          for (int j = 0; j < cell_num_nodes; ++j)
+          const double Mij = M[i][j];
+          const double Amat_ij = Amat[i * n + j];
+          double* A_ij = &A[(i * n + j) * gs_ss_size];
+          const double* source_j = &source[j * gs_ss_size];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
           {
-            const double Mij = M[i][j];
-            Atemp[i][j] = Amat[i][j] + Mij * sigma_tg;
-            temp += Mij * source[j];
+            A_ij[gsg] = Amat_ij + Mij * sigma_tg[gsg];
+            b_i[gsg] += Mij * source_j[gsg];
           }
-          b[gsg][i] += temp;
         }
+      }
 
-        // Solve system
-        GaussElimination(Atemp, b[gsg], static_cast<int>(cell_num_nodes));
-      } // for gsg
+      // Solve the systems of all groups
+      switch (n)
+      {
+        case 2:
+          BatchedGaussElimination<2>(A.data(), b.data(), 2, gs_ss_size);
+          break;
+        case 4:
+          BatchedGaussElimination<4>(A.data(), b.data(), 4, gs_ss_size);
+          break;
+        default:
+          BatchedGaussElimination<0>(A.data(), b.data(), n, gs_ss_size);
+      }
 
       // Update phi
       auto& output_phi = GetDestinationPhi();
       for (int m = 0; m < num_moments_; ++m)
       {
         const double wn_d2m = d2m_op[m][direction_num];
-        for (int i = 0; i < cell_num_nodes; ++i)
+        for (size_t i = 0; i < n; ++i)
         {
           const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            output_phi[ir + gsg] += wn_d2m * b[gsg][i];
+          const double* b_i = &b[i * gs_ss_size];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            output_phi[ir + gsg] += wn_d2m * b_i[gsg];
         }
       }
 
@@ -299,12 +371,13 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
         double* cell_psi_data =
           &output_psi[discretization_.MapDOFLocal(cell, 0, groupset_.psi_uk_man_, 0, 0)];
 
-        for (size_t i = 0; i < cell_num_nodes; ++i)
+        for (size_t i = 0; i < n; ++i)
         {
           const size_t imap =
             i * groupset_angle_group_stride_ + direction_num * groupset_group_stride_ + gs_ss_begin;
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            cell_psi_data[imap + gsg] = b[gsg][i];
+          const double* b_i = &b[i * gs_ss_size];
+          for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+            cell_psi_data[imap + gsg] = b_i[gsg];
         }
       }
 
@@ -331,12 +404,13 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
         for (int fi = 0; fi < num_face_nodes; ++fi)
         {
           const int i = cell_mapping.MapFaceNode(f, fi);
+          const double* b_i = &b[i * gs_ss_size];
 
           if (is_boundary_face and not is_reflecting_boundary_face)
           {
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
               cell_transport_view.AddOutflow(gs_gi + gsg,
-                                             wt * face_mu_values[f] * b[gsg][i] * IntF_shapeI[i]);
+                                             wt * face_mu_values[f] * b_i[gsg] * IntF_shapeI[i]);
           }
 
           double* psi = nullptr;
@@ -352,8 +426,8 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
 
           if (not is_boundary_face or is_reflecting_boundary_face)
           {
-            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-              psi[gsg] = b[gsg][i];
+            for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+              psi[gsg] = b_i[gsg];
           }
         } // for fi
       }   // for face
@@ -362,11 +436,12 @@ SweepChunkPwlrz::Sweep(AngleSet& angle_set)
       // interval)
       const auto f0 = 1 / fac_diamond_difference;
       const auto f1 = f0 - 1;
-      for (size_t i = 0; i < cell_num_nodes; ++i)
+      for (size_t i = 0; i < n; ++i)
       {
-        const auto ir = discretization_.MapDOFLocal(cell, i, unknown_manager_, polar_level, gs_gi);
-        for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-          psi_sweep_[ir + gsg] = f0 * b[gsg][i] - f1 * psi_sweep_[ir + gsg];
+        double* psi_sweep_i = &psi_sweep_[sweep_dof_map[i]];
+        const double* b_i = &b[i * gs_ss_size];
+        for (size_t gsg = 0; gsg < gs_ss_size; ++gsg)
+          psi_sweep_i[gsg] = f0 * b_i[gsg] - f1 * psi_sweep_i[gsg];
       }
     } // for angleset/subset
   }   // for cell
@@ -124,6 +124,9 @@ SweepWGSContext::ApplyInverseTransportOperator(SourceFlags scope)
   if (scope & ZERO_INCOMING_DELAYED_PSI)
     sweep_scheduler_.ZeroIncomingDelayedPsi();
 
+  // The sweep overwrites angular fluxes compressed after the previous solve
+  lbs_solver_.DecompressAngularFluxes(groupset_.id_, false);
+
   // Sweep
   sweep_scheduler_.ZeroOutputFluxDataStructures();
   sweep_scheduler_.Sweep();
@@ -178,6 +181,8 @@ SweepWGSContext::PostSolveCallback()
       groupset_.PrintSweepInfoFile(sweep_scheduler_.SweepEventTag(), sweep_log_file_name);
     }
   }
+
+  lbs_solver_.CompressAngularFluxes(groupset_.id_);
 }
 
 } // namespace lbs
@@ -9,10 +9,12 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/cbc_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/scheduler/sweep_scheduler.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/wgs_linear_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/source_function.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh_continuum/mesh_repartitioning.h"
 #include "framework/math/quadratures/angular_quadrature_base.h"
 #include "framework/math/quadratures/angular_product_quadrature.h"
 #include "framework/logging/log.h"
@@ -23,6 +25,8 @@
 #include "framework/memory_usage.h"
 #include "framework/runtime.h"
 #include <iomanip>
+#include <algorithm>
+#include <limits>
 
 namespace opensn
 {
@@ -114,6 +118,8 @@ DiscreteOrdinatesSolver::Initialize()
   InitializeSweepDataStructures();
   for (auto& groupset : groupsets_)
   {
+    if (groupset.autotune_sweep_subsets_)
+      AutotuneSweepSubsets(groupset);
     InitFluxDataStructures(groupset);
 
     InitWGDSA(groupset);
@@ -481,6 +487,10 @@ DiscreteOrdinatesSolver::SetPrimarySTLvectorFromMultiGSPETScVecFrom(
 void
 DiscreteOrdinatesSolver::ReorientAdjointSolution()
 {
+  const int dimension = grid_ptr_->Attributes() & DIMENSION_1   ? 1
+                        : grid_ptr_->Attributes() & DIMENSION_2 ? 2
+                                                                : 3;
+
   for (const auto& groupset : groupsets_)
   {
     int gs = groupset.id_;
@@ -488,98 +498,70 @@ DiscreteOrdinatesSolver::ReorientAdjointSolution()
     // Moment map for flux moments
     const auto& moment_map = groupset.quadrature_->GetMomentToHarmonicsIndexMap();
 
-    // Angular flux info
-    auto& psi = psi_new_local_[gs];
-    const auto& uk_man = groupset.psi_uk_man_;
-
-    // Build reversed angle mapping
-    std::map<int, int> reversed_angle_map;
-    if (options_.save_angular_flux)
-    {
-      const auto& omegas = groupset.quadrature_->omegas_;
-      const auto num_gs_angles = omegas.size();
-
-      // Go through angles until all are paired
-      std::set<size_t> visited;
-      for (int idir = 0; idir < num_gs_angles; ++idir)
-      {
-        // Skip if already encountered
-        if (visited.count(idir) > 0)
-          continue;
-
-        bool found = true;
-        for (int jdir = 0; jdir < num_gs_angles; ++jdir)
-        {
-          // Angles are opposite if their sum is zero
-          const auto sum = grid_ptr_->Attributes() & DIMENSION_1
-                             ? Vector3(0.0, 0.0, omegas[idir].z + omegas[jdir].z)
-                             : omegas[idir] + omegas[jdir];
-          const bool opposite = sum.NormSquare() < 1.0e-8;
-
-          // Add opposites to mapping
-          if (opposite)
-          {
-            found = true;
-            reversed_angle_map[idir] = jdir;
-
-            visited.insert(idir);
-            visited.insert(jdir);
-          }
-        } // for angle n
-
-        OpenSnLogicalErrorIf(not found,
-                             "Opposing angle for " + omegas[idir].PrintStr() + " in groupset " +
-                               std::to_string(gs) + " not found.");
-
-      } // for angle m
-    }   // if saving angular flux
-
     const auto num_gs_groups = groupset.groups_.size();
     const auto gsg_i = groupset.groups_.front().id_;
     const auto gsg_f = groupset.groups_.back().id_;
 
+    // Reorient flux moments
+    //
+    // Because flux moments are integrated angular fluxes, the
+    // angular flux and spherical harmonics must be evaluated at
+    // opposite angles in the quadrature integration. Taking advantage
+    // of the even/odd nature of the spherical harmonics, i.e.
+    // Y_{\ell,m}(-\Omega) = (-1)^\ell Y_{\ell,m}(\Omega), the flux
+    // moments of odd order must be negated.
     for (const auto& cell : grid_ptr_->local_cells)
     {
       const auto& transport_view = cell_transport_views_[cell.local_id_];
       for (int i = 0; i < transport_view.NumNodes(); ++i)
-      {
-        // Reorient flux moments
-        //
-        // Because flux moments are integrated angular fluxes, the
-        // angular flux and spherical harmonics must be evaluated at
-        // opposite angles in the quadrature integration. Taking advantage
-        // of the even/odd nature of the spherical harmonics, i.e.
-        // Y_{\ell,m}(-\Omega) = (-1)^\ell Y_{\ell,m}(\Omega), the flux
-        // moments must be multiplied by (-1)^\ell.
         for (int imom = 0; imom < num_moments_; ++imom)
         {
-          const auto& ell = moment_map[imom].ell;
-          const auto dof_map = transport_view.MapDOF(i, imom, 0);
+          if (moment_map[imom].ell % 2 == 0)
+            continue;
 
+          const auto dof_map = transport_view.MapDOF(i, imom, 0);
           for (int g = gsg_i; g <= gsg_f; ++g)
           {
-            phi_new_local_[dof_map + g] *= std::pow(-1.0, ell);
-            phi_old_local_[dof_map + g] *= std::pow(-1.0, ell);
+            phi_new_local_[dof_map + g] = -phi_new_local_[dof_map + g];
+            phi_old_local_[dof_map + g] = -phi_old_local_[dof_map + g];
           } // for group g
         }   // for moment m
+    }       // for cell
+
+    // Reorient angular fluxes
+    if (options_.save_angular_flux)
+    {
+      const auto& opposing_map = groupset.quadrature_->GetOpposingDirectionMap(dimension);
+      const auto num_gs_angles = opposing_map.size();
+      for (size_t n = 0; n < num_gs_angles; ++n)
+        OpenSnLogicalErrorIf(opposing_map[n] < 0 or
+                               opposing_map[opposing_map[n]] != static_cast<int>(n),
+                             "Opposing angle for " +
+                               groupset.quadrature_->omegas_[n].PrintStr() + " in groupset " +
+                               std::to_string(gs) + " not found.");
 
-        // Reorient angular flux
-        if (options_.save_angular_flux)
+      // The angular fluxes of a node are stored contiguously with the groups of
+      // each angle adjacent. Reversing the angles is therefore a pairwise swap of
+      // group blocks within each node block.
+      const auto& uk_man = groupset.psi_uk_man_;
+      OpenSnLogicalErrorIf(uk_man.dof_storage_type_ != UnknownStorageType::NODAL,
+                           "Adjoint reorientation requires nodal angular flux storage.");
+
+      auto scoped_psi = ScopedPsiNewLocal(gs);
+      auto& psi = *scoped_psi;
+      const auto node_block_size = num_gs_angles * num_gs_groups;
+      for (size_t node_begin = 0; node_begin < psi.size(); node_begin += node_block_size)
+        for (size_t n = 0; n < num_gs_angles; ++n)
         {
-          for (const auto& [idir, jdir] : reversed_angle_map)
+          const auto m = static_cast<size_t>(opposing_map[n]);
+          if (m > n)
           {
-            const auto dof_map =
-              std::make_pair(discretization_->MapDOFLocal(cell, i, uk_man, idir, 0),
-                             discretization_->MapDOFLocal(cell, i, uk_man, jdir, 0));
-
-            for (int gsg = 0; gsg < num_gs_groups; ++gsg)
-              std::swap(psi[dof_map.first + gsg], psi[dof_map.second + gsg]);
+            auto* psi_n = &psi[node_begin + n * num_gs_groups];
+            std::swap_ranges(psi_n, psi_n + num_gs_groups, &psi[node_begin + m * num_gs_groups]);
           }
         }
-      } // for node i
-    }   // for cell
-
-  } // for groupset
+    } // if saving angular flux
+  }   // for groupset
 }
 
 void
@@ -744,6 +726,9 @@ DiscreteOrdinatesSolver::ComputeLeakage(const unsigned int groupset_id,
   const auto gsi = groupset.groups_.front().id_;
   const auto gsf = groupset.groups_.back().id_;
 
+  const auto scoped_psi = ScopedPsiNewLocal(static_cast<int>(groupset_id));
+  const auto& psi_gs = *scoped_psi;
+
   // Start integration
   std::vector<double> local_leakage(num_gs_groups, 0.0);
   for (const auto& cell : grid_ptr_->local_cells)
@@ -772,7 +757,7 @@ DiscreteOrdinatesSolver::ComputeLeakage(const unsigned int groupset_id,
               {
                 const auto g = gsg + gsi;
                 const auto imap = sdm.MapDOFLocal(cell, i, psi_uk_man, n, g);
-                const auto psi = psi_new_local_[groupset_id][imap];
+                const auto psi = psi_gs[imap];
                 local_leakage[gsg] += weight * mu * psi * int_f_shape_i[i];
               } // for g
             }   // outgoing
@@ -823,7 +808,8 @@ DiscreteOrdinatesSolver::ComputeLeakage(const std::vector<uint64_t>& boundary_id
     const auto num_gs_groups = groupset.groups_.size();
     const auto first_gs_group = groupset.groups_.front().id_;
 
-    const auto& psi_gs = psi_new_local_[gs];
+    const auto scoped_psi = ScopedPsiNewLocal(static_cast<int>(gs));
+    const auto& psi_gs = *scoped_psi;
 
     // Loop over cells for integration
     for (const auto& cell : grid_ptr_->local_cells)
@@ -886,6 +872,67 @@ DiscreteOrdinatesSolver::ComputeLeakage(const std::vector<uint64_t>& boundary_id
   return global_leakage;
 }
 
+SweepStatistics
+DiscreteOrdinatesSolver::GetSweepStatistics() const
+{
+  SweepStatistics stats;
+  for (const auto& wgs_solver : wgs_solvers_)
+  {
+    auto context = std::dynamic_pointer_cast<SweepWGSContext>(wgs_solver->GetContext());
+    if (context)
+      stats.Add(context->sweep_scheduler_.GetSweepStatistics());
+  }
+  return stats;
+}
+
+bool
+DiscreteOrdinatesSolver::RebalanceLoad(GraphPartitioner& partitioner,
+                                       const double imbalance_threshold,
+                                       size_t* num_migrated_cells)
+{
+  OpenSnLogicalErrorIf(not BoundExecutorName().empty(),
+                       TextName() + " is bound to the executor " + BoundExecutorName() +
+                         ", which keeps state of the current grid, and cannot be rebalanced.");
+
+  const double local_time = GetSweepStatistics().compute_time;
+  double max_time = 0.0;
+  double total_time = 0.0;
+  mpi_comm.all_reduce(local_time, max_time, mpi::op::max<double>());
+  mpi_comm.all_reduce(local_time, total_time, mpi::op::sum<double>());
+
+  const double avg_time = total_time / mpi_comm.size();
+  const double imbalance = avg_time > 0.0 ? max_time / avg_time : 1.0;
+  log.Log() << "Measured sweep load imbalance (max/avg) = " << imbalance;
+  if (num_migrated_cells != nullptr)
+    *num_migrated_cells = 0;
+  if (imbalance <= imbalance_threshold)
+    return false;
+
+  std::vector<double> cell_weights;
+  cell_weights.reserve(cell_transport_views_.size());
+  for (const auto& transport_view : cell_transport_views_)
+    cell_weights.push_back(local_time * transport_view.NumNodes() /
+                           static_cast<double>(local_node_count_));
+
+  const auto cell_partition_ids =
+    PartitionLocalCellsWeighted(*grid_ptr_, cell_weights, partitioner);
+
+  size_t local_num_migrated = 0;
+  for (const auto partition_id : cell_partition_ids)
+    if (partition_id != mpi_comm.rank())
+      ++local_num_migrated;
+  size_t num_migrated = 0;
+  mpi_comm.all_reduce(local_num_migrated, num_migrated, mpi::op::sum<size_t>());
+
+  Repartition(cell_partition_ids);
+
+  log.Log() << program_timer.GetTimeString() << " Rebalanced sweep load, migrating "
+            << num_migrated << " cells.";
+  if (num_migrated_cells != nullptr)
+    *num_migrated_cells = num_migrated;
+  return true;
+}
+
 void
 DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 {
@@ -894,6 +941,7 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
   // Define sweep ordering groups
   quadrature_unq_so_grouping_map_.clear();
   std::map<std::shared_ptr<AngularQuadrature>, bool> quadrature_allow_cycles_map_;
+  std::map<std::shared_ptr<AngularQuadrature>, bool> quadrature_resolve_cycles_map;
   for (auto& groupset : groupsets_)
   {
     if (quadrature_unq_so_grouping_map_.count(groupset.quadrature_) == 0)
@@ -902,6 +950,9 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 
     if (quadrature_allow_cycles_map_.count(groupset.quadrature_) == 0)
       quadrature_allow_cycles_map_[groupset.quadrature_] = groupset.allow_cycles_;
+
+    // The local cycle blocks are only needed if a groupset resolves them
+    quadrature_resolve_cycles_map[groupset.quadrature_] |= groupset.resolve_local_cycles_;
   }
 
   // Build sweep orderings
@@ -929,8 +980,12 @@ DiscreteOrdinatesSolver::InitializeSweepDataStructures()
 
       if (sweep_type_ == "AAH")
       {
-        const auto new_swp_order = std::make_shared<SPDS_AdamsAdamsHawkins>(
-          omega, *this->grid_ptr_, quadrature_allow_cycles_map_[quadrature], verbose);
+        const auto new_swp_order =
+          std::make_shared<SPDS_AdamsAdamsHawkins>(omega,
+                                                   *this->grid_ptr_,
+                                                   quadrature_allow_cycles_map_[quadrature],
+                                                   quadrature_resolve_cycles_map[quadrature],
+                                                   verbose);
         quadrature_spds_map_[quadrature].push_back(new_swp_order);
       }
       else if (sweep_type_ == "CBC")
@@ -1146,12 +1201,25 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
 
   const size_t gs_num_grps = groupset.groups_.size();
   const size_t gs_num_ss = groupset.grp_subset_infos_.size();
+  const int max_mpi_message_size = groupset.max_mpi_message_size_ > 0
+                                     ? groupset.max_mpi_message_size_
+                                     : options_.max_mpi_message_size;
+
+  // Local cycles are only resolved within AAH sweeps
+  const bool resolve_local_cycles = groupset.resolve_local_cycles_ and sweep_type_ == "AAH";
+  if (groupset.resolve_local_cycles_ and not resolve_local_cycles)
+    log.Log0Warning() << "Groupset " << groupset.id_ << ": resolve_local_cycles is only "
+                      << "supported by AAH sweeps. Local cycles will be lagged.";
 
   // Passing the sweep boundaries
   //                                            to the angle aggregation
   typedef AngleAggregation AngleAgg;
-  groupset.angle_agg_ = std::make_shared<AngleAgg>(
-    sweep_boundaries_, gs_num_grps, gs_num_ss, groupset.quadrature_, grid_ptr_);
+  groupset.angle_agg_ = std::make_shared<AngleAgg>(sweep_boundaries_,
+                                                   gs_num_grps,
+                                                   gs_num_ss,
+                                                   groupset.quadrature_,
+                                                   grid_ptr_,
+                                                   resolve_local_cycles);
 
   AngleSetGroup angle_set_group;
   size_t angle_set_id = 0;
@@ -1196,7 +1264,7 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
                                                           fluds,
                                                           angle_indices,
                                                           sweep_boundaries_,
-                                                          options_.max_mpi_message_size,
+                                                          max_mpi_message_size,
                                                           *grid_local_comm_set_);
 
           angle_set_group.AngleSets().push_back(angle_set);
@@ -1241,6 +1309,123 @@ DiscreteOrdinatesSolver::InitFluxDataStructures(LBSGroupset& groupset)
   opensn::mpi_comm.barrier();
 }
 
+void
+DiscreteOrdinatesSolver::AutotuneSweepSubsets(LBSGroupset& groupset)
+{
+  const size_t num_groups = groupset.groups_.size();
+  const auto& unique_so_groupings = quadrature_unq_so_grouping_map_[groupset.quadrature_].first;
+  size_t min_num_angles = std::numeric_limits<size_t>::max();
+  for (const auto& so_grouping : unique_so_groupings)
+    min_num_angles = std::min(min_num_angles, so_grouping.size());
+
+  // Powers of two up to a limit, along with the current value, such that no
+  // subset is empty
+  auto MakeCandidates = [](size_t num_items, size_t limit, int current)
+  {
+    std::vector<int> candidates;
+    for (size_t n = 1; n <= std::min(num_items, limit); n *= 2)
+      candidates.push_back(static_cast<int>(n));
+    if (current >= 1 and static_cast<size_t>(current) <= num_items and
+        std::find(candidates.begin(), candidates.end(), current) == candidates.end())
+      candidates.push_back(current);
+    std::sort(candidates.begin(), candidates.end());
+    return candidates;
+  };
+  const auto grp_candidates = MakeCandidates(num_groups, 32, groupset.master_num_grp_subsets_);
+  const auto ang_candidates = MakeCandidates(min_num_angles, 8, groupset.master_num_ang_subsets_);
+
+  struct Configuration
+  {
+    int num_grp_subsets;
+    int num_ang_subsets;
+    int max_mpi_message_size;
+  };
+
+  const int initial_message_size = groupset.max_mpi_message_size_ > 0
+                                     ? groupset.max_mpi_message_size_
+                                     : options_.max_mpi_message_size;
+
+  // Trial sweeps overwrite the flux vectors, which are restored afterwards
+  const auto phi_new_saved = phi_new_local_;
+  const auto psi_new_saved = psi_new_local_[groupset.id_];
+
+  // Returns the average sweep time, maximized over all processes, of a configuration
+  const auto num_trial_sweeps = static_cast<size_t>(groupset.autotune_num_trial_sweeps_);
+  auto TimeConfiguration = [&](const Configuration& config)
+  {
+    groupset.master_num_grp_subsets_ = config.num_grp_subsets;
+    groupset.master_num_ang_subsets_ = config.num_ang_subsets;
+    groupset.max_mpi_message_size_ = config.max_mpi_message_size;
+    groupset.grp_subset_infos_ = MakeSubSets(num_groups, config.num_grp_subsets);
+
+    InitFluxDataStructures(groupset);
+    auto sweep_chunk = SetSweepChunk(groupset);
+    SweepScheduler sweep_scheduler(sweep_type_ == "AAH" ? SchedulingAlgorithm::DEPTH_OF_GRAPH
+                                                        : SchedulingAlgorithm::FIRST_IN_FIRST_OUT,
+                                   *groupset.angle_agg_,
+                                   *sweep_chunk);
+    for (size_t i = 0; i < num_trial_sweeps; ++i)
+    {
+      sweep_scheduler.ZeroOutputFluxDataStructures();
+      sweep_scheduler.Sweep();
+    }
+
+    const double local_time = sweep_scheduler.GetAverageSweepTime();
+    double time = 0.0;
+    mpi_comm.all_reduce(local_time, time, mpi::op::max<double>());
+
+    log.Log0Verbose1() << "Groupset " << groupset.id_
+                       << " autotune candidate: groupset_num_subsets=" << config.num_grp_subsets
+                       << " angle_aggregation_num_subsets=" << config.num_ang_subsets
+                       << " max_mpi_message_size=" << config.max_mpi_message_size << " "
+                       << time << " s per sweep";
+    return time;
+  };
+
+  Configuration best_config{
+    groupset.master_num_grp_subsets_, groupset.master_num_ang_subsets_, initial_message_size};
+  double best_time = std::numeric_limits<double>::max();
+  auto TryConfiguration = [&](const Configuration& config)
+  {
+    const double time = TimeConfiguration(config);
+    if (time < best_time)
+    {
+      best_time = time;
+      best_config = config;
+    }
+  };
+
+  for (const int num_grp_subsets : grp_candidates)
+    for (const int num_ang_subsets : ang_candidates)
+      TryConfiguration({num_grp_subsets, num_ang_subsets, initial_message_size});
+
+  // The message size only affects AAH sweeps in parallel. It is tuned for the
+  // best subset configuration only.
+  if (sweep_type_ == "AAH" and mpi_comm.size() > 1)
+  {
+    const auto [num_grp_subsets, num_ang_subsets, message_size] = best_config;
+    for (const int factor : {4, 16})
+      TryConfiguration({num_grp_subsets, num_ang_subsets, message_size * factor});
+    if (message_size >= 4096)
+      TryConfiguration({num_grp_subsets, num_ang_subsets, message_size / 4});
+  }
+
+  groupset.master_num_grp_subsets_ = best_config.num_grp_subsets;
+  groupset.master_num_ang_subsets_ = best_config.num_ang_subsets;
+  groupset.max_mpi_message_size_ = best_config.max_mpi_message_size;
+  groupset.grp_subset_infos_ = MakeSubSets(num_groups, best_config.num_grp_subsets);
+
+  phi_new_local_ = phi_new_saved;
+  psi_new_local_[groupset.id_] = psi_new_saved;
+  ZeroOutflowBalanceVars(groupset);
+
+  log.Log() << "Groupset " << groupset.id_ << " autotuned sweep configuration: "
+            << "groupset_num_subsets=" << best_config.num_grp_subsets
+            << ", angle_aggregation_num_subsets=" << best_config.num_ang_subsets
+            << ", max_mpi_message_size=" << best_config.max_mpi_message_size << " ("
+            << best_time << " s per sweep)";
+}
+
 void
 DiscreteOrdinatesSolver::ResetSweepOrderings(LBSGroupset& groupset)
 {
@@ -5,6 +5,8 @@
 
 namespace opensn
 {
+class GraphPartitioner;
+
 namespace lbs
 {
 
@@ -80,6 +82,30 @@ public:
   std::map<uint64_t, std::vector<double>>
   ComputeLeakage(const std::vector<uint64_t>& boundary_ids) const;
 
+  /**
+   * Returns the sweep performance counters of this process, accumulated over
+   * the sweep schedulers of all groupsets.
+   */
+  SweepStatistics GetSweepStatistics() const;
+
+  /**
+   * Repartitions the grid if the sweeps are imbalanced. The imbalance is the
+   * maximum over the average, over processes, of the time spent in sweep chunks
+   * since the solver was initialized or last rebalanced. If it exceeds
+   * `imbalance_threshold`, the time of each process is spread over its local
+   * cells in proportion to their number of nodes, the cells are repartitioned
+   * with these weights by `partitioner`, which should honor weights, and the
+   * solver is moved to the new grid with `Repartition`. Returns true if the
+   * solver was rebalanced. If `num_migrated_cells` is given, it is set to the
+   * number of cells, over all processes, that moved to another process. Meant
+   * to be called between the solves of a `SteadyStateSolver`. Solvers bound to
+   * an executor that caches their state, e.g., a transient or k-eigenvalue
+   * executor, cannot be rebalanced. This is a collective call.
+   */
+  bool RebalanceLoad(GraphPartitioner& partitioner,
+                     double imbalance_threshold,
+                     size_t* num_migrated_cells = nullptr);
+
 protected:
   explicit DiscreteOrdinatesSolver(const std::string& text_name);
 
@@ -110,6 +136,15 @@ protected:
    */
   void InitFluxDataStructures(LBSGroupset& groupset);
 
+  /**
+   * Chooses the number of group subsets, the number of angle subsets and,
+   * for AAH sweeps in parallel, the maximum MPI message size of a groupset
+   * by timing a few trial sweeps of each candidate configuration. The fastest
+   * configuration is stored on the groupset and logged so that it can be
+   * supplied as input in subsequent runs.
+   */
+  void AutotuneSweepSubsets(LBSGroupset& groupset);
+
   /**
    * Clears all the sweep orderings for a groupset in preperation for another.
    */
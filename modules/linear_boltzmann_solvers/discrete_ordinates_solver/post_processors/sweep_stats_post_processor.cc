@@ -0,0 +1,171 @@
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/post_processors/sweep_stats_post_processor.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/lbs_discrete_ordinates_solver.h"
+
+#include "framework/object_factory.h"
+
+#include "framework/event_system/event.h"
+#include "framework/runtime.h"
+
+#include <algorithm>
+
+namespace opensn
+{
+namespace lbs
+{
+
+OpenSnRegisterObjectInNamespace(lbs, SweepStatsPostProcessor);
+
+InputParameters
+SweepStatsPostProcessor::GetInputParameters()
+{
+  InputParameters params = PostProcessor::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "A post processor reporting a sweep performance counter of a discrete ordinates "
+    "solver, accumulated over all sweeps of all groupsets and reduced over processes. "
+    "Times are in seconds and maximized over processes. Work and data volumes are "
+    "summed over processes. Available statistics:\n"
+    " - \"num_sweeps\": the number of sweeps.\n"
+    " - \"num_solves\": the number of cell-angle-group solves.\n"
+    " - \"solves_per_second\": cell-angle-group solves per second of sweep time.\n"
+    " - \"sweep_time\", \"compute_time\", \"wait_time\", \"send_time\": the time spent "
+    "sweeping, in sweep chunks, waiting on upstream or boundary data, and sending.\n"
+    " - \"bytes_sent\", \"bytes_received\": angular flux data exchanged with neighbors.\n"
+    " - \"max_neighbor_bytes_sent\", \"max_neighbor_bytes_received\": the largest volume "
+    "exchanged between any process and a single neighbor.\n"
+    " - \"max_angle_set_idle_time\", \"average_angle_set_idle_time\": the sweep time "
+    "during which an angle set was not computing.");
+  params.SetDocGroup("doc_PostProcessors");
+
+  params.AddRequiredParameter<size_t>("lbs_solver_handle",
+                                      "Handle to an existing discrete ordinates solver.");
+  params.AddOptionalParameter("statistic", "solves_per_second", "The statistic to report.");
+
+  params.ConstrainParameterRange("statistic",
+                                 AllowableRangeList::New({"num_sweeps",
+                                                          "num_solves",
+                                                          "solves_per_second",
+                                                          "sweep_time",
+                                                          "compute_time",
+                                                          "wait_time",
+                                                          "send_time",
+                                                          "bytes_sent",
+                                                          "bytes_received",
+                                                          "max_neighbor_bytes_sent",
+                                                          "max_neighbor_bytes_received",
+                                                          "max_angle_set_idle_time",
+                                                          "average_angle_set_idle_time"}));
+
+  return params;
+}
+
+SweepStatsPostProcessor::SweepStatsPostProcessor(const InputParameters& params)
+  : PostProcessor(params, PPType::SCALAR),
+    lbs_solver_(GetStackItem<DiscreteOrdinatesSolver>(
+      object_stack, params.GetParamValue<size_t>("lbs_solver_handle"), __FUNCTION__)),
+    statistic_(params.GetParamValue<std::string>("statistic"))
+{
+}
+
+double
+SweepStatsPostProcessor::ComputeStatistic() const
+{
+  const auto stats = lbs_solver_.GetSweepStatistics();
+
+  auto MaxBytes = [](const std::map<int, uint64_t>& bytes_per_location)
+  {
+    uint64_t max_bytes = 0;
+    for (const auto& [location, num_bytes] : bytes_per_location)
+      max_bytes = std::max(max_bytes, num_bytes);
+    return static_cast<double>(max_bytes);
+  };
+  auto SumBytes = [](const std::map<int, uint64_t>& bytes_per_location)
+  {
+    uint64_t total_bytes = 0;
+    for (const auto& [location, num_bytes] : bytes_per_location)
+      total_bytes += num_bytes;
+    return static_cast<double>(total_bytes);
+  };
+
+  double max_idle_time = 0.0;
+  double total_idle_time = 0.0;
+  for (const double idle_time : stats.angle_set_idle_time)
+  {
+    max_idle_time = std::max(max_idle_time, idle_time);
+    total_idle_time += idle_time;
+  }
+
+  // Times are converted from milliseconds to seconds
+  const std::vector<double> local_max = {static_cast<double>(stats.num_sweeps),
+                                         1.0e-3 * stats.sweep_time,
+                                         1.0e-3 * stats.compute_time,
+                                         1.0e-3 * stats.wait_time,
+                                         1.0e-3 * stats.send_time,
+                                         MaxBytes(stats.bytes_sent),
+                                         MaxBytes(stats.bytes_received),
+                                         1.0e-3 * max_idle_time};
+  const std::vector<double> local_sum = {static_cast<double>(stats.num_cell_angle_group_solves),
+                                         SumBytes(stats.bytes_sent),
+                                         SumBytes(stats.bytes_received),
+                                         1.0e-3 * total_idle_time,
+                                         static_cast<double>(stats.angle_set_idle_time.size())};
+
+  std::vector<double> global_max(local_max.size(), 0.0);
+  std::vector<double> global_sum(local_sum.size(), 0.0);
+  mpi_comm.all_reduce(
+    local_max.data(), local_max.size(), global_max.data(), mpi::op::max<double>());
+  mpi_comm.all_reduce(
+    local_sum.data(), local_sum.size(), global_sum.data(), mpi::op::sum<double>());
+
+  if (statistic_ == "num_sweeps")
+    return global_max[0];
+  if (statistic_ == "num_solves")
+    return global_sum[0];
+  if (statistic_ == "solves_per_second")
+    return global_max[1] > 0.0 ? global_sum[0] / global_max[1] : 0.0;
+  if (statistic_ == "sweep_time")
+    return global_max[1];
+  if (statistic_ == "compute_time")
+    return global_max[2];
+  if (statistic_ == "wait_time")
+    return global_max[3];
+  if (statistic_ == "send_time")
+    return global_max[4];
+  if (statistic_ == "bytes_sent")
+    return global_sum[1];
+  if (statistic_ == "bytes_received")
+    return global_sum[2];
+  if (statistic_ == "max_neighbor_bytes_sent")
+    return global_max[5];
+  if (statistic_ == "max_neighbor_bytes_received")
+    return global_max[6];
+  if (statistic_ == "max_angle_set_idle_time")
+    return global_max[7];
+  if (statistic_ == "average_angle_set_idle_time")
+    return global_sum[4] > 0.0 ? global_sum[3] / global_sum[4] : 0.0;
+
+  OpenSnLogicalError("Unknown sweep statistic \"" + statistic_ + "\".");
+}
+
+void
+SweepStatsPostProcessor::Execute(const Event& event_context)
+{
+  value_ = ParameterBlock("", ComputeStatistic());
+
+  const int event_code = event_context.Code();
+  if (event_code == Event::SolverInitialized or event_code == Event::SolverAdvanced)
+  {
+    const auto& event_params = event_context.Parameters();
+
+    if (event_params.Has("timestep_index") and event_params.Has("time"))
+    {
+      const size_t index = event_params.GetParamValue<size_t>("timestep_index");
+      const double time = event_params.GetParamValue<double>("time");
+      TimeHistoryEntry entry{index, time, value_};
+      time_history_.push_back(std::move(entry));
+    }
+  }
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "framework/post_processors/post_processor.h"
+
+namespace opensn
+{
+namespace lbs
+{
+class DiscreteOrdinatesSolver;
+
+/**Reports a sweep performance counter of a discrete ordinates solver, reduced over processes.*/
+class SweepStatsPostProcessor : public PostProcessor
+{
+public:
+  static InputParameters GetInputParameters();
+  explicit SweepStatsPostProcessor(const InputParameters& params);
+
+  void Execute(const Event& event_context) override;
+
+private:
+  /**Returns the value of the statistic over all processes. This is a collective call.*/
+  double ComputeStatistic() const;
+
+  const DiscreteOrdinatesSolver& lbs_solver_;
+  const std::string statistic_;
+};
+
+} // namespace lbs
+} // namespace opensn
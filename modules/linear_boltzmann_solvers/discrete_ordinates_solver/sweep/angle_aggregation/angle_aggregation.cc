@@ -14,11 +14,13 @@ AngleAggregation::AngleAggregation(
   size_t num_groups,
   size_t num_group_subsets,
   std::shared_ptr<AngularQuadrature>& quadrature,
-  std::shared_ptr<MeshContinuum>& grid)
+  std::shared_ptr<MeshContinuum>& grid,
+  bool resolve_local_cycles)
   : is_setup_(false),
     num_groups_(num_groups),
     num_group_subsets_(num_group_subsets),
     num_ang_unknowns_avail_(false),
+    resolve_local_cycles_(resolve_local_cycles),
     grid_(grid),
     quadrature_(quadrature),
     boundaries_(boundaries)
@@ -53,20 +55,16 @@ AngleAggregation::ZeroIncomingDelayedPsi()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = 0.0;
+        Set(rbndry.GetBoundaryFluxOld(), 0.0);
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      Set(angle_set->GetFLUDS().DelayedLocalPsiOld(), 0.0);
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        Set(angle_set->GetFLUDS().DelayedLocalPsiOld(), 0.0);
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -91,59 +89,57 @@ AngleAggregation::InitializeReflectingBCs()
     if (bndry->IsReflecting())
     {
       size_t tot_num_angles = quadrature_->abscissae_.size();
-      size_t num_local_cells = grid_->local_cells.size();
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       const auto& normal = rbndry.Normal();
 
-      rbndry.GetReflectedAngleIndexMap().resize(tot_num_angles, -1);
-      rbndry.GetAngleReadyFlags().resize(tot_num_angles,
-                                         std::vector<bool>(num_group_subsets_, false));
+      auto& index_map = rbndry.GetReflectedAngleIndexMap();
+      index_map.assign(tot_num_angles, -1);
 
-      // Determine reflected angle and check that it is within the quadrature
+      // Determine reflected angle and check that it is within the quadrature.
+      // Cartesian reflections only depend on the normal and are cached by the quadrature.
       typedef Vector3 Vec3;
-      for (int n = 0; n < tot_num_angles; ++n)
-      {
-        const Vec3& omega_n = quadrature_->omegas_[n];
-        Vec3 omega_reflected;
-
-        switch (rbndry.CoordType())
+      if (rbndry.CoordType() == CoordinateSystemType::CARTESIAN)
+        index_map = quadrature_->GetReflectedDirectionMap(normal);
+      else
+        for (int n = 0; n < tot_num_angles; ++n)
         {
-          case CoordinateSystemType::SPHERICAL:
-            omega_reflected = -1.0 * omega_n;
-            break;
-          case CoordinateSystemType::CYLINDRICAL:
+          const Vec3& omega_n = quadrature_->omegas_[n];
+          Vec3 omega_reflected;
+
+          switch (rbndry.CoordType())
           {
-            // left, top and bottom is regular reflecting
-            if (std::fabs(normal.Dot(jhat)) > 0.999999 or normal.Dot(ihat) < -0.999999)
-              omega_reflected = omega_n - 2.0 * normal * omega_n.Dot(normal);
-            // right derive their normal from omega_n
-            else if (normal.Dot(ihat) > 0.999999)
+            case CoordinateSystemType::SPHERICAL:
+              omega_reflected = -1.0 * omega_n;
+              break;
+            case CoordinateSystemType::CYLINDRICAL:
             {
-              Vec3 normal_star;
-              if (omega_n.Dot(normal) > 0.0)
-                normal_star = Vec3(omega_n.x, 0.0, omega_n.z).Normalized();
-              else
-                normal_star = Vec3(-omega_n.x, 0.0, -omega_n.y).Normalized();
-
-              omega_reflected = omega_n - 2.0 * normal_star * omega_n.Dot(normal_star);
+              // left, top and bottom is regular reflecting
+              if (std::fabs(normal.Dot(jhat)) > 0.999999 or normal.Dot(ihat) < -0.999999)
+                omega_reflected = omega_n - 2.0 * normal * omega_n.Dot(normal);
+              // right derive their normal from omega_n
+              else if (normal.Dot(ihat) > 0.999999)
+              {
+                Vec3 normal_star;
+                if (omega_n.Dot(normal) > 0.0)
+                  normal_star = Vec3(omega_n.x, 0.0, omega_n.z).Normalized();
+                else
+                  normal_star = Vec3(-omega_n.x, 0.0, -omega_n.y).Normalized();
+
+                omega_reflected = omega_n - 2.0 * normal_star * omega_n.Dot(normal_star);
+              }
             }
-          }
-          break;
-          case CoordinateSystemType::CARTESIAN:
-          default:
-            omega_reflected = omega_n - 2.0 * normal * omega_n.Dot(normal);
-            break;
-        }
-
-        auto& index_map = rbndry.GetReflectedAngleIndexMap();
-        for (int nstar = 0; nstar < tot_num_angles; ++nstar)
-          if (omega_reflected.Dot(quadrature_->omegas_[nstar]) > (1.0 - epsilon))
-          {
-            index_map[n] = nstar;
             break;
+            default:
+              omega_reflected = omega_n - 2.0 * normal * omega_n.Dot(normal);
+              break;
           }
 
+          index_map[n] = quadrature_->FindDirection(omega_reflected);
+        }
+
+      for (int n = 0; n < tot_num_angles; ++n)
+      {
         if (index_map[n] < 0)
           throw std::logic_error(
             fname + ": Reflected angle not found for angle " + std::to_string(n) +
@@ -154,51 +150,7 @@ AngleAggregation::InitializeReflectingBCs()
       }
 
       // Initialize storage for all outbound directions
-      auto& heteroflux_new = rbndry.GetBoundaryFluxNew();
-      auto& heteroflux_old = rbndry.GetBoundaryFluxOld();
-      heteroflux_new.clear();
-      heteroflux_old.clear();
-      heteroflux_new.resize(tot_num_angles);
-      for (int n = 0; n < tot_num_angles; ++n)
-      {
-        // Only continue if omega is outgoing
-        if (quadrature_->omegas_[n].Dot(rbndry.Normal()) < 0.0)
-          continue;
-
-        // For cells
-        auto& cell_vec = heteroflux_new[n];
-        cell_vec.resize(num_local_cells);
-        for (const auto& cell : grid_->local_cells)
-        {
-          const uint64_t c = cell.local_id_;
-
-          // Check cell on ref bndry
-          bool on_ref_bndry = false;
-          for (const auto& face : cell.faces_)
-          {
-            if ((not face.has_neighbor_) and (face.normal_.Dot(rbndry.Normal()) > 0.999999))
-            {
-              on_ref_bndry = true;
-              break;
-            }
-          }
-          if (not on_ref_bndry)
-            continue;
-
-          // If cell on ref bndry
-          cell_vec[c].resize(cell.faces_.size());
-          int f = 0;
-          for (const auto& face : cell.faces_)
-          {
-            if ((not face.has_neighbor_) and (face.normal_.Dot(rbndry.Normal()) > 0.999999))
-            {
-              cell_vec[c][f].clear();
-              cell_vec[c][f].resize(face.vertex_ids_.size(), std::vector<double>(num_groups_, 0.0));
-            }
-            ++f;
-          }
-        } // for cells
-      }   // for angles
+      rbndry.InitializeStorage(*grid_, quadrature_->omegas_, num_groups_, num_group_subsets_);
 
       // Determine if boundary is opposing reflecting
       // The boundary with the smallest bid will
@@ -248,19 +200,16 @@ AngleAggregation::GetNumDelayedAngularDOFs()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                local_ang_unknowns += dofvec.size();
+        local_ang_unknowns += rbndry.GetBoundaryFluxNew().size();
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      local_ang_unknowns += angle_set->GetFLUDS().DelayedLocalPsi().size();
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        local_ang_unknowns += angle_set->GetFLUDS().DelayedLocalPsi().size();
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -288,27 +237,24 @@ AngleAggregation::AppendNewDelayedAngularDOFsToArray(int64_t& index, double* x_r
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                {
-                  index++;
-                  x_ref[index] = val;
-                }
+        for (auto val : rbndry.GetBoundaryFluxNew())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto val : angle_set->GetFLUDS().DelayedLocalPsi())
-      {
-        index++;
-        x_ref[index] = val;
-      }
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto val : angle_set->GetFLUDS().DelayedLocalPsi())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -332,27 +278,24 @@ AngleAggregation::AppendOldDelayedAngularDOFsToArray(int64_t& index, double* x_r
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                {
-                  index++;
-                  x_ref[index] = val;
-                }
+        for (auto val : rbndry.GetBoundaryFluxOld())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto val : angle_set->GetFLUDS().DelayedLocalPsiOld())
-      {
-        index++;
-        x_ref[index] = val;
-      }
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto val : angle_set->GetFLUDS().DelayedLocalPsiOld())
+        {
+          index++;
+          x_ref[index] = val;
+        }
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -376,27 +319,24 @@ AngleAggregation::SetOldDelayedAngularDOFsFromArray(int64_t& index, const double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                {
-                  index++;
-                  val = x_ref[index];
-                }
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto& val : angle_set->GetFLUDS().DelayedLocalPsiOld())
-      {
-        index++;
-        val = x_ref[index];
-      }
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto& val : angle_set->GetFLUDS().DelayedLocalPsiOld())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -420,27 +360,24 @@ AngleAggregation::SetNewDelayedAngularDOFsFromArray(int64_t& index, const double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                {
-                  index++;
-                  val = x_ref[index];
-                }
+        for (auto& val : rbndry.GetBoundaryFluxNew())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto& val : angle_set->GetFLUDS().DelayedLocalPsi())
-      {
-        index++;
-        val = x_ref[index];
-      }
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto& val : angle_set->GetFLUDS().DelayedLocalPsi())
+        {
+          index++;
+          val = x_ref[index];
+        }
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -469,21 +406,18 @@ AngleAggregation::GetNewDelayedAngularDOFsAsSTLVector()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                  psi_vector.push_back(val);
+        for (auto val : rbndry.GetBoundaryFluxNew())
+          psi_vector.push_back(val);
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto val : angle_set->GetFLUDS().DelayedLocalPsi())
-        psi_vector.push_back(val);
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto val : angle_set->GetFLUDS().DelayedLocalPsi())
+          psi_vector.push_back(val);
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -515,21 +449,18 @@ AngleAggregation::SetNewDelayedAngularDOFsFromSTLVector(const std::vector<double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxNew())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = stl_vector[index++];
+        for (auto& val : rbndry.GetBoundaryFluxNew())
+          val = stl_vector[index++];
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto& val : angle_set->GetFLUDS().DelayedLocalPsi())
-        val = stl_vector[index++];
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto& val : angle_set->GetFLUDS().DelayedLocalPsi())
+          val = stl_vector[index++];
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -555,21 +486,18 @@ AngleAggregation::GetOldDelayedAngularDOFsAsSTLVector()
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto val : dofvec)
-                  psi_vector.push_back(val);
+        for (auto val : rbndry.GetBoundaryFluxOld())
+          psi_vector.push_back(val);
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto val : angle_set->GetFLUDS().DelayedLocalPsiOld())
-        psi_vector.push_back(val);
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto val : angle_set->GetFLUDS().DelayedLocalPsiOld())
+          psi_vector.push_back(val);
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
@@ -601,21 +529,18 @@ AngleAggregation::SetOldDelayedAngularDOFsFromSTLVector(const std::vector<double
       auto& rbndry = (ReflectingBoundary&)(*bndry);
 
       if (rbndry.IsOpposingReflected())
-        for (auto& angle : rbndry.GetBoundaryFluxOld())
-          for (auto& cellvec : angle)
-            for (auto& facevec : cellvec)
-              for (auto& dofvec : facevec)
-                for (auto& val : dofvec)
-                  val = stl_vector[index++];
+        for (auto& val : rbndry.GetBoundaryFluxOld())
+          val = stl_vector[index++];
 
     } // if reflecting
   }   // for bndry
 
-  // Intra-cell cycles
-  for (auto& as_group : angle_set_groups)
-    for (auto& angle_set : as_group.AngleSets())
-      for (auto& val : angle_set->GetFLUDS().DelayedLocalPsiOld())
-        val = stl_vector[index++];
+  // Intra-cell cycles, unless they are resolved within the sweep
+  if (not resolve_local_cycles_)
+    for (auto& as_group : angle_set_groups)
+      for (auto& angle_set : as_group.AngleSets())
+        for (auto& val : angle_set->GetFLUDS().DelayedLocalPsiOld())
+          val = stl_vector[index++];
 
   // Inter location cycles
   for (auto& as_group : angle_set_groups)
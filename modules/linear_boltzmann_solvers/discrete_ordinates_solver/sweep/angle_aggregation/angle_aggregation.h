@@ -35,6 +35,9 @@ private:
   size_t num_group_subsets_;
   bool num_ang_unknowns_avail_;
   std::pair<size_t, size_t> number_angular_unknowns_;
+  /// If true, the delayed local psi of local cycles is converged within each
+  /// sweep and is therefore not part of the delayed angular unknowns.
+  bool resolve_local_cycles_;
   std::shared_ptr<MeshContinuum> grid_;
   std::shared_ptr<AngularQuadrature> quadrature_;
   std::map<uint64_t, std::shared_ptr<SweepBoundary>> boundaries_;
@@ -44,7 +47,8 @@ public:
                    size_t num_groups,
                    size_t num_group_subsets,
                    std::shared_ptr<AngularQuadrature>& quadrature,
-                   std::shared_ptr<MeshContinuum>& grid);
+                   std::shared_ptr<MeshContinuum>& grid,
+                   bool resolve_local_cycles = false);
 
   std::vector<AngleSetGroup> angle_set_groups;
 
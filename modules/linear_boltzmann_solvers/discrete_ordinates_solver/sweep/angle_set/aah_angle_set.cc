@@ -1,6 +1,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_set/aah_angle_set.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/sweep_chunk.h"
 #include "framework/logging/log.h"
+#include "framework/utils/timer.h"
 #include "framework/runtime.h"
 
 namespace opensn
@@ -22,6 +23,12 @@ AAH_AngleSet::AAH_AngleSet(size_t id,
 {
 }
 
+AsynchronousCommunicator*
+AAH_AngleSet::GetCommunicator()
+{
+  return static_cast<AsynchronousCommunicator*>(&async_comm_);
+}
+
 void
 AAH_AngleSet::InitializeDelayedUpstreamData()
 {
@@ -36,11 +43,16 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
   if (executed_)
   {
     if (not async_comm_.DoneSending())
+    {
+      Timer send_timer;
       async_comm_.ClearDownstreamBuffers();
+      counters_.send_time += send_timer.GetTime();
+    }
     return AngleSetStatus::FINISHED;
   }
 
   // Check upstream data available
+  Timer wait_timer;
   AngleSetStatus status = async_comm_.ReceiveUpstreamPsi(static_cast<int>(this->GetID()));
 
   // Also check boundaries
@@ -50,19 +62,26 @@ AAH_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
       status = AngleSetStatus::RECEIVING;
       break;
     }
+  counters_.wait_time += wait_timer.GetTime();
 
   if (status == AngleSetStatus::RECEIVING)
     return status;
   else if (status == AngleSetStatus::READY_TO_EXECUTE and permission == AngleSetStatus::EXECUTE)
   {
+    Timer compute_timer;
     async_comm_.InitializeLocalAndDownstreamBuffers();
 
     log.LogEvent(timing_tags[0], Logger::EventType::EVENT_BEGIN);
     sweep_chunk.Sweep(*this); // Execute chunk
     log.LogEvent(timing_tags[0], Logger::EventType::EVENT_END);
+    counters_.compute_time += compute_timer.GetTime();
+    counters_.num_cell_angle_group_solves +=
+      spds_.GetSPLS().item_id.size() * angles_.size() * num_groups_;
 
     // Send outgoing psi and clear local and receive buffers
+    Timer send_timer;
     async_comm_.SendDownstreamPsi(static_cast<int>(this->GetID()));
+    counters_.send_time += send_timer.GetTime();
     async_comm_.ClearLocalAndReceiveBuffers();
 
     // Update boundary readiness
@@ -80,7 +99,11 @@ AngleSetStatus
 AAH_AngleSet::FlushSendBuffers()
 {
   if (not async_comm_.DoneSending())
+  {
+    Timer send_timer;
     async_comm_.ClearDownstreamBuffers();
+    counters_.send_time += send_timer.GetTime();
+  }
 
   if (async_comm_.DoneSending())
     return AngleSetStatus::MESSAGES_SENT;
@@ -110,7 +133,10 @@ AAH_AngleSet::ResetSweepBuffers()
 bool
 AAH_AngleSet::ReceiveDelayedData()
 {
-  return async_comm_.ReceiveDelayedData(static_cast<int>(this->GetID()));
+  Timer wait_timer;
+  const bool received = async_comm_.ReceiveDelayedData(static_cast<int>(this->GetID()));
+  counters_.wait_time += wait_timer.GetTime();
+  return received;
 }
 
 const double*
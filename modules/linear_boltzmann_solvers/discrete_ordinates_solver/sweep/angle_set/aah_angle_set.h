@@ -25,6 +25,8 @@ public:
                int maximum_message_size,
                const MPICommunicatorSet& in_comm_set);
 
+  AsynchronousCommunicator* GetCommunicator() override;
+
   void InitializeDelayedUpstreamData() override;
 
   int GetMaxBufferMessages() const override;
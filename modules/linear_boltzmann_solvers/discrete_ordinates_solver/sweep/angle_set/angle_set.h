@@ -26,6 +26,7 @@ protected:
   std::map<uint64_t, std::shared_ptr<SweepBoundary>>& boundaries_;
   const size_t group_subset_;
   bool executed_ = false;
+  AngleSetCounters counters_;
 
 public:
   AngleSet(size_t id,
@@ -67,6 +68,16 @@ public:
 
   size_t GetNumAngles() const { return angles_.size(); }
 
+  /**Returns the performance counters accumulated since the last reset.*/
+  const AngleSetCounters& GetCounters() const { return counters_; }
+
+  /**Zeroes the performance counters, including the communicator's byte counts.*/
+  void ResetCounters()
+  {
+    counters_ = AngleSetCounters();
+    GetCommunicator()->ResetByteCounts();
+  }
+
   virtual AsynchronousCommunicator* GetCommunicator()
   {
     OpenSnLogicalError("Method not implemented");
@@ -5,6 +5,7 @@
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/math_range.h"
 #include "framework/logging/log.h"
+#include "framework/utils/timer.h"
 #include "framework/runtime.h"
 
 namespace opensn
@@ -47,17 +48,26 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
 
   sweep_chunk.SetAngleSet(*this);
 
+  Timer wait_timer;
   auto tasks_who_received_data = async_comm_.ReceiveData();
 
   for (const uint64_t task_number : tasks_who_received_data)
     --current_task_list_[task_number].num_dependencies_;
+  counters_.wait_time += wait_timer.GetTime();
 
-  async_comm_.SendData();
+  SendData();
 
   // Check if boundaries allow for execution
+  wait_timer.Reset();
   for (auto& [bid, boundary] : boundaries_)
     if (not boundary->CheckAnglesReadyStatus(angles_, group_subset_))
+    {
+      counters_.wait_time += wait_timer.GetTime();
       return Status::NOT_FINISHED;
+    }
+  counters_.wait_time += wait_timer.GetTime();
+
+  const uint64_t num_solves_per_cell = angles_.size() * num_groups_;
 
   bool all_tasks_completed = true;
   bool a_task_executed = true;
@@ -70,6 +80,7 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
         all_tasks_completed = false;
       if (cell_task.num_dependencies_ == 0 and not cell_task.completed_)
       {
+        Timer compute_timer;
         log.LogEvent(timing_tags[0], Logger::EventType::EVENT_BEGIN);
         sweep_chunk.SetCell(cell_task.cell_ptr_, *this);
         sweep_chunk.Sweep(*this);
@@ -77,16 +88,18 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
         for (uint64_t local_task_num : cell_task.successors_)
           --current_task_list_[local_task_num].num_dependencies_;
         log.LogEvent(timing_tags[0], Logger::EventType::EVENT_END);
+        counters_.compute_time += compute_timer.GetTime();
+        counters_.num_cell_angle_group_solves += num_solves_per_cell;
 
         cell_task.completed_ = true;
         a_task_executed = true;
-        async_comm_.SendData();
+        SendData();
       }
     } // for cell_task
-    async_comm_.SendData();
+    SendData();
   }
 
-  const bool all_messages_sent = async_comm_.SendData();
+  const bool all_messages_sent = SendData();
 
   if (all_tasks_completed and all_messages_sent)
   {
@@ -100,6 +113,15 @@ CBC_AngleSet::AngleSetAdvance(SweepChunk& sweep_chunk,
   return Status::NOT_FINISHED;
 }
 
+bool
+CBC_AngleSet::SendData()
+{
+  Timer send_timer;
+  const bool all_messages_sent = async_comm_.SendData();
+  counters_.send_time += send_timer.GetTime();
+  return all_messages_sent;
+}
+
 void
 CBC_AngleSet::ResetSweepBuffers()
 {
@@ -42,7 +42,7 @@ public:
 
   AngleSetStatus FlushSendBuffers() override
   {
-    const bool all_messages_sent = async_comm_.SendData();
+    const bool all_messages_sent = SendData();
     return all_messages_sent ? AngleSetStatus::MESSAGES_SENT : AngleSetStatus::MESSAGES_PENDING;
   }
 
@@ -65,6 +65,10 @@ public:
                        unsigned int face_num,
                        unsigned int fi,
                        size_t gs_ss_begin) override;
+
+private:
+  /**Flushes the outgoing messages, accounting the time as send time.*/
+  bool SendData();
 };
 
 } // namespace lbs
@@ -1,11 +1,68 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/reflecting_boundary.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/logging/log.h"
+#include "framework/memory_usage.h"
+#include <algorithm>
 
 namespace opensn
 {
 namespace lbs
 {
 
+void
+ReflectingBoundary::InitializeStorage(const MeshContinuum& grid,
+                                      const std::vector<Vector3>& omegas,
+                                      size_t num_groups,
+                                      size_t num_group_subsets)
+{
+  const size_t num_local_cells = grid.local_cells.size();
+
+  // Boundary node offsets of the faces of cells on the boundary
+  cell_face_offsets_.assign(num_local_cells + 1, 0);
+  face_node_offsets_.clear();
+  num_face_nodes_ = 0;
+  for (const auto& cell : grid.local_cells)
+  {
+    const uint64_t c = cell.local_id_;
+    cell_face_offsets_[c] = face_node_offsets_.size();
+
+    bool on_ref_bndry = false;
+    for (const auto& face : cell.faces_)
+      if ((not face.has_neighbor_) and (face.normal_.Dot(normal_) > 0.999999))
+      {
+        on_ref_bndry = true;
+        break;
+      }
+    if (not on_ref_bndry)
+      continue;
+
+    for (const auto& face : cell.faces_)
+    {
+      face_node_offsets_.push_back(num_face_nodes_);
+      if ((not face.has_neighbor_) and (face.normal_.Dot(normal_) > 0.999999))
+        num_face_nodes_ += face.vertex_ids_.size();
+    }
+  }
+  cell_face_offsets_[num_local_cells] = face_node_offsets_.size();
+
+  // Storage for all outgoing angles
+  num_flux_groups_ = num_groups;
+  num_angles_ = omegas.size();
+  angle_offsets_.assign(num_angles_, INVALID_OFFSET);
+  size_t num_values = 0;
+  for (size_t n = 0; n < num_angles_; ++n)
+  {
+    if (omegas[n].Dot(normal_) < 0.0)
+      continue;
+    angle_offsets_[n] = num_values;
+    num_values += num_face_nodes_ * num_flux_groups_;
+  }
+
+  boundary_flux_.assign(num_values, 0.0);
+  boundary_flux_old_.clear();
+  angle_readyflags_.assign(num_angles_ * num_group_subsets, 0);
+}
+
 double*
 ReflectingBoundary::PsiIncoming(uint64_t cell_local_id,
                                 unsigned int face_num,
@@ -14,20 +71,12 @@ ReflectingBoundary::PsiIncoming(uint64_t cell_local_id,
                                 int group_num,
                                 size_t gs_ss_begin)
 {
-  double* psi = nullptr;
-
-  int reflected_angle_num = reflected_anglenum_[angle_num];
+  const int reflected_angle_num = reflected_anglenum_[angle_num];
+  const size_t index = FluxIndex(cell_local_id, face_num, fi, reflected_angle_num) + gs_ss_begin;
 
   if (opposing_reflected_)
-  {
-    psi = &boundary_flux_old_[reflected_angle_num][cell_local_id][face_num][fi][gs_ss_begin];
-  }
-  else
-  {
-    psi = &boundary_flux_[reflected_angle_num][cell_local_id][face_num][fi][gs_ss_begin];
-  }
-
-  return psi;
+    return &boundary_flux_old_[index];
+  return &boundary_flux_[index];
 }
 
 double*
@@ -37,14 +86,15 @@ ReflectingBoundary::PsiOutgoing(uint64_t cell_local_id,
                                 unsigned int angle_num,
                                 size_t gs_ss_begin)
 {
-  return &boundary_flux_[angle_num][cell_local_id][face_num][fi][gs_ss_begin];
+  return &boundary_flux_[FluxIndex(cell_local_id, face_num, fi, angle_num) + gs_ss_begin];
 }
 
 void
 ReflectingBoundary::UpdateAnglesReadyStatus(const std::vector<size_t>& angles, size_t gs_ss)
 {
+  char* flags = &angle_readyflags_[gs_ss * num_angles_];
   for (const size_t n : angles)
-    angle_readyflags_[reflected_anglenum_[n]][gs_ss] = true;
+    flags[reflected_anglenum_[n]] = 1;
 }
 
 bool
@@ -52,23 +102,33 @@ ReflectingBoundary::CheckAnglesReadyStatus(const std::vector<size_t>& angles, si
 {
   if (opposing_reflected_)
     return true;
-  bool ready_flag = true;
-  for (auto& n : angles)
-    if (not boundary_flux_[reflected_anglenum_[n]].empty())
-      if (not angle_readyflags_[n][gs_ss])
+  const char* flags = &angle_readyflags_[gs_ss * num_angles_];
+  for (const size_t n : angles)
+    if (angle_offsets_[reflected_anglenum_[n]] != INVALID_OFFSET and num_face_nodes_ > 0)
+      if (not flags[n])
         return false;
 
-  return ready_flag;
+  return true;
+}
+
+size_t
+ReflectingBoundary::ComputeMemoryUsage() const
+{
+  return VectorMemoryUsage(boundary_flux_) + VectorMemoryUsage(boundary_flux_old_) +
+         VectorMemoryUsage(angle_offsets_) + VectorMemoryUsage(cell_face_offsets_) +
+         VectorMemoryUsage(face_node_offsets_) + VectorMemoryUsage(reflected_anglenum_) +
+         VectorMemoryUsage(angle_readyflags_);
 }
 
 void
 ReflectingBoundary::ResetAnglesReadyStatus()
 {
-  boundary_flux_old_ = boundary_flux_;
+  // Non-opposing boundaries read the fluxes of the current sweep and never
+  // need the old copy
+  if (opposing_reflected_)
+    boundary_flux_old_ = boundary_flux_;
 
-  for (auto& flags : angle_readyflags_)
-    for (int gs_ss = 0; gs_ss < flags.size(); ++gs_ss)
-      flags[gs_ss] = false;
+  std::fill(angle_readyflags_.begin(), angle_readyflags_.end(), 0);
 }
 
 } // namespace lbs
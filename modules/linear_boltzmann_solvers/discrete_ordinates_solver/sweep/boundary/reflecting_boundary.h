@@ -18,22 +18,41 @@ protected:
   const opensn::Normal normal_;
   bool opposing_reflected_ = false;
 
-  /// Groups per DOF
-  typedef std::vector<double> DOFVec;
-  /// DOFs per face
-  typedef std::vector<DOFVec> FaceVec;
-  /// Faces per cell
-  typedef std::vector<FaceVec> CellVec;
-  /// Cell per angle
-  typedef std::vector<CellVec> AngVec;
-
-  // angle,cell,face,dof,group
-  // Populated by angle aggregation
-  std::vector<AngVec> boundary_flux_;
-  std::vector<AngVec> boundary_flux_old_;
+  // Boundary fluxes of all outgoing angles, stored contiguously in
+  // angle, cell, face, node, group order. Populated by angle aggregation.
+  std::vector<double> boundary_flux_;
+  std::vector<double> boundary_flux_old_;
+
+  /// Start of each angle's block in the flux vectors. Invalid for incoming angles.
+  std::vector<size_t> angle_offsets_;
+  /// Per local cell, the start of its faces in face_node_offsets_
+  std::vector<size_t> cell_face_offsets_;
+  /// Per face of a boundary cell, the index of its first boundary node
+  std::vector<size_t> face_node_offsets_;
+  /// Number of boundary nodes per angle
+  size_t num_face_nodes_ = 0;
+  /// Number of groups stored per boundary node
+  size_t num_flux_groups_ = 0;
 
   std::vector<int> reflected_anglenum_;
-  std::vector<std::vector<bool>> angle_readyflags_;
+  /// Ready flag per group subset and angle, indexed gs_ss * num_angles_ + n
+  std::vector<char> angle_readyflags_;
+  size_t num_angles_ = 0;
+
+  static constexpr size_t INVALID_OFFSET = std::numeric_limits<size_t>::max();
+
+  /**
+   * Returns the index of the first group of node `fi` of face `face_num` of the
+   * given cell for angle `angle_num`.
+   */
+  size_t FluxIndex(uint64_t cell_local_id,
+                   unsigned int face_num,
+                   unsigned int fi,
+                   unsigned int angle_num) const
+  {
+    const size_t node = face_node_offsets_[cell_face_offsets_[cell_local_id] + face_num] + fi;
+    return angle_offsets_[angle_num] + node * num_flux_groups_;
+  }
 
 public:
   ReflectingBoundary(size_t num_groups,
@@ -49,13 +68,21 @@ public:
 
   void SetOpposingReflected(bool value) { opposing_reflected_ = value; }
 
-  std::vector<AngVec>& GetBoundaryFluxNew() { return boundary_flux_; }
+  std::vector<double>& GetBoundaryFluxNew() { return boundary_flux_; }
 
-  std::vector<AngVec>& GetBoundaryFluxOld() { return boundary_flux_old_; }
+  std::vector<double>& GetBoundaryFluxOld() { return boundary_flux_old_; }
 
   std::vector<int>& GetReflectedAngleIndexMap() { return reflected_anglenum_; }
 
-  std::vector<std::vector<bool>>& GetAngleReadyFlags() { return angle_readyflags_; }
+  /**
+   * Allocates zeroed flux storage for every outgoing angle on the boundary
+   * faces of the local cells and clears the angle ready flags. Only faces
+   * without a neighbor that are aligned with the boundary normal get storage.
+   */
+  void InitializeStorage(const MeshContinuum& grid,
+                         const std::vector<Vector3>& omegas,
+                         size_t num_groups,
+                         size_t num_group_subsets);
 
   double* PsiIncoming(uint64_t cell_local_id,
                       unsigned int face_num,
@@ -75,7 +102,14 @@ public:
   bool CheckAnglesReadyStatus(const std::vector<size_t>& angles, size_t gs_ss) override;
 
   /**
-   * Resets angle ready flags to false.
+   * Returns the number of bytes allocated for the boundary fluxes and their
+   * addressing data.
+   */
+  size_t ComputeMemoryUsage() const;
+
+  /**
+   * Resets angle ready flags to false. For opposing reflecting boundaries the
+   * new fluxes are also copied to the old ones, which are read by the next sweep.
    */
   void ResetAnglesReadyStatus();
 };
@@ -251,6 +251,7 @@ AAH_ASynchronousCommunicator::ReceiveDelayedData(int angle_set_num)
         size_t block_addr = delayed_prelocI_message_blockpos_[prelocI][m];
         size_t message_size = delayed_prelocI_message_size_[prelocI][m];
         comm.recv(source_rank, tag, &upstream_psi[block_addr], message_size);
+        bytes_received_[locJ] += message_size * sizeof(double);
 
         delayed_prelocI_message_received_[prelocI][m] = true;
       } // if not message already received
@@ -300,6 +301,7 @@ AAH_ASynchronousCommunicator::ReceiveUpstreamPsi(int angle_set_num)
         size_t block_addr = prelocI_message_blockpos_[prelocI][m];
         size_t message_size = prelocI_message_size_[prelocI][m];
         comm.recv(source, tag, &upstream_psi[block_addr], message_size);
+        bytes_received_[locJ] += message_size * sizeof(double);
 
         prelocI_message_received_[prelocI][m] = true;
       } // if not message already received
@@ -333,6 +335,7 @@ AAH_ASynchronousCommunicator::SendDownstreamPsi(int angle_set_num)
       auto tag = max_num_messages_ * angle_set_num + m;
       deplocI_message_request_[deplocI][m] =
         comm.isend(dest, tag, &outgoing_psi[block_addr], message_size);
+      bytes_sent_[locJ] += message_size * sizeof(double);
     } // for message
   }   // for deplocI
 }
@@ -2,6 +2,7 @@
 
 #include "framework/logging/log.h"
 
+#include <map>
 #include <vector>
 #include <cstddef>
 #include <cstdint>
@@ -35,9 +36,24 @@ public:
     OpenSnLogicalError("Method not implemented");
   }
 
+  /**Returns the number of bytes sent to each location since the last reset.*/
+  const std::map<int, uint64_t>& BytesSent() const { return bytes_sent_; }
+
+  /**Returns the number of bytes received from each location since the last reset.*/
+  const std::map<int, uint64_t>& BytesReceived() const { return bytes_received_; }
+
+  /**Zeroes the byte counts.*/
+  void ResetByteCounts()
+  {
+    bytes_sent_.clear();
+    bytes_received_.clear();
+  }
+
 protected:
   FLUDS& fluds_;
   const MPICommunicatorSet& comm_set_;
+  std::map<int, uint64_t> bytes_sent_;
+  std::map<int, uint64_t> bytes_received_;
 };
 
 } // namespace lbs
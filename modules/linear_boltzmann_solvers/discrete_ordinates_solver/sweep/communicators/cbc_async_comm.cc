@@ -71,6 +71,7 @@ CBC_ASynchronousCommunicator::SendData()
       auto dest = comm_set_.MapIonJ(locJ, locJ);
       auto tag = static_cast<int>(angle_set_id_);
       buffer_item.mpi_request_ = comm.isend(dest, tag, buffer_item.data_array_.Data());
+      bytes_sent_[locJ] += buffer_item.data_array_.Size();
       buffer_item.send_initiated_ = true;
     }
 
@@ -105,6 +106,7 @@ CBC_ASynchronousCommunicator::ReceiveData()
       int num_items = status.get_count<std::byte>();
       std::vector<std::byte> recv_buffer(num_items);
       comm.recv(source_rank, status.tag(), recv_buffer.data(), num_items);
+      bytes_received_[locJ] += num_items;
       ByteArray data_array(recv_buffer);
 
       while (not data_array.EndOfBuffer())
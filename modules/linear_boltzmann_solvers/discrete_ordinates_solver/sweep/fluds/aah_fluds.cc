@@ -2,6 +2,10 @@
 #include "framework/logging/log.h"
 #include "framework/math/math.h"
 #include "framework/runtime.h"
+#include "framework/memory_usage.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace opensn
 {
@@ -255,6 +259,30 @@ AAH_FLUDS::DelayedLocalPsiOld()
   return delayed_local_psi_old_;
 }
 
+double
+AAH_FLUDS::UpdateLocalCycleBlockPsi(const size_t block)
+{
+  const auto& [slot_begin, slot_end] = common_data_.local_cycle_block_delayed_slots[block];
+  const size_t slot_size = common_data_.delayed_local_psi_stride * num_groups_;
+
+  double max_change = 0.0;
+  for (size_t n = 0; n < num_angles_; ++n)
+  {
+    const size_t begin = delayed_local_psi_Gn_block_strideG * n + slot_begin * slot_size;
+    const size_t end = delayed_local_psi_Gn_block_strideG * n + slot_end * slot_size;
+    for (size_t i = begin; i < end; ++i)
+    {
+      const double change = std::fabs(delayed_local_psi_[i] - delayed_local_psi_old_[i]);
+      if (change > 0.0)
+        max_change = std::max(max_change,
+                              change / std::max(std::fabs(delayed_local_psi_[i]),
+                                                std::numeric_limits<double>::min()));
+      delayed_local_psi_old_[i] = delayed_local_psi_[i];
+    }
+  }
+  return max_change;
+}
+
 std::vector<std::vector<double>>&
 AAH_FLUDS::DeplocIOutgoingPsi()
 {
@@ -278,5 +306,16 @@ AAH_FLUDS::DelayedPrelocIOutgoingPsiOld()
   return delayed_prelocI_outgoing_psi_old_;
 }
 
+size_t
+AAH_FLUDS::ComputeMemoryUsage() const
+{
+  return VectorMemoryUsage(local_psi_Gn_block_strideG) + VectorMemoryUsage(local_psi_) +
+         VectorMemoryUsage(delayed_local_psi_) + VectorMemoryUsage(delayed_local_psi_old_) +
+         VectorMemoryUsage(deplocI_outgoing_psi_) + VectorMemoryUsage(prelocI_outgoing_psi_) +
+         VectorMemoryUsage(boundryI_incoming_psi_) +
+         VectorMemoryUsage(delayed_prelocI_outgoing_psi_) +
+         VectorMemoryUsage(delayed_prelocI_outgoing_psi_old_);
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -77,12 +77,19 @@ public:
   std::vector<double>& DelayedLocalPsi() override;
   std::vector<double>& DelayedLocalPsiOld() override;
 
+  /**Copies the delayed local psi written by the cells of the given local
+   * cycle block to the old delayed local psi read by them, and returns the
+   * largest relative change of these values.*/
+  double UpdateLocalCycleBlockPsi(size_t block);
+
   std::vector<std::vector<double>>& DeplocIOutgoingPsi() override;
 
   std::vector<std::vector<double>>& PrelocIOutgoingPsi() override;
 
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsi() override;
   std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() override;
+
+  size_t ComputeMemoryUsage() const override;
 };
 
 } // namespace lbs
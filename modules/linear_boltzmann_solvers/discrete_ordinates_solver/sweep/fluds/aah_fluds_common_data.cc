@@ -55,6 +55,14 @@ AAH_FLUDSCommonData::InitializeAlphaElements(const SPDS& spds,
   LockBox delayed_lock_box;
   std::set<int> location_boundary_dependency_set;
 
+  // The cells of a local cycle block may be swept several times, so the slots
+  // they read from are only released once the whole block has been processed.
+  const auto& local_cycle_blocks = spds.GetLocalCycleBlocks();
+  size_t next_block = 0;
+  std::vector<std::pair<size_t, size_t>> deferred_slot_releases;
+  size_t block_delayed_slot_begin = 0;
+  local_cycle_block_delayed_slots.clear();
+
   // csoi = cell sweep order index
   so_cell_inco_face_face_category.reserve(spls.item_id.size());
   so_cell_outb_face_slot_indices.reserve(spls.item_id.size());
@@ -66,13 +74,28 @@ AAH_FLUDSCommonData::InitializeAlphaElements(const SPDS& spds,
 
     local_so_cell_mapping[cell.local_id_] = csoi; // Set mapping
 
+    const bool in_block = next_block < local_cycle_blocks.size() and
+                          csoi >= local_cycle_blocks[next_block].first;
+    if (in_block and csoi == local_cycle_blocks[next_block].first)
+      block_delayed_slot_begin = delayed_lock_box.size();
+
     SlotDynamics(cell,
                  spds,
                  grid_face_histogram,
                  lock_boxes,
                  delayed_lock_box,
-                 location_boundary_dependency_set);
+                 location_boundary_dependency_set,
+                 in_block ? &deferred_slot_releases : nullptr);
 
+    if (in_block and csoi + 1 == local_cycle_blocks[next_block].second)
+    {
+      for (const auto& [face_categ, k] : deferred_slot_releases)
+        lock_boxes[face_categ][k] = {-1, -1};
+      deferred_slot_releases.clear();
+      local_cycle_block_delayed_slots.emplace_back(block_delayed_slot_begin,
+                                                   delayed_lock_box.size());
+      ++next_block;
+    }
   } // for csoi
 
   log.Log(Logger::LOG_LVL::LOG_0VERBOSE_2) << "Done with Slot Dynamics.";
@@ -126,7 +149,8 @@ AAH_FLUDSCommonData::SlotDynamics(const Cell& cell,
                                   const GridFaceHistogram& grid_face_histogram,
                                   std::vector<std::vector<std::pair<int, short>>>& lock_boxes,
                                   std::vector<std::pair<int, short>>& delayed_lock_box,
-                                  std::set<int>& location_boundary_dependency_set)
+                                  std::set<int>& location_boundary_dependency_set,
+                                  std::vector<std::pair<size_t, size_t>>* deferred_slot_releases)
 {
   const MeshContinuum& grid = spds.Grid();
 
@@ -187,12 +211,22 @@ AAH_FLUDSCommonData::SlotDynamics(const Cell& cell,
 
         // Now find the cell (index,face) pair in the lock box and empty slot
         bool found = false;
-        for (auto& lock_box_slot : lock_box)
+        for (size_t k = 0; k < lock_box.size(); ++k)
         {
+          auto& lock_box_slot = lock_box[k];
           if ((lock_box_slot.first == face.neighbor_id_) and (lock_box_slot.second == ass_face))
           {
-            lock_box_slot.first = -1;
-            lock_box_slot.second = -1;
+            if (deferred_slot_releases)
+            {
+              // Mark the slot as read so that it is not found again
+              lock_box_slot.second = -1;
+              deferred_slot_releases->emplace_back(face_categ, k);
+            }
+            else
+            {
+              lock_box_slot.first = -1;
+              lock_box_slot.second = -1;
+            }
             found = true;
             break;
           }
@@ -66,6 +66,9 @@ protected:
   std::vector<size_t> local_psi_Gn_block_strideG;
   size_t delayed_local_psi_Gn_block_stride = 0;
   size_t delayed_local_psi_Gn_block_strideG = 0;
+  /// Range [begin, end) of delayed local psi slots written by the cells of
+  /// each local cycle block of the SPDS
+  std::vector<std::pair<size_t, size_t>> local_cycle_block_delayed_slots;
 
   /// Very small vector listing the boundaries this location depends on
   std::vector<int> boundary_dependencies;
@@ -143,7 +146,8 @@ private:
                     const GridFaceHistogram& grid_face_histogram,
                     std::vector<std::vector<std::pair<int, short>>>& lock_boxes,
                     std::vector<std::pair<int, short>>& delayed_lock_box,
-                    std::set<int>& location_boundary_dependency_set);
+                    std::set<int>& location_boundary_dependency_set,
+                    std::vector<std::pair<size_t, size_t>>* deferred_slot_releases);
 
   /**
    * Given a sweep ordering index, the outgoing face counter, the outgoing face dof, this function
@@ -2,6 +2,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/memory_usage.h"
 
 namespace opensn
 {
@@ -58,5 +59,21 @@ CBC_FLUDS::GetNonLocalUpwindPsi(const std::vector<double>& psi_data,
   return &psi_data[dof_map];
 }
 
+size_t
+CBC_FLUDS::ComputeMemoryUsage() const
+{
+  size_t bytes = VectorMemoryUsage(delayed_local_psi_) +
+                 VectorMemoryUsage(delayed_local_psi_old_) +
+                 VectorMemoryUsage(deplocI_outgoing_psi_) +
+                 VectorMemoryUsage(prelocI_outgoing_psi_) +
+                 VectorMemoryUsage(boundryI_incoming_psi_) +
+                 VectorMemoryUsage(delayed_prelocI_outgoing_psi_) +
+                 VectorMemoryUsage(delayed_prelocI_outgoing_psi_old_) +
+                 MapMemoryUsage(deplocs_outgoing_messages_);
+  for (const auto& [key, message] : deplocs_outgoing_messages_)
+    bytes += VectorMemoryUsage(message);
+  return bytes;
+}
+
 } // namespace lbs
 } // namespace opensn
@@ -78,6 +78,9 @@ public:
     return deplocs_outgoing_messages_;
   }
 
+  /**The local psi data is owned by the solver and not included.*/
+  size_t ComputeMemoryUsage() const override;
+
 private:
   const CBC_FLUDSCommonData& common_data_;
   std::reference_wrapper<std::vector<double>> local_psi_data_;
@@ -52,6 +52,10 @@ public:
 
   virtual std::vector<std::vector<double>>& DelayedPrelocIOutgoingPsiOld() = 0;
 
+  /**Returns the number of bytes allocated for the angular flux buffers of
+   * this FLUDS, excluding data shared with other angle sets.*/
+  virtual size_t ComputeMemoryUsage() const { return 0; }
+
   virtual ~FLUDS() = default;
 
 protected:
@@ -2,6 +2,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/spds/spds_adams_adams_hawkins.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/boundary/reflecting_boundary.h"
 #include "framework/logging/log.h"
+#include "framework/utils/timer.h"
 #include "framework/runtime.h"
 #include <sstream>
 #include <algorithm>
@@ -46,6 +47,9 @@ SweepScheduler::SweepScheduler(SchedulingAlgorithm scheduler_type,
   for (auto& angsetgrp : angle_agg.angle_set_groups)
     for (auto& angset : angsetgrp.AngleSets())
       angset->SetMaxBufferMessages(global_max_num_messages);
+
+  // Angle sets may have been swept by other schedulers, e.g., during autotuning
+  ResetSweepStatistics();
 }
 
 SweepChunk&
@@ -315,10 +319,13 @@ SweepScheduler::ScheduleAlgoFIFO(SweepChunk& sweep_chunk)
 void
 SweepScheduler::Sweep()
 {
+  Timer sweep_timer;
   if (scheduler_type_ == SchedulingAlgorithm::FIRST_IN_FIRST_OUT)
     ScheduleAlgoFIFO(sweep_chunk_);
   else if (scheduler_type_ == SchedulingAlgorithm::DEPTH_OF_GRAPH)
     ScheduleAlgoDOG(sweep_chunk_);
+  sweep_time_ += sweep_timer.GetTime();
+  ++num_sweeps_;
 }
 
 double
@@ -347,6 +354,41 @@ SweepScheduler::GetAngleSetTimings()
   return info;
 }
 
+SweepStatistics
+SweepScheduler::GetSweepStatistics() const
+{
+  SweepStatistics stats;
+  stats.num_sweeps = num_sweeps_;
+  stats.sweep_time = sweep_time_;
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+    {
+      const auto& counters = angle_set->GetCounters();
+      stats.compute_time += counters.compute_time;
+      stats.wait_time += counters.wait_time;
+      stats.send_time += counters.send_time;
+      stats.num_cell_angle_group_solves += counters.num_cell_angle_group_solves;
+      stats.angle_set_idle_time.push_back(std::max(sweep_time_ - counters.compute_time, 0.0));
+
+      const auto* comm = angle_set->GetCommunicator();
+      for (const auto& [location, num_bytes] : comm->BytesSent())
+        stats.bytes_sent[location] += num_bytes;
+      for (const auto& [location, num_bytes] : comm->BytesReceived())
+        stats.bytes_received[location] += num_bytes;
+    }
+  return stats;
+}
+
+void
+SweepScheduler::ResetSweepStatistics()
+{
+  num_sweeps_ = 0;
+  sweep_time_ = 0.0;
+  for (auto& angle_set_group : angle_agg_.angle_set_groups)
+    for (auto& angle_set : angle_set_group.AngleSets())
+      angle_set->ResetCounters();
+}
+
 void
 SweepScheduler::SetDestinationPhi(std::vector<double>& destination_phi)
 {
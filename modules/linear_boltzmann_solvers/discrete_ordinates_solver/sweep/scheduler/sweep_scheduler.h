@@ -52,6 +52,9 @@ private:
   const size_t sweep_event_tag_;
   const std::vector<size_t> sweep_timing_events_tag_;
 
+  size_t num_sweeps_ = 0;
+  double sweep_time_ = 0.0;
+
 public:
   SweepScheduler(SchedulingAlgorithm scheduler_type,
                  AngleAggregation& angle_agg,
@@ -79,6 +82,17 @@ public:
    */
   std::vector<double> GetAngleSetTimings();
 
+  /**
+   * Returns the performance counters of this process accumulated over the sweeps
+   * since construction or the last call to ResetSweepStatistics.
+   */
+  SweepStatistics GetSweepStatistics() const;
+
+  /**
+   * Zeroes the sweep performance counters of the scheduler and its angle sets.
+   */
+  void ResetSweepStatistics();
+
   /**
    * Returns the referenced sweep chunk.
    */
@@ -141,6 +141,41 @@ SPDS::PopulateCellRelationships(const Vector3& omega,
   }
 
   // Make directed connections
+  const auto& face_table = grid_.GetFaceTable();
+  if (not face_table.Empty())
+  {
+    // Packed meshes carry face areas and neighbor locality in the face table,
+    // which avoids the per-face map lookups below
+    const size_t num_local_cells = face_table.NumCells();
+    for (uint64_t c = 0; c < num_local_cells; ++c)
+    {
+      const auto& face_oris = cell_face_orientations_[c];
+      const size_t face_begin = face_table.face_offsets[c];
+      const size_t num_faces = face_table.NumFaces(c);
+      for (size_t f = 0; f < num_faces; ++f)
+      {
+        const size_t fi = face_begin + f;
+        if (not face_table.has_neighbor[fi])
+          continue;
+
+        if (face_oris[f] == FOOUTGOING)
+        {
+          if (face_table.IsNeighborLocal(fi))
+          {
+            const double weight = omega.Dot(face_table.normals[fi]) * face_table.areas[fi];
+            cell_successors[c].insert(
+              std::make_pair(face_table.neighbor_local_ids[fi], weight));
+          }
+          else
+            location_successors.insert(face_table.neighbor_partition_ids[fi]);
+        }
+        else if (not face_table.IsNeighborLocal(fi))
+          location_dependencies.insert(face_table.neighbor_partition_ids[fi]);
+      }
+    }
+    return;
+  }
+
   for (auto& cell : grid_.local_cells)
   {
     const uint64_t c = cell.local_id_;
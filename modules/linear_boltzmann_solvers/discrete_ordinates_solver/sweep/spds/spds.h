@@ -30,6 +30,13 @@ public:
   {
     return local_cyclic_dependencies_;
   }
+  /**Returns the sweep-order index ranges [begin, end) of the cells of each
+   * local strongly connected component. The cells of a component are
+   * contiguous in the sweep ordering.*/
+  const std::vector<std::pair<size_t, size_t>>& GetLocalCycleBlocks() const
+  {
+    return local_cycle_blocks_;
+  }
   const std::vector<std::vector<FaceOrientation>>& CellFaceOrientations() const
   {
     return cell_face_orientations_;
@@ -55,6 +62,7 @@ protected:
   std::vector<int> delayed_location_successors_;
 
   std::vector<std::pair<int, int>> local_cyclic_dependencies_;
+  std::vector<std::pair<size_t, size_t>> local_cycle_blocks_;
 
   std::vector<std::vector<FaceOrientation>> cell_face_orientations_;
 
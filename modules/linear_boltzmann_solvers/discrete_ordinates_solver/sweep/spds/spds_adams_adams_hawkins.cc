@@ -14,6 +14,7 @@ namespace lbs
 SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
                                                const MeshContinuum& grid,
                                                bool cycle_allowance_flag,
+                                               bool resolve_local_cycles,
                                                bool verbose)
   : SPDS(omega, grid, verbose)
 {
@@ -55,10 +56,13 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
   if (verbose_)
     PrintedGhostedGraph();
 
+  std::vector<std::vector<size_t>> local_sccs;
   if (cycle_allowance_flag)
   {
     log.Log0Verbose1() << program_timer.GetTimeString() << " Removing inter-cell cycles.";
 
+    if (resolve_local_cycles)
+      local_sccs = local_DG.FindStronglyConnectedComponents();
     auto edges_to_remove = local_DG.RemoveCyclicDependencies();
 
     for (auto& edge_to_remove : edges_to_remove)
@@ -71,6 +75,8 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
   log.Log0Verbose1() << program_timer.GetTimeString()
                      << " Generating topological sorting for local sweep ordering";
   auto so_temp = local_DG.GenerateTopologicalSort();
+  if (not local_sccs.empty() and not so_temp.empty())
+    so_temp = MakeLocalCycleBlocksContiguous(so_temp, local_sccs, cell_successors);
   spls_.item_id.clear();
   for (auto v : so_temp)
     spls_.item_id.emplace_back(v);
@@ -106,6 +112,80 @@ SPDS_AdamsAdamsHawkins::SPDS_AdamsAdamsHawkins(const Vector3& omega,
   log.Log0Verbose1() << program_timer.GetTimeString() << " Done computing sweep ordering.\n\n";
 }
 
+std::vector<size_t>
+SPDS_AdamsAdamsHawkins::MakeLocalCycleBlocksContiguous(
+  const std::vector<size_t>& sweep_order,
+  const std::vector<std::vector<size_t>>& local_sccs,
+  const std::vector<std::set<std::pair<int, double>>>& cell_successors)
+{
+  // Condensed graph with a vertex per strongly connected component followed by
+  // a vertex per remaining cell
+  const size_t num_loc_cells = sweep_order.size();
+  const size_t num_sccs = local_sccs.size();
+  std::vector<size_t> cell_vertex(num_loc_cells, 0);
+  std::vector<bool> in_scc(num_loc_cells, false);
+  for (size_t s = 0; s < num_sccs; ++s)
+    for (const size_t c : local_sccs[s])
+    {
+      cell_vertex[c] = s;
+      in_scc[c] = true;
+    }
+  size_t num_vertices = num_sccs;
+  for (size_t c = 0; c < num_loc_cells; ++c)
+    if (not in_scc[c])
+      cell_vertex[c] = num_vertices++;
+
+  DirectedGraph condensed_DG;
+  for (size_t v = 0; v < num_vertices; ++v)
+    condensed_DG.AddVertex();
+  for (size_t c = 0; c < num_loc_cells; ++c)
+    for (const auto& successor : cell_successors[c])
+    {
+      const size_t u = cell_vertex[c];
+      const size_t v = cell_vertex[successor.first];
+      if (u != v)
+        condensed_DG.AddEdge(u, v, successor.second);
+    }
+
+  const auto condensed_order = condensed_DG.GenerateTopologicalSort();
+  OpenSnLogicalErrorIf(condensed_order.size() != num_vertices,
+                       "Failed to sort the condensed local sweep graph.");
+
+  // Cells of a component keep their relative position in the original sorting,
+  // which respects the remaining intra-component dependencies.
+  std::vector<size_t> sweep_order_position(num_loc_cells, 0);
+  for (size_t k = 0; k < num_loc_cells; ++k)
+    sweep_order_position[sweep_order[k]] = k;
+
+  std::vector<size_t> vertex_cell(num_vertices, 0);
+  for (size_t c = 0; c < num_loc_cells; ++c)
+    if (not in_scc[c])
+      vertex_cell[cell_vertex[c]] = c;
+
+  std::vector<size_t> new_sweep_order;
+  new_sweep_order.reserve(num_loc_cells);
+  local_cycle_blocks_.clear();
+  for (const size_t v : condensed_order)
+  {
+    if (v >= num_sccs)
+    {
+      new_sweep_order.push_back(vertex_cell[v]);
+      continue;
+    }
+
+    auto scc_cells = local_sccs[v];
+    std::sort(scc_cells.begin(),
+              scc_cells.end(),
+              [&sweep_order_position](size_t a, size_t b)
+              { return sweep_order_position[a] < sweep_order_position[b]; });
+    local_cycle_blocks_.emplace_back(new_sweep_order.size(),
+                                     new_sweep_order.size() + scc_cells.size());
+    new_sweep_order.insert(new_sweep_order.end(), scc_cells.begin(), scc_cells.end());
+  }
+
+  return new_sweep_order;
+}
+
 void
 SPDS_AdamsAdamsHawkins::BuildTaskDependencyGraph(
   const std::vector<std::vector<int>>& global_dependencies, bool cycle_allowance_flag)
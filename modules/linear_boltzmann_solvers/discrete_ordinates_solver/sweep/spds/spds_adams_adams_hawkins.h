@@ -10,13 +10,25 @@ namespace lbs
 class SPDS_AdamsAdamsHawkins : public SPDS
 {
 public:
+  /**Builds the sweep ordering. If `resolve_local_cycles` is true, the cells
+   * of each local cycle are made contiguous in the local sweep ordering and
+   * the resulting local cycle blocks are recorded.*/
   SPDS_AdamsAdamsHawkins(const Vector3& omega,
                          const MeshContinuum& grid,
                          bool cycle_allowance_flag,
+                         bool resolve_local_cycles,
                          bool verbose);
   const std::vector<STDG>& GetGlobalSweepPlanes() const { return global_sweep_planes_; }
 
 private:
+  /**Reorders a topological sorting of the local cells such that the cells of
+   * each strongly connected component are contiguous, and records the
+   * resulting local cycle blocks.*/
+  std::vector<size_t> MakeLocalCycleBlocksContiguous(
+    const std::vector<size_t>& sweep_order,
+    const std::vector<std::vector<size_t>>& local_sccs,
+    const std::vector<std::set<std::pair<int, double>>>& cell_successors);
+
   /**Builds the task dependency graph.*/
   void BuildTaskDependencyGraph(const std::vector<std::vector<int>>& global_dependencies,
                                 bool cycle_allowance_flag);
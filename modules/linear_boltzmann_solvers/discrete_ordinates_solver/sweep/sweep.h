@@ -1,6 +1,7 @@
 #pragma once
 
 #include "framework/mesh/mesh.h"
+#include <map>
 #include <set>
 #include <memory>
 
@@ -37,6 +38,44 @@ struct Task
   bool completed_ = false;
 };
 
+/**Performance counters of the work an angle set did during sweeps. Times are in
+ * milliseconds. Waiting is any time spent in the angle set that is neither
+ * computing nor sending, e.g., polling for upstream or boundary data.*/
+struct AngleSetCounters
+{
+  double compute_time = 0.0;
+  double wait_time = 0.0;
+  double send_time = 0.0;
+  uint64_t num_cell_angle_group_solves = 0;
+};
+
+/**Performance counters accumulated over all sweeps of a sweep scheduler on the
+ * local process. Times are in milliseconds.*/
+struct SweepStatistics
+{
+  size_t num_sweeps = 0;
+  double sweep_time = 0.0;
+  double compute_time = 0.0;
+  double wait_time = 0.0;
+  double send_time = 0.0;
+  uint64_t num_cell_angle_group_solves = 0;
+  /// Bytes of angular flux data exchanged with each neighboring location
+  std::map<int, uint64_t> bytes_sent;
+  std::map<int, uint64_t> bytes_received;
+  /// Sweep time during which each angle set was not computing
+  std::vector<double> angle_set_idle_time;
+
+  /**Returns the number of cell-angle-group solves per second of sweep time.*/
+  double SolvesPerSecond() const
+  {
+    return sweep_time > 0.0 ? 1.0e3 * static_cast<double>(num_cell_angle_group_solves) / sweep_time
+                            : 0.0;
+  }
+
+  /**Accumulates the counters of another scheduler, e.g., of another groupset.*/
+  void Add(const SweepStatistics& other);
+};
+
 /**Sweep Plane Local Subgrid (“spills”), a contiguous collection of cells
  * that defines the lowest level in the SPDS hierarchy. The intent is that
  * the processing “locations” responsible for executing sweeps on this
@@ -0,0 +1,26 @@
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/sweep.h"
+
+namespace opensn
+{
+namespace lbs
+{
+
+void
+SweepStatistics::Add(const SweepStatistics& other)
+{
+  num_sweeps += other.num_sweeps;
+  sweep_time += other.sweep_time;
+  compute_time += other.compute_time;
+  wait_time += other.wait_time;
+  send_time += other.send_time;
+  num_cell_angle_group_solves += other.num_cell_angle_group_solves;
+  for (const auto& [location, num_bytes] : other.bytes_sent)
+    bytes_sent[location] += num_bytes;
+  for (const auto& [location, num_bytes] : other.bytes_received)
+    bytes_received[location] += num_bytes;
+  angle_set_idle_time.insert(
+    angle_set_idle_time.end(), other.angle_set_idle_time.begin(), other.angle_set_idle_time.end());
+}
+
+} // namespace lbs
+} // namespace opensn
@@ -1,6 +1,7 @@
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
 #include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/fluds/aah_fluds.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/logging/log.h"
 
 namespace opensn
 {
@@ -58,11 +59,12 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
                                      std::vector<double>(max_num_cell_dofs_));
   std::vector<double> source(max_num_cell_dofs_);
 
-  // Loop over each cell
+  // Sweeps a single cell. Cells of local cycle blocks are swept several times
+  // and only accumulate into the flux moments and outflows on the final pass.
   const auto& spds = angle_set.GetSPDS();
   const auto& spls = spds.GetSPLS().item_id;
   const size_t num_spls = spls.size();
-  for (size_t spls_index = 0; spls_index < num_spls; ++spls_index)
+  auto SweepCell = [&](const size_t spls_index, const bool accumulate)
   {
     auto cell_local_id = spls[spls_index];
     auto& cell = grid_.local_cells[cell_local_id];
@@ -77,6 +79,16 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
     const auto& rho = densities_[cell.local_id_];
     const auto& sigma_t = xs_.at(cell.material_id_)->SigmaTotal();
 
+    // Time-derivative terms
+    const double* cell_psi_old = nullptr;
+    const double* inv_velocity = nullptr;
+    if (psi_old_)
+    {
+      cell_psi_old =
+        &(*psi_old_)[discretization_.MapDOFLocal(cell, 0, groupset_.psi_uk_man_, 0, 0)];
+      inv_velocity = xs_.at(cell.material_id_)->InverseVelocity().data();
+    }
+
     // Get cell matrices
     const auto& G = unit_cell_matrices_[cell_local_id].intV_shapeI_gradshapeJ;
     const auto& M = unit_cell_matrices_[cell_local_id].intV_shapeI_shapeJ;
@@ -177,6 +189,19 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
           source[i] = temp_src;
         }
 
+        // Time-derivative terms: tau = 1/(v theta dt) and, together with the
+        // fixed sources, the source tau * psi^n
+        if (cell_psi_old)
+        {
+          const double tau = inv_velocity[gs_gi + gsg] * inv_theta_dt_;
+          sigma_tg += tau;
+          if (IsSurfaceSourceActive())
+            for (int i = 0; i < cell_num_nodes; ++i)
+              source[i] += tau * cell_psi_old[i * groupset_angle_group_stride_ +
+                                              direction_num * groupset_group_stride_ +
+                                              gs_ss_begin + gsg];
+        }
+
         // Mass matrix and source
         // Atemp = Amat + sigma_tgr * M
         // b += M * q
@@ -197,15 +222,18 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
       } // for gsg
 
       // Update phi
-      auto& output_phi = GetDestinationPhi();
-      for (int m = 0; m < num_moments_; ++m)
+      if (accumulate)
       {
-        const double wn_d2m = d2m_op[m][direction_num];
-        for (int i = 0; i < cell_num_nodes; ++i)
+        auto& output_phi = GetDestinationPhi();
+        for (int m = 0; m < num_moments_; ++m)
         {
-          const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
-          for (int gsg = 0; gsg < gs_ss_size; ++gsg)
-            output_phi[ir + gsg] += wn_d2m * b[gsg][i];
+          const double wn_d2m = d2m_op[m][direction_num];
+          for (int i = 0; i < cell_num_nodes; ++i)
+          {
+            const size_t ir = cell_transport_view.MapDOF(i, m, gs_gi);
+            for (int gsg = 0; gsg < gs_ss_size; ++gsg)
+              output_phi[ir + gsg] += wn_d2m * b[gsg][i];
+          }
         }
       }
 
@@ -249,7 +277,7 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         {
           const int i = cell_mapping.MapFaceNode(f, fi);
 
-          if (is_boundary_face and not is_reflecting_boundary_face)
+          if (is_boundary_face and not is_reflecting_boundary_face and accumulate)
           {
             for (int gsg = 0; gsg < gs_ss_size; ++gsg)
               cell_transport_view.AddOutflow(gs_gi + gsg,
@@ -275,7 +303,58 @@ AahSweepChunk::Sweep(AngleSet& angle_set)
         } // for fi
       }   // for face
     }     // for angleset/subset
-  }       // for cell
+  };
+
+  // Loop over each cell
+  const auto& local_cycle_blocks = spds.GetLocalCycleBlocks();
+  const bool resolve_local_cycles = groupset_.resolve_local_cycles_;
+  size_t next_block = 0;
+  for (size_t spls_index = 0; spls_index < num_spls;)
+  {
+    if (not resolve_local_cycles or next_block >= local_cycle_blocks.size() or
+        spls_index != local_cycle_blocks[next_block].first)
+    {
+      SweepCell(spls_index++, true);
+      continue;
+    }
+
+    // Sub-iterate the cells of the block on their delayed local psi until it
+    // converges, then sweep them a final time to accumulate the results.
+    const auto [block_begin, block_end] = local_cycle_blocks[next_block];
+    const int block_deploc_face_counter = deploc_face_counter;
+    const int block_preloc_face_counter = preloc_face_counter;
+    bool converged = false;
+    double change = 0.0;
+    for (int it = 0; it < groupset_.local_cycle_max_iterations_ and not converged; ++it)
+    {
+      deploc_face_counter = block_deploc_face_counter;
+      preloc_face_counter = block_preloc_face_counter;
+      for (size_t k = block_begin; k < block_end; ++k)
+        SweepCell(k, false);
+      change = fluds.UpdateLocalCycleBlockPsi(next_block);
+      converged = change < groupset_.local_cycle_tolerance_;
+    }
+
+    // Reported once per sweep chunk, the sweep itself continues
+    if (not converged and not warned_local_cycle_max_its_)
+    {
+      log.LogAllWarning() << "Local cycle sub-iterations of groupset " << groupset_.id_
+                          << " reached local_cycle_max_its="
+                          << groupset_.local_cycle_max_iterations_
+                          << " without converging. Relative change " << change
+                          << " is above local_cycle_tol=" << groupset_.local_cycle_tolerance_
+                          << ". Further occurrences are not reported.";
+      warned_local_cycle_max_its_ = true;
+    }
+
+    deploc_face_counter = block_deploc_face_counter;
+    preloc_face_counter = block_preloc_face_counter;
+    for (size_t k = block_begin; k < block_end; ++k)
+      SweepCell(k, true);
+
+    spls_index = block_end;
+    ++next_block;
+  }
 }
 
 } // namespace lbs
@@ -26,6 +26,10 @@ public:
                 int max_num_cell_dofs);
 
   void Sweep(AngleSet& angle_set) override;
+
+private:
+  /// Whether unconverged local cycle sub-iterations have been reported
+  bool warned_local_cycle_max_its_ = false;
 };
 
 } // namespace lbs
@@ -103,6 +103,16 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
   const auto& rho = densities_[cell_local_id_];
   const auto& sigma_t = xs_.at(cell_->material_id_)->SigmaTotal();
 
+  // Time-derivative terms
+  const double* cell_psi_old = nullptr;
+  const double* inv_velocity = nullptr;
+  if (psi_old_)
+  {
+    cell_psi_old =
+      &(*psi_old_)[discretization_.MapDOFLocal(*cell_, 0, groupset_.psi_uk_man_, 0, 0)];
+    inv_velocity = xs_.at(cell_->material_id_)->InverseVelocity().data();
+  }
+
   // as = angle set
   // ss = subset
   const std::vector<size_t>& as_angle_indices = angle_set.GetAngleIndices();
@@ -211,6 +221,19 @@ CbcSweepChunk::Sweep(AngleSet& angle_set)
         source[i] = temp_src;
       }
 
+      // Time-derivative terms: tau = 1/(v theta dt) and, together with the
+      // fixed sources, the source tau * psi^n
+      if (cell_psi_old)
+      {
+        const double tau = inv_velocity[gs_gi_ + gsg] * inv_theta_dt_;
+        sigma_tg += tau;
+        if (surface_source_active_)
+          for (int i = 0; i < cell_num_nodes_; ++i)
+            source[i] += tau * cell_psi_old[i * groupset_angle_group_stride_ +
+                                            direction_num * groupset_group_stride_ +
+                                            gs_ss_begin_ + gsg];
+      }
+
       // Mass matrix and source
       // Atemp = Amat + sigma_tgr * M
       // b += M * q
@@ -67,6 +67,21 @@ public:
   /**For cell-by-cell methods or computing the residual on a single cell.*/
   virtual void SetCell(Cell const* cell_ptr, AngleSet& angle_set) {}
 
+  /**
+   * Adds the time-derivative terms of a theta-scheme step to the sweep. The
+   * sweep then solves for \f$ \psi^{n+\theta} \f$ with the additional
+   * collision term \f$ \tau_g = 1/(v_g \theta \Delta t) \f$ and the source
+   * \f$ \tau_g \psi^n \f$. Like the boundary sources, the source is only
+   * applied when fixed sources are active. `psi_old` must have the layout of
+   * the destination angular flux and must outlive the sweep chunk. Passing
+   * `nullptr` removes the terms.
+   */
+  void SetTimeDependentTerms(const std::vector<double>* psi_old, double inv_theta_dt)
+  {
+    psi_old_ = psi_old;
+    inv_theta_dt_ = inv_theta_dt;
+  }
+
   virtual ~SweepChunk() = default;
 
 protected:
@@ -108,6 +123,8 @@ protected:
   const bool save_angular_flux_;
   const size_t groupset_angle_group_stride_;
   const size_t groupset_group_stride_;
+  const std::vector<double>* psi_old_ = nullptr;
+  double inv_theta_dt_ = 0.0;
 
 private:
   std::vector<double>* destination_phi;
@@ -163,5 +163,12 @@ DiscOrdTransientSolver::Advance()
   if (options_.use_precursors) precursor_prev_local_ = precursor_new_local_;
 }
 
+void
+DiscOrdTransientSolver::Repartition(const std::vector<int64_t>& cell_partition_ids)
+{
+  throw std::logic_error(TextName() + " keeps the previous time step vectors of the current "
+                                      "grid and cannot be repartitioned.");
+}
+
 } // namespace lbs
 #endif
@@ -58,6 +58,10 @@ public:
   void Step() override;
   void Advance() override;
 
+  /**Refuses to repartition. The previous time step and fission rate vectors
+   * are sized for the current grid and are not migrated.*/
+  void Repartition(const std::vector<int64_t>& cell_partition_ids) override;
+
   // Iterative operations
   std::shared_ptr<SweepChunk> SetTransientSweepChunk(LBSGroupset& groupset);
 
@@ -55,6 +55,7 @@ SteadyStateSolver::Execute()
   if (lbs_solver_.Options().adjoint)
     lbs_solver_.ReorientAdjointSolution();
 
+  lbs_solver_.FinishRestartWrites();
   lbs_solver_.UpdateFieldFunctions();
 }
 
@@ -2,7 +2,17 @@
 
 #include "framework/object_factory.h"
 
-#include "framework/math/time_integrations/time_integration.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/math/time_integrations/theta_scheme_time_intgr.h"
+#include "framework/physics/time_steppers/time_stepper.h"
+#include "framework/event_system/physics_event_publisher.h"
+#include "framework/logging/log.h"
+
+#include "modules/linear_boltzmann_solvers/lbs_solver/iterative_methods/ags_linear_solver.h"
+#include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/transient_source_function.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/iterative_methods/sweep_wgs_context.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/aah_sweep_chunk.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep_chunks/cbc_sweep_chunk.h"
 
 namespace opensn
 {
@@ -27,6 +37,13 @@ TransientSolver::GetInputParameters()
   params.AddRequiredParameter<size_t>("time_integration",
                                       "Handle to a time integration scheme to use");
 
+  params.AddOptionalParameter("solve_initial_state",
+                              false,
+                              "If true, the steady-state problem is solved to obtain the initial "
+                              "condition. Otherwise, the flux moments held by the lbs solver after "
+                              "initialization, e.g., restart data, are the initial condition and "
+                              "the initial angular fluxes are expanded from them.");
+
   return params;
 }
 
@@ -35,7 +52,8 @@ TransientSolver::TransientSolver(const InputParameters& params)
     lbs_solver_(
       GetStackItem<LBSSolver>(object_stack, params.GetParamValue<size_t>("lbs_solver_handle"))),
     time_integration_(GetStackItemPtrAsType<TimeIntegration>(
-      object_stack, params.GetParamValue<size_t>("time_integration")))
+      object_stack, params.GetParamValue<size_t>("time_integration"))),
+    solve_initial_state_(params.GetParamValue<bool>("solve_initial_state"))
 {
 }
 
@@ -43,21 +61,243 @@ void
 TransientSolver::Initialize()
 {
   lbs_solver_.Initialize();
+  lbs_solver_.BindExecutor(TextName());
+
+  const auto& options = lbs_solver_.Options();
+  OpenSnInvalidArgumentIf(not options.save_angular_flux,
+                          "The option `save_angular_flux` must be set to `true` for " +
+                            TextName() + ".");
+  OpenSnInvalidArgumentIf(options.use_src_moments,
+                          "Source moments are not supported by " + TextName() + ".");
+
+  const auto num_groups = lbs_solver_.Groups().size();
+  for (const auto& [mat_id, xs] : lbs_solver_.GetMatID2XSMap())
+    OpenSnInvalidArgumentIf(xs->InverseVelocity().size() != num_groups,
+                            "Material " + std::to_string(mat_id) +
+                              " does not provide inverse velocities, which are required by " +
+                              TextName() + ".");
+
+  switch (time_integration_->Method())
+  {
+    case SteppingMethod::IMPLICIT_EULER:
+      theta_ = 1.0;
+      break;
+    case SteppingMethod::CRANK_NICOLSON:
+      theta_ = 0.5;
+      break;
+    case SteppingMethod::THETA_SCHEME:
+    {
+      const auto theta_scheme =
+        std::dynamic_pointer_cast<ThetaSchemeTimeIntegration>(time_integration_);
+      OpenSnLogicalErrorIf(not theta_scheme, "Theta-scheme without a theta factor.");
+      theta_ = theta_scheme->ThetaFactor();
+      break;
+    }
+    default:
+      OpenSnInvalidArgument("Unsupported time integration scheme for " + TextName() + ".");
+  }
+
+  // The sweep chunks are created by the solver schemes and kept for the
+  // lifetime of the within-group solvers
+  const auto num_groupsets = lbs_solver_.GetWGSSolvers().size();
+  sweep_chunks_.clear();
+  for (size_t gs = 0; gs < num_groupsets; ++gs)
+  {
+    auto sweep_context = dynamic_cast<SweepWGSContext*>(&lbs_solver_.GetWGSContext(gs));
+    OpenSnInvalidArgumentIf(not sweep_context, TextName() + " requires a sweep based lbs solver.");
+
+    const auto& sweep_chunk = sweep_context->sweep_chunk_;
+    OpenSnInvalidArgumentIf(not std::dynamic_pointer_cast<AahSweepChunk>(sweep_chunk) and
+                              not std::dynamic_pointer_cast<CbcSweepChunk>(sweep_chunk),
+                            "The sweep chunk of groupset " + std::to_string(gs) +
+                              " does not support time-dependent terms.");
+    sweep_chunks_.push_back(sweep_chunk);
+  }
+
+  // Initial condition
+  if (solve_initial_state_)
+  {
+    auto& ags_solver = *lbs_solver_.GetPrimaryAGSSolver();
+    ags_solver.Setup();
+    ags_solver.Solve();
+  }
+  else
+  {
+    lbs_solver_.PhiNewLocal() = lbs_solver_.PhiOldLocal();
+    SetAngularFluxesFromMoments(lbs_solver_.PhiOldLocal());
+  }
+
+  if (options.use_precursors)
+    lbs_solver_.ComputePrecursors();
+
+  // The only copies of the solution vectors. From here on, the buffers are
+  // reused for every time step.
+  phi_prev_local_ = lbs_solver_.PhiNewLocal();
+  precursor_prev_local_ = lbs_solver_.PrecursorsNewLocal();
+  psi_prev_local_ = lbs_solver_.PsiNewLocal();
+
+  for (size_t gs = 0; gs < num_groupsets; ++gs)
+    sweep_chunks_[gs]->SetTimeDependentTerms(&psi_prev_local_[gs], 0.0);
+
+  // The solvers reference the active source function, so they pick up the
+  // delayed neutron treatment of the transient source function
+  using namespace std::placeholders;
+  auto src_function =
+    std::make_shared<TransientSourceFunction>(lbs_solver_, dt_, theta_, precursor_prev_local_);
+  lbs_solver_.SetActiveSetSourceFunction(
+    std::bind(&SourceFunction::operator(), src_function, _1, _2, _3, _4, _5));
 }
 
 void
 TransientSolver::Execute()
 {
+  auto& physics_ev_pub = PhysicsEventPublisher::GetInstance();
+
+  while (timestepper_->IsActive())
+  {
+    physics_ev_pub.SolverStep(*this);
+    physics_ev_pub.SolverAdvance(*this);
+  }
+
+  lbs_solver_.FinishRestartWrites();
+  lbs_solver_.UpdateFieldFunctions();
 }
 
 void
 TransientSolver::Step()
 {
+  log.Log() << "Solver \"" + TextName() + "\" " + timestepper_->StringTimeInfo();
+
+  dt_ = timestepper_->TimeStepSize();
+  for (size_t gs = 0; gs < sweep_chunks_.size(); ++gs)
+    sweep_chunks_[gs]->SetTimeDependentTerms(&psi_prev_local_[gs], 1.0 / (theta_ * dt_));
+
+  // Solve for the solution at t^{n+theta}
+  auto& phi_new = lbs_solver_.PhiNewLocal();
+  lbs_solver_.PhiOldLocal() = phi_prev_local_;
+
+  auto& ags_solver = *lbs_solver_.GetPrimaryAGSSolver();
+  ags_solver.Setup();
+  ags_solver.Solve();
+
+  // Extrapolate to t^{n+1}
+  const double inv_theta = 1.0 / theta_;
+  for (size_t i = 0; i < phi_new.size(); ++i)
+    phi_new[i] = inv_theta * (phi_new[i] + (theta_ - 1.0) * phi_prev_local_[i]);
+
+  auto& psi_new = lbs_solver_.PsiNewLocal();
+  for (size_t gs = 0; gs < psi_new.size(); ++gs)
+  {
+    auto& psi = psi_new[gs];
+    const auto& psi_prev = psi_prev_local_[gs];
+    for (size_t i = 0; i < psi.size(); ++i)
+      psi[i] = inv_theta * (psi[i] + (theta_ - 1.0) * psi_prev[i]);
+  }
+
+  if (lbs_solver_.Options().use_precursors)
+    StepPrecursors();
 }
 
 void
 TransientSolver::Advance()
 {
+  // The sweep chunks reference the vector objects, not their data, so
+  // swapping exchanges the buffers without invalidating them
+  auto& psi_new = lbs_solver_.PsiNewLocal();
+  for (size_t gs = 0; gs < psi_new.size(); ++gs)
+    psi_new[gs].swap(psi_prev_local_[gs]);
+
+  phi_prev_local_ = lbs_solver_.PhiNewLocal();
+  if (lbs_solver_.Options().use_precursors)
+    precursor_prev_local_ = lbs_solver_.PrecursorsNewLocal();
+
+  timestepper_->Advance();
+}
+
+void
+TransientSolver::SetAngularFluxesFromMoments(const std::vector<double>& phi)
+{
+  const auto& discretization = lbs_solver_.SpatialDiscretization();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto num_moments = lbs_solver_.NumMoments();
+  auto& psi_new = lbs_solver_.PsiNewLocal();
+
+  for (const auto& groupset : lbs_solver_.Groupsets())
+  {
+    auto& psi = psi_new[groupset.id_];
+    const auto& m2d_op = groupset.quadrature_->GetMomentToDiscreteOperator();
+    const size_t num_angles = groupset.quadrature_->omegas_.size();
+    const size_t num_gs_groups = groupset.groups_.size();
+    const int gs_gi = groupset.groups_.front().id_;
+
+    for (const auto& cell : lbs_solver_.Grid().local_cells)
+    {
+      const auto& transport_view = cell_transport_views[cell.local_id_];
+      for (int i = 0; i < transport_view.NumNodes(); ++i)
+        for (size_t n = 0; n < num_angles; ++n)
+          for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+          {
+            double value = 0.0;
+            for (size_t m = 0; m < num_moments; ++m)
+              value += m2d_op[m][n] *
+                       phi[transport_view.MapDOF(i, static_cast<int>(m), gs_gi + gsg)];
+            psi[discretization.MapDOFLocal(cell, i, groupset.psi_uk_man_, n, gsg)] = value;
+          }
+    }
+  }
+}
+
+void
+TransientSolver::StepPrecursors()
+{
+  const double eff_dt = theta_ * dt_;
+  const size_t J = lbs_solver_.MaxPrecursorsPerMaterial();
+  const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+  const auto& phi_new = lbs_solver_.PhiNewLocal();
+  auto& precursor_new = lbs_solver_.PrecursorsNewLocal();
+  const auto num_groups = lbs_solver_.Groups().size();
+
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& fe_values = unit_cell_matrices[cell.local_id_];
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const double cell_volume = transport_view.Volume();
+
+    // Obtain xs
+    const auto& xs = transport_view.XS();
+    const auto& precursors = xs.Precursors();
+    const auto& nu_delayed_sigma_f = xs.NuDelayedSigmaF();
+
+    // Delayed fission rate at t^{n+theta}
+    double delayed_fission = 0.0;
+    for (int i = 0; i < transport_view.NumNodes(); ++i)
+    {
+      const size_t uk_map = transport_view.MapDOF(i, 0, 0);
+      const double node_V_fraction = fe_values.intV_shapeI[i] / cell_volume;
+
+      for (size_t g = 0; g < num_groups; ++g)
+      {
+        const double phi_theta =
+          theta_ * phi_new[uk_map + g] + (1.0 - theta_) * phi_prev_local_[uk_map + g];
+        delayed_fission += nu_delayed_sigma_f[g] * phi_theta * node_V_fraction;
+      }
+    }
+
+    // Loop over precursors
+    for (size_t j = 0; j < xs.NumPrecursors(); ++j)
+    {
+      const size_t dof = cell.local_id_ * J + j;
+      const auto& precursor = precursors[j];
+      const double coeff = 1.0 / (1.0 + eff_dt * precursor.decay_constant);
+
+      // Precursors at t^{n+theta}, extrapolated to t^{n+1}
+      const double c_theta =
+        coeff * (precursor_prev_local_[dof] +
+                 eff_dt * precursor.fractional_yield * delayed_fission);
+      precursor_new[dof] = (c_theta + (theta_ - 1.0) * precursor_prev_local_[dof]) / theta_;
+    }
+  }
 }
 
 } // namespace lbs
@@ -8,12 +8,32 @@ class TimeIntegration;
 
 namespace lbs
 {
+class SweepChunk;
 
+/**
+ * Theta-scheme time-dependent solver for discrete ordinates solvers. The
+ * sweep chunks, within-group and across-groupset solvers and the DSA
+ * operators of the lbs solver are created once and reused for all time steps.
+ * Each sweep solves for the solution at \f$ t^{n+\theta} \f$, with the
+ * time-derivative terms added inside the sweep kernel, after which the
+ * solution at \f$ t^{n+1} \f$ is extrapolated in place. The angular fluxes of
+ * the previous time are held in a second set of buffers which is exchanged
+ * with the current one by swapping, without copying, when the solver advances.
+ */
 class TransientSolver : public opensn::Solver
 {
 protected:
   LBSSolver& lbs_solver_;
   std::shared_ptr<TimeIntegration> time_integration_;
+  const bool solve_initial_state_;
+
+  double theta_ = 1.0;
+  double dt_ = 0.0;
+  std::vector<std::shared_ptr<SweepChunk>> sweep_chunks_;
+
+  std::vector<double> phi_prev_local_;
+  std::vector<double> precursor_prev_local_;
+  std::vector<std::vector<double>> psi_prev_local_;
 
 public:
   static InputParameters GetInputParameters();
@@ -23,6 +43,18 @@ public:
   void Execute() override;
   void Step() override;
   void Advance() override;
+
+protected:
+  /**Sets the angular fluxes of every groupset to the expansion of the flux
+   * moments `phi` with the moment-to-discrete operator, so that the initial
+   * angular fluxes are consistent with initial flux moments that did not come
+   * from a solve.*/
+  void SetAngularFluxesFromMoments(const std::vector<double>& phi);
+
+  /**Updates the precursor concentrations to the end of the time step. The
+   * precursors are solved for at t^{n+theta} with the theta-weighted scalar flux,
+   * theta*phi^{n+1} + (1-theta)*phi^n, and then extrapolated to t^{n+1}.*/
+  void StepPrecursors();
 };
 
 } // namespace lbs
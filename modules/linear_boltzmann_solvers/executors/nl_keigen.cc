@@ -75,6 +75,7 @@ void
 XXNonLinearKEigen::Initialize()
 {
   lbs_solver_.Initialize();
+  lbs_solver_.BindExecutor(TextName());
 }
 
 void
@@ -99,6 +100,7 @@ XXNonLinearKEigen::Execute()
     Scale(lbs_solver_.PrecursorsNewLocal(), 1.0 / nl_context_->kresid_func_context_.k_eff);
   }
 
+  lbs_solver_.FinishRestartWrites();
   lbs_solver_.UpdateFieldFunctions();
 
   log.Log() << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
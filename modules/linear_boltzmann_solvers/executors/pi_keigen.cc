@@ -60,6 +60,7 @@ void
 XXPowerIterationKEigen::Initialize()
 {
   lbs_solver_.Initialize();
+  lbs_solver_.BindExecutor(TextName());
 
   active_set_source_function_ = lbs_solver_.GetActiveSetSourceFunction();
   primary_ags_solver_ = lbs_solver_.GetPrimaryAGSSolver();
@@ -153,6 +154,7 @@ XXPowerIterationKEigen::Execute()
     Scale(lbs_solver_.PrecursorsNewLocal(), 1.0 / k_eff_);
   }
 
+  lbs_solver_.FinishRestartWrites();
   lbs_solver_.UpdateFieldFunctions();
 
   log.Log() << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
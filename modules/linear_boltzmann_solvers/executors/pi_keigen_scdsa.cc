@@ -394,6 +394,7 @@ XXPowerIterationKEigenSCDSA::Execute()
     Scale(lbs_solver_.PrecursorsNewLocal(), 1.0 / k_eff_);
   }
 
+  lbs_solver_.FinishRestartWrites();
   lbs_solver_.UpdateFieldFunctions();
 
   log.Log() << "LinearBoltzmann::KEigenvalueSolver execution completed\n\n";
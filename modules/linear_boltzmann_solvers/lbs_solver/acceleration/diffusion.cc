@@ -2,6 +2,7 @@
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/petsc_utils/petsc_utils.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
 #include "framework/physics/physics_namespace.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
@@ -73,6 +74,37 @@ DiffusionSolver::GetNumPhiIterativeUnknowns()
   return {sdm_.GetNumLocalDOFs(uk_man_), sdm_.GetNumGlobalDOFs(uk_man_)};
 }
 
+size_t
+DiffusionSolver::ComputeMemoryUsage() const
+{
+  size_t bytes = ComputeMatrixMemoryUsage(A_);
+  if (rhs_)
+  {
+    PetscInt local_size = 0;
+    VecGetLocalSize(rhs_, &local_size);
+    bytes += static_cast<size_t>(local_size) * sizeof(PetscScalar);
+  }
+  return bytes;
+}
+
+size_t
+DiffusionSolver::ComputeMatrixMemoryUsage(Mat A)
+{
+  if (not A)
+    return 0;
+
+  // Shell matrices, e.g., of the matrix-free mode, do not store entries
+  PetscBool is_shell = PETSC_FALSE;
+  if (PetscObjectTypeCompare(reinterpret_cast<PetscObject>(A), MATSHELL, &is_shell) != 0 or
+      is_shell)
+    return 0;
+
+  MatInfo info;
+  if (MatGetInfo(A, MAT_LOCAL, &info) != 0)
+    return 0;
+  return static_cast<size_t>(info.nz_allocated) * (sizeof(PetscScalar) + sizeof(PetscInt));
+}
+
 void
 DiffusionSolver::AddToRHS(const std::vector<double>& values)
 {
@@ -117,21 +149,29 @@ DiffusionSolver::Initialize()
   if (options.verbose)
     log.Log() << text_name_ << ": Global number of DOFs=" << num_global_dofs_;
 
-  opensn::mpi_comm.barrier();
-  log.Log() << "Sparsity pattern";
-  opensn::mpi_comm.barrier();
-  // Create Matrix
-  std::vector<int64_t> nodal_nnz_in_diag;
-  std::vector<int64_t> nodal_nnz_off_diag;
-  sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
-  opensn::mpi_comm.barrier();
-  log.Log() << "Done Sparsity pattern";
-  opensn::mpi_comm.barrier();
-  A_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
-  InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
-  opensn::mpi_comm.barrier();
-  log.Log() << "Done matrix creation";
-  opensn::mpi_comm.barrier();
+  // Create Matrix. In matrix-free mode the operator is created by the
+  // derived solver when it is assembled.
+  if (not options.matrix_free)
+  {
+    opensn::mpi_comm.barrier();
+    log.Log() << "Sparsity pattern";
+    opensn::mpi_comm.barrier();
+    std::vector<int64_t> nodal_nnz_in_diag;
+    std::vector<int64_t> nodal_nnz_off_diag;
+    sdm_.BuildSparsityPattern(nodal_nnz_in_diag, nodal_nnz_off_diag, uk_man_);
+    opensn::mpi_comm.barrier();
+    log.Log() << "Done Sparsity pattern";
+    opensn::mpi_comm.barrier();
+    A_ = CreateSquareMatrix(num_local_dofs_, num_global_dofs_);
+    InitMatrixSparsity(A_, nodal_nnz_in_diag, nodal_nnz_off_diag);
+    assembler_ = std::make_unique<MatrixAssembler>(A_,
+                                                   options.reuse_assembly_pattern
+                                                     ? MatrixAssembler::Mode::COO
+                                                     : MatrixAssembler::Mode::SET_VALUES);
+    opensn::mpi_comm.barrier();
+    log.Log() << "Done matrix creation";
+    opensn::mpi_comm.barrier();
+  }
 
   // Create RHS
   if (not requires_ghosts_)
@@ -198,7 +238,7 @@ DiffusionSolver::Solve(std::vector<double>& solution, bool use_initial_guess)
   KSPSetTolerances(
     ksp_, options.residual_tolerance, options.residual_tolerance, 1.0e50, options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -270,7 +310,7 @@ DiffusionSolver::Solve(Vec petsc_solution, bool use_initial_guess)
   KSPSetTolerances(
     ksp_, options.residual_tolerance, options.residual_tolerance, 1.0e50, options.max_iters);
 
-  if (options.perform_symmetry_check)
+  if (options.perform_symmetry_check and not options.matrix_free)
   {
     PetscBool symmetry = PETSC_FALSE;
     MatIsSymmetric(A_, 1.0e-6, &symmetry);
@@ -10,6 +10,7 @@ class MeshContinuum;
 class Cell;
 struct Vector3;
 class SpatialDiscretization;
+class MatrixAssembler;
 
 namespace lbs
 {
@@ -41,9 +42,14 @@ protected:
   Mat A_ = nullptr;
   Vec rhs_ = nullptr;
   KSP ksp_ = nullptr;
+  std::unique_ptr<MatrixAssembler> assembler_;
 
   const bool requires_ghosts_;
 
+  /**Returns the number of bytes allocated on this process for the entries of
+   * `A`, or zero for a null or shell matrix.*/
+  static size_t ComputeMatrixMemoryUsage(Mat A);
+
 public:
   struct Options
   {
@@ -53,6 +59,8 @@ public:
     bool perform_symmetry_check = false; ///< For debugging only (very expensive)
     std::string additional_options_string;
     double penalty_factor = 4.0;
+    bool reuse_assembly_pattern = true; ///< Reuse the symbolic structure of A on re-assembly
+    bool matrix_free = false; ///< Apply A without assembling it (where supported)
   } options;
 
 public:
@@ -89,6 +97,13 @@ public:
 
   std::pair<size_t, size_t> GetNumPhiIterativeUnknowns();
 
+  /**
+   * Returns the number of bytes allocated on this process for the entries of
+   * the assembled matrix and the right-hand side vector. A shell matrix does
+   * not count.
+   */
+  virtual size_t ComputeMemoryUsage() const;
+
   virtual ~DiffusionSolver();
 
   /**
@@ -96,7 +111,7 @@ public:
    * sparsity pattern. Creating the RHS vector. Creating the KSP solver. Setting the very
    * specialized parameters for Hypre's BooomerAMG. Note: `PCSetFromOptions` and `KSPSetFromOptions`
    * are called at the end. Therefore, any number of additional PETSc options can be passed via the
-   * commandline.
+   * commandline. In matrix-free mode no matrix is created here.
    */
   void Initialize();
 
@@ -1,20 +1,55 @@
 #include "diffusion_mip_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
+#include "framework/math/petsc_utils/petsc_utils.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
+#include "framework/math/spatial_discretization/finite_volume/finite_volume.h"
 #include "framework/math/functions/scalar_spatial_function.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
 #include "framework/runtime.h"
 #include "framework/logging/log.h"
 #include "framework/utils/timer.h"
 #include <utility>
+#include <map>
 
 namespace opensn
 {
 namespace lbs
 {
 
+namespace
+{
+
+typedef PetscErrorCode (*PCShellPtr)(PC, Vec, Vec);
+
+/**Shell matrix multiplication of the matrix-free MIP operator.*/
+int
+MIPMatrixFreeMult(Mat A, Vec x, Vec y)
+{
+  DiffusionMIPSolver* solver;
+  MatShellGetContext(A, &solver);
+
+  solver->ApplyMatrixFree(x, y);
+
+  return 0;
+}
+
+/**Shell preconditioner of the matrix-free MIP operator.*/
+int
+MIPMatrixFreePCApply(PC pc, Vec r, Vec z)
+{
+  DiffusionMIPSolver* solver;
+  PCShellGetContext(pc, &solver);
+
+  solver->ApplyMatrixFreePreconditioner(r, z);
+
+  return 0;
+}
+
+} // namespace
+
 void
 DiffusionMIPSolver::SetSourceFunction(std::shared_ptr<ScalarSpatialFunction> function)
 {
@@ -51,11 +86,23 @@ DiffusionMIPSolver::DiffusionMIPSolver(std::string text_name,
                            " used with PWLD.");
 }
 
+DiffusionMIPSolver::~DiffusionMIPSolver()
+{
+  VecDestroy(&x_ghosted_);
+  VecDestroy(&y_ghosted_);
+  MatDestroy(&coarse_A_);
+  VecDestroy(&coarse_r_);
+  VecDestroy(&coarse_e_);
+  KSPDestroy(&coarse_ksp_);
+}
+
 void
 DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "AssembleAand_b_wQpoints";
+  OpenSnLogicalErrorIf(options.matrix_free,
+                       "Quadrature point assembly is not supported in matrix-free mode.");
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
@@ -65,6 +112,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
   VecSet(rhs_, 0.0);
+  assembler_->Begin();
 
   for (const auto& cell : grid_.local_cells)
   {
@@ -108,7 +156,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
               entry_rhs_i += fe_vol_data.ShapeValue(i, qp) * fe_vol_data.ShapeValue(j, qp) *
                              fe_vol_data.JxW(qp) * qg[j];
           } // for qp
-          MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
+          assembler_->Add(imap, jmap, entry_aij);
         } // for j
 
         if (source_function_)
@@ -172,8 +220,8 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                 aij += kappa * fe_srf_data.ShapeValue(i, qp) * fe_srf_data.ShapeValue(jm, qp) *
                        fe_srf_data.JxW(qp);
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+              assembler_->Add(imap, jmmap, aij);
+              assembler_->Add(imap, jpmap, -aij);
             } // for fj
           }   // for fi
 
@@ -200,8 +248,8 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                            fe_srf_data.JxW(qp);
               const double aij = -0.5 * Dg * n_f.Dot(vec_aij);
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+              assembler_->Add(imap, jmmap, aij);
+              assembler_->Add(imap, jpmap, -aij);
             } // for fj
           }   // for i
 
@@ -224,8 +272,8 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                            fe_srf_data.JxW(qp);
               const double aij = -0.5 * Dg * n_f.Dot(vec_aij);
 
-              MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
-              MatSetValue(A_, ipmap, jmap, -aij, ADD_VALUES);
+              assembler_->Add(immap, jmap, aij);
+              assembler_->Add(ipmap, jmap, -aij);
             } // for j
           }   // for fi
 
@@ -276,7 +324,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                                     fe_srf_data.JxW(qp);
                 }
 
-                MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
+                assembler_->Add(imap, jmmap, aij);
                 VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
               } // for fj
             }   // for fi
@@ -316,7 +364,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                   aij_bc_value = -Dg * n_f.Dot(vec_aij_mms);
                 }
 
-                MatSetValue(A_, imap, jmap, aij, ADD_VALUES);
+                assembler_->Add(imap, jmap, aij);
                 VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
               } // for fj
             }   // for i
@@ -348,7 +396,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
                            fe_srf_data.JxW(qp);
                   aij *= (aval / bval);
 
-                  MatSetValue(A_, ir, jr, aij, ADD_VALUES);
+                  assembler_->Add(ir, jr, aij);
                 } // for fj
               }   // if a nonzero
 
@@ -368,8 +416,7 @@ DiffusionMIPSolver::AssembleAand_b_wQpoints(const std::vector<double>& q_vector)
     }           // for g
   }             // for cell
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  assembler_->Assemble();
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
@@ -594,6 +641,32 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 {
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "AssembleAand_b";
+  if (options.matrix_free)
+  {
+    if (rhs_ == nullptr or ksp_ == nullptr)
+      throw std::logic_error(fname + ": Some or all PETSc elements are null. "
+                                     "Check that Initialize has been called.");
+    if (options.verbose)
+      log.Log() << program_timer.GetTimeString() << " Starting matrix-free setup";
+
+    if (not matrix_free_initialized_)
+      InitializeMatrixFree();
+    AssembleMatrixFreePreconditioner();
+    Assemble_b(q_vector);
+
+    KSPSetOperators(ksp_, A_, A_);
+
+    if (options.verbose)
+      log.Log() << program_timer.GetTimeString() << " Matrix-free setup completed";
+
+    PC pc;
+    KSPGetPC(ksp_, &pc);
+    PCSetUp(pc);
+
+    KSPSetUp(ksp_);
+    return;
+  }
+
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
@@ -603,6 +676,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
   VecSet(rhs_, 0.0);
+  assembler_->Begin();
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -640,7 +714,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
           entry_rhs_i += intV_shapeI_shapeJ[i][j] * qg[j];
 
-          MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
+          assembler_->Add(imap, jmap, entry_aij);
         } // for j
 
         VecSetValue(rhs_, imap, entry_rhs_i, ADD_VALUES);
@@ -697,8 +771,8 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
               const double aij = kappa * intS_shapeI_shapeJ[i][jm];
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+              assembler_->Add(imap, jmmap, aij);
+              assembler_->Add(imap, jpmap, -aij);
             } // for fj
           }   // for fi
 
@@ -721,8 +795,8 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
               const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[jm][i]);
 
-              MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
-              MatSetValue(A_, imap, jpmap, -aij, ADD_VALUES);
+              assembler_->Add(imap, jmmap, aij);
+              assembler_->Add(imap, jpmap, -aij);
             } // for fj
           }   // for i
 
@@ -741,8 +815,8 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
               const double aij = -0.5 * Dg * n_f.Dot(intS_shapeI_gradshapeJ[im][j]);
 
-              MatSetValue(A_, immap, jmap, aij, ADD_VALUES);
-              MatSetValue(A_, ipmap, jmap, -aij, ADD_VALUES);
+              assembler_->Add(immap, jmap, aij);
+              assembler_->Add(ipmap, jmap, -aij);
             } // for j
           }   // for fi
 
@@ -780,7 +854,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
                 const double aij = kappa * intS_shapeI_shapeJ[i][jm];
                 const double aij_bc_value = aij * bc_value;
 
-                MatSetValue(A_, imap, jmmap, aij, ADD_VALUES);
+                assembler_->Add(imap, jmmap, aij);
                 VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
               } // for fj
             }   // for fi
@@ -802,7 +876,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
                   -Dg * n_f.Dot(intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]);
                 const double aij_bc_value = aij * bc_value;
 
-                MatSetValue(A_, imap, jmap, aij, ADD_VALUES);
+                assembler_->Add(imap, jmap, aij);
                 VecSetValue(rhs_, imap, aij_bc_value, ADD_VALUES);
               } // for fj
             }   // for i
@@ -830,7 +904,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
                   const double aij = (aval / bval) * intS_shapeI_shapeJ[i][j];
 
-                  MatSetValue(A_, ir, jr, aij, ADD_VALUES);
+                  assembler_->Add(ir, jr, aij);
                 } // for fj
               }   // if a nonzero
 
@@ -847,8 +921,7 @@ DiffusionMIPSolver::AssembleAand_b(const std::vector<double>& q_vector)
     }           // for g
   }             // for cell
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  assembler_->Assemble();
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
@@ -1182,6 +1255,440 @@ DiffusionMIPSolver::Assemble_b(Vec petsc_q_vector)
     log.Log() << program_timer.GetTimeString() << " Assembly completed";
 }
 
+size_t
+DiffusionMIPSolver::ComputeMemoryUsage() const
+{
+  size_t bytes = DiffusionSolver::ComputeMemoryUsage();
+  bytes += ComputeMatrixMemoryUsage(coarse_A_);
+  for (const auto& blocks : mf_cell_block_inverses_)
+    for (const auto& block : blocks)
+      for (const auto& row : block)
+        bytes += row.size() * sizeof(double);
+  return bytes;
+}
+
+void
+DiffusionMIPSolver::InitializeMatrixFree()
+{
+  OpenSnLogicalErrorIf(uk_man_.dof_storage_type_ != UnknownStorageType::NODAL,
+                       "Matrix-free mode requires nodal dof storage.");
+  OpenSnLogicalErrorIf(uk_man_.unknowns_.size() != 1,
+                       "Matrix-free mode requires a single multi-component unknown.");
+
+  const auto num_groups = static_cast<int64_t>(uk_man_.unknowns_.front().num_components_);
+  const size_t num_local_cells = grid_.local_cells.size();
+  const size_t num_local_nodes = num_local_dofs_ / num_groups;
+
+  coarse_sdm_ = FiniteVolume::New(grid_);
+
+  mf_cell_dof_base_.assign(num_local_cells, 0);
+  mf_faces_.assign(num_local_cells, {});
+  mf_node_cell_.assign(num_local_nodes, -1);
+  mf_node_coarse_dof_.assign(num_local_nodes, -1);
+
+  // Nodes of ghost cells, keyed by their global group-0 dof, are appended
+  // after the local nodes in the ghosted work vectors
+  std::map<int64_t, int64_t> ghost_node_ids;
+  std::vector<int64_t> ghost_node_coarse_dofs;
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const auto cc_nodes = cell_mapping.GetNodeLocations();
+    const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+
+    const int64_t base = sdm_.MapDOFLocal(cell, 0, uk_man_, 0, 0);
+    const int64_t coarse_dof = coarse_sdm_->MapDOF(cell, 0, uk_man_, 0, 0);
+    mf_cell_dof_base_[cell.local_id_] = base;
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      mf_node_cell_[base / num_groups + i] = static_cast<int64_t>(cell.local_id_);
+      mf_node_coarse_dof_[base / num_groups + i] = coarse_dof;
+    }
+
+    auto& mf_faces = mf_faces_[cell.local_id_];
+    mf_faces.resize(cell.faces_.size());
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& face = cell.faces_[f];
+      auto& mf_face = mf_faces[f];
+      const double hm = HPerpendicular(cell, f);
+      const double kappa_scale = cell.Type() == CellType::POLYHEDRON ? 2.0 : 1.0;
+
+      if (face.has_neighbor_)
+      {
+        const auto& adj_cell = grid_.cells[face.neighbor_id_];
+        const auto& adj_cell_mapping = sdm_.GetCellMapping(adj_cell);
+        const auto ac_nodes = adj_cell_mapping.GetNodeLocations();
+        const size_t acf = MeshContinuum::MapCellFace(cell, adj_cell, f);
+        const double hp = HPerpendicular(adj_cell, acf);
+        const auto& adj_xs = mat_id_2_xs_map_.at(adj_cell.material_id_);
+
+        mf_face.type = MatrixFreeFace::Type::INTERIOR;
+        mf_face.kappa.resize(num_groups);
+        for (int64_t g = 0; g < num_groups; ++g)
+          mf_face.kappa[g] = fmax(
+            options.penalty_factor * kappa_scale * (adj_xs.Dg[g] / hp + xs.Dg[g] / hm) * 0.5, 0.25);
+
+        const bool adj_is_local = face.IsNeighborLocal(grid_);
+        const int64_t adj_coarse_dof = coarse_sdm_->MapDOF(adj_cell, 0, uk_man_, 0, 0);
+        for (size_t fj = 0; fj < cell_mapping.NumFaceNodes(f); ++fj)
+        {
+          const int jp = MapFaceNodeDisc(cell, adj_cell, cc_nodes, ac_nodes, f, acf, fj);
+          if (adj_is_local)
+          {
+            mf_face.adj_dofs.push_back(sdm_.MapDOFLocal(adj_cell, jp, uk_man_, 0, 0));
+            continue;
+          }
+
+          const int64_t global_dof = sdm_.MapDOF(adj_cell, jp, uk_man_, 0, 0);
+          auto it = ghost_node_ids.find(global_dof);
+          if (it == ghost_node_ids.end())
+          {
+            const auto ghost_node_id = static_cast<int64_t>(ghost_node_ids.size());
+            it = ghost_node_ids.emplace(global_dof, ghost_node_id).first;
+            ghost_node_coarse_dofs.push_back(adj_coarse_dof);
+          }
+          mf_face.adj_dofs.push_back(num_local_dofs_ + it->second * num_groups);
+        }
+      } // internal face
+      else
+      {
+        BoundaryCondition bc;
+        if (bcs_.count(face.neighbor_id_) > 0)
+          bc = bcs_.at(face.neighbor_id_);
+
+        if (bc.type == BCType::DIRICHLET)
+        {
+          mf_face.type = MatrixFreeFace::Type::DIRICHLET;
+          mf_face.kappa.resize(num_groups);
+          for (int64_t g = 0; g < num_groups; ++g)
+            mf_face.kappa[g] = fmax(options.penalty_factor * kappa_scale * xs.Dg[g] / hm, 0.25);
+        }
+        else if (bc.type == BCType::ROBIN and std::fabs(bc.values[1]) >= 1.0e-12 and
+                 std::fabs(bc.values[0]) >= 1.0e-12)
+        {
+          mf_face.type = MatrixFreeFace::Type::ROBIN;
+          mf_face.robin_coeff = bc.values[0] / bc.values[1];
+        }
+      } // boundary face
+    }   // for face
+  }     // for cell
+
+  // Work vectors with the nodes of neighboring ghost cells as ghosts
+  std::vector<int64_t> ghost_ids(ghost_node_ids.size() * num_groups);
+  for (const auto& [global_dof, ghost_node_id] : ghost_node_ids)
+    for (int64_t g = 0; g < num_groups; ++g)
+      ghost_ids[ghost_node_id * num_groups + g] = global_dof + g;
+
+  mf_node_cell_.resize(num_local_nodes + ghost_node_ids.size(), -1);
+  mf_node_coarse_dof_.insert(
+    mf_node_coarse_dof_.end(), ghost_node_coarse_dofs.begin(), ghost_node_coarse_dofs.end());
+
+  x_ghosted_ = CreateVectorWithGhosts(
+    num_local_dofs_, num_global_dofs_, static_cast<int64_t>(ghost_ids.size()), ghost_ids);
+  VecDuplicate(x_ghosted_, &y_ghosted_);
+
+  // Shell operator
+  MatCreateShell(opensn::mpi_comm,
+                 num_local_dofs_,
+                 num_local_dofs_,
+                 num_global_dofs_,
+                 num_global_dofs_,
+                 this,
+                 &A_);
+  MatShellSetOperation(A_, MATOP_MULT, (void (*)())MIPMatrixFreeMult);
+
+  // Coarse system
+  coarse_A_ = CreatePreallocatedSquareMatrix(*coarse_sdm_, uk_man_);
+  coarse_assembler_ = std::make_unique<MatrixAssembler>(coarse_A_);
+  MatCreateVecs(coarse_A_, &coarse_e_, &coarse_r_);
+
+  KSPCreate(opensn::mpi_comm, &coarse_ksp_);
+  KSPSetOptionsPrefix(coarse_ksp_, (text_name_ + "lo_").c_str());
+  KSPSetType(coarse_ksp_, KSPPREONLY);
+  PC coarse_pc;
+  KSPGetPC(coarse_ksp_, &coarse_pc);
+  PCSetType(coarse_pc, PCHYPRE);
+  PCHYPRESetType(coarse_pc, "boomeramg");
+  KSPSetFromOptions(coarse_ksp_);
+
+  // The preconditioner of the outer solver
+  PC pc;
+  KSPGetPC(ksp_, &pc);
+  PCSetType(pc, PCSHELL);
+  PCShellSetApply(pc, (PCShellPtr)MIPMatrixFreePCApply);
+  PCShellSetContext(pc, this);
+
+  matrix_free_initialized_ = true;
+
+  if (options.verbose)
+    log.Log() << text_name_ << ": Matrix-free operator with " << ghost_node_ids.size()
+              << " ghost nodes initialized";
+}
+
+template <typename Callable>
+void
+DiffusionMIPSolver::VisitOperatorEntries(Callable&& add) const
+{
+  const auto num_groups = static_cast<int64_t>(uk_man_.unknowns_.front().num_components_);
+  const std::vector<double> ones(num_groups, 1.0);
+
+  for (const auto& cell : grid_.local_cells)
+  {
+    const auto& cell_mapping = sdm_.GetCellMapping(cell);
+    const size_t num_nodes = cell_mapping.NumNodes();
+    const auto& unit_cell_matrices = unit_cell_matrices_[cell.local_id_];
+    const auto& xs = mat_id_2_xs_map_.at(cell.material_id_);
+
+    const int64_t base = mf_cell_dof_base_[cell.local_id_];
+    auto dof = [base, num_groups](size_t i) { return base + static_cast<int64_t>(i) * num_groups; };
+
+    const auto& intV_gradshapeI_gradshapeJ = unit_cell_matrices.intV_gradshapeI_gradshapeJ;
+    const auto& intV_shapeI_shapeJ = unit_cell_matrices.intV_shapeI_shapeJ;
+
+    // Volume terms
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t j = 0; j < num_nodes; ++j)
+      {
+        add(dof(i), dof(j), intV_gradshapeI_gradshapeJ[i][j], xs.Dg);
+        add(dof(i), dof(j), intV_shapeI_shapeJ[i][j], xs.sigR);
+      }
+
+    // Face terms
+    for (size_t f = 0; f < cell.faces_.size(); ++f)
+    {
+      const auto& mf_face = mf_faces_[cell.local_id_][f];
+      const auto& n_f = cell.faces_[f].normal_;
+      const size_t num_face_nodes = cell_mapping.NumFaceNodes(f);
+
+      const auto& intS_shapeI_shapeJ = unit_cell_matrices.intS_shapeI_shapeJ[f];
+      const auto& intS_shapeI_gradshapeJ = unit_cell_matrices.intS_shapeI_gradshapeJ[f];
+
+      if (mf_face.type == MatrixFreeFace::Type::INTERIOR)
+      {
+        // Penalty terms
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = cell_mapping.MapFaceNode(f, fi);
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const int jm = cell_mapping.MapFaceNode(f, fj);
+            const double aij = intS_shapeI_shapeJ[i][jm];
+            add(dof(i), dof(jm), aij, mf_face.kappa);
+            add(dof(i), mf_face.adj_dofs[fj], -aij, mf_face.kappa);
+          }
+        }
+
+        // 0.5*D* n dot (b_j^+ - b_j^-)*nabla b_i^-
+        for (size_t i = 0; i < num_nodes; ++i)
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const int jm = cell_mapping.MapFaceNode(f, fj);
+            const double aij = -0.5 * n_f.Dot(intS_shapeI_gradshapeJ[jm][i]);
+            add(dof(i), dof(jm), aij, xs.Dg);
+            add(dof(i), mf_face.adj_dofs[fj], -aij, xs.Dg);
+          }
+
+        // 0.5*D* n dot (b_i^+ - b_i^-)*nabla b_j^-
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int im = cell_mapping.MapFaceNode(f, fi);
+          for (size_t j = 0; j < num_nodes; ++j)
+          {
+            const double aij = -0.5 * n_f.Dot(intS_shapeI_gradshapeJ[im][j]);
+            add(dof(im), dof(j), aij, xs.Dg);
+            add(mf_face.adj_dofs[fi], dof(j), -aij, xs.Dg);
+          }
+        }
+      } // internal face
+      else if (mf_face.type == MatrixFreeFace::Type::DIRICHLET)
+      {
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = cell_mapping.MapFaceNode(f, fi);
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const int jm = cell_mapping.MapFaceNode(f, fj);
+            add(dof(i), dof(jm), intS_shapeI_shapeJ[i][jm], mf_face.kappa);
+          }
+        }
+
+        for (size_t i = 0; i < num_nodes; ++i)
+          for (size_t j = 0; j < num_nodes; ++j)
+          {
+            const double aij =
+              -n_f.Dot(intS_shapeI_gradshapeJ[j][i] + intS_shapeI_gradshapeJ[i][j]);
+            add(dof(i), dof(j), aij, xs.Dg);
+          }
+      } // Dirichlet BC
+      else if (mf_face.type == MatrixFreeFace::Type::ROBIN)
+      {
+        for (size_t fi = 0; fi < num_face_nodes; ++fi)
+        {
+          const int i = cell_mapping.MapFaceNode(f, fi);
+          for (size_t fj = 0; fj < num_face_nodes; ++fj)
+          {
+            const int j = cell_mapping.MapFaceNode(f, fj);
+            add(dof(i), dof(j), mf_face.robin_coeff * intS_shapeI_shapeJ[i][j], ones);
+          }
+        }
+      } // Robin BC
+    }   // for face
+  }     // for cell
+}
+
+void
+DiffusionMIPSolver::AssembleMatrixFreePreconditioner()
+{
+  const auto num_groups = static_cast<int64_t>(uk_man_.unknowns_.front().num_components_);
+
+  // Diagonal cell blocks, per group
+  mf_cell_block_inverses_.assign(grid_.local_cells.size(), {});
+  for (const auto& cell : grid_.local_cells)
+  {
+    const size_t num_nodes = sdm_.GetCellMapping(cell).NumNodes();
+    mf_cell_block_inverses_[cell.local_id_].assign(num_groups,
+                                                   MatDbl(num_nodes, VecDbl(num_nodes, 0.0)));
+  }
+
+  // Cell-aggregated operator, per coarse row and column, for all groups
+  std::map<std::pair<int64_t, int64_t>, std::vector<double>> coarse_entries;
+
+  VisitOperatorEntries(
+    [this, num_groups, &coarse_entries](
+      int64_t row, int64_t col, double value, const std::vector<double>& coeff)
+    {
+      const int64_t row_node = row / num_groups;
+      const int64_t col_node = col / num_groups;
+
+      const int64_t cell_id = mf_node_cell_[row_node];
+      if (cell_id >= 0 and cell_id == mf_node_cell_[col_node])
+      {
+        const int64_t cell_node_base = mf_cell_dof_base_[cell_id] / num_groups;
+        auto& blocks = mf_cell_block_inverses_[cell_id];
+        for (int64_t g = 0; g < num_groups; ++g)
+          blocks[g][row_node - cell_node_base][col_node - cell_node_base] += value * coeff[g];
+      }
+
+      auto& entry = coarse_entries[{mf_node_coarse_dof_[row_node], mf_node_coarse_dof_[col_node]}];
+      entry.resize(num_groups, 0.0);
+      for (int64_t g = 0; g < num_groups; ++g)
+        entry[g] += value * coeff[g];
+    });
+
+  for (auto& blocks : mf_cell_block_inverses_)
+    for (auto& block : blocks)
+      block = InverseGEPivoting(block);
+
+  coarse_assembler_->Begin();
+  for (int64_t g = 0; g < num_groups; ++g)
+    for (const auto& [row_col, values] : coarse_entries)
+      coarse_assembler_->Add(row_col.first + g, row_col.second + g, values[g]);
+  coarse_assembler_->Assemble();
+
+  KSPSetOperators(coarse_ksp_, coarse_A_, coarse_A_);
+  KSPSetUp(coarse_ksp_);
+}
+
+void
+DiffusionMIPSolver::ApplyMatrixFree(Vec x, Vec y)
+{
+  const auto num_groups = static_cast<int64_t>(uk_man_.unknowns_.front().num_components_);
+
+  VecCopy(x, x_ghosted_);
+  CommunicateGhostEntries(x_ghosted_);
+
+  Vec x_local, y_local;
+  VecGhostGetLocalForm(x_ghosted_, &x_local);
+  VecGhostGetLocalForm(y_ghosted_, &y_local);
+  VecSet(y_local, 0.0);
+
+  const double* x_raw;
+  double* y_raw;
+  VecGetArrayRead(x_local, &x_raw);
+  VecGetArray(y_local, &y_raw);
+
+  // The geometric entry is shared by all groups, the inner loop runs over
+  // contiguous group values
+  VisitOperatorEntries(
+    [x_raw, y_raw, num_groups](
+      int64_t row, int64_t col, double value, const std::vector<double>& coeff)
+    {
+      for (int64_t g = 0; g < num_groups; ++g)
+        y_raw[row + g] += value * coeff[g] * x_raw[col + g];
+    });
+
+  VecRestoreArrayRead(x_local, &x_raw);
+  VecRestoreArray(y_local, &y_raw);
+  VecGhostRestoreLocalForm(x_ghosted_, &x_local);
+  VecGhostRestoreLocalForm(y_ghosted_, &y_local);
+
+  // Contributions to rows of neighboring ghost cells are added to their owners
+  VecGhostUpdateBegin(y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(y_ghosted_, ADD_VALUES, SCATTER_REVERSE);
+
+  VecCopy(y_ghosted_, y);
+}
+
+void
+DiffusionMIPSolver::ApplyMatrixFreePreconditioner(Vec r, Vec z)
+{
+  const auto num_groups = static_cast<int64_t>(uk_man_.unknowns_.front().num_components_);
+
+  PetscInt coarse_offset;
+  VecGetOwnershipRange(coarse_r_, &coarse_offset, nullptr);
+
+  const double* r_raw;
+  double* z_raw;
+  double* coarse_r_raw;
+  VecGetArrayRead(r, &r_raw);
+  VecGetArray(z, &z_raw);
+  VecSet(coarse_r_, 0.0);
+  VecGetArray(coarse_r_, &coarse_r_raw);
+
+  // Cell block inverses and restriction of the residual to the cells
+  for (const auto& cell : grid_.local_cells)
+  {
+    const int64_t base = mf_cell_dof_base_[cell.local_id_];
+    const int64_t coarse_dof = mf_node_coarse_dof_[base / num_groups] - coarse_offset;
+    const auto& blocks = mf_cell_block_inverses_[cell.local_id_];
+
+    for (int64_t g = 0; g < num_groups; ++g)
+    {
+      const auto& block_inverse = blocks[g];
+      const size_t num_nodes = block_inverse.size();
+      for (size_t i = 0; i < num_nodes; ++i)
+      {
+        double value = 0.0;
+        for (size_t j = 0; j < num_nodes; ++j)
+          value += block_inverse[i][j] * r_raw[base + j * num_groups + g];
+        z_raw[base + i * num_groups + g] = value;
+
+        coarse_r_raw[coarse_dof + g] += r_raw[base + i * num_groups + g];
+      }
+    }
+  }
+
+  VecRestoreArray(coarse_r_, &coarse_r_raw);
+  VecRestoreArrayRead(r, &r_raw);
+
+  // Coarse correction, prolongated as a constant per cell
+  KSPSolve(coarse_ksp_, coarse_r_, coarse_e_);
+
+  const double* coarse_e_raw;
+  VecGetArrayRead(coarse_e_, &coarse_e_raw);
+  for (int64_t dof = 0; dof < num_local_dofs_; ++dof)
+  {
+    const int64_t node = dof / num_groups;
+    const int64_t g = dof - node * num_groups;
+    z_raw[dof] += coarse_e_raw[mf_node_coarse_dof_[node] - coarse_offset + g];
+  }
+  VecRestoreArrayRead(coarse_e_, &coarse_e_raw);
+  VecRestoreArray(z, &z_raw);
+}
+
 double
 DiffusionMIPSolver::HPerpendicular(const Cell& cell, unsigned int f)
 {
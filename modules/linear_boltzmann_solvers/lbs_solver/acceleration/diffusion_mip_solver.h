@@ -1,6 +1,7 @@
 #pragma once
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion.h"
+#include "framework/math/math.h"
 
 namespace opensn
 {
@@ -27,7 +28,7 @@ public:
                      MatID2XSMap map_mat_id_2_xs,
                      const std::vector<UnitCellMatrices>& unit_cell_matrices,
                      bool verbose);
-  virtual ~DiffusionMIPSolver() = default;
+  virtual ~DiffusionMIPSolver();
 
   void SetSourceFunction(std::shared_ptr<ScalarSpatialFunction> function);
 
@@ -57,6 +58,26 @@ public:
   void Assemble_b(const std::vector<double>& q_vector) override;
   void Assemble_b(Vec petsc_q_vector) override;
 
+  /**
+   * In addition to the base solver, counts the coarse operator and the cell
+   * block inverses of the matrix-free preconditioner.
+   */
+  size_t ComputeMemoryUsage() const override;
+
+  /**
+   * Applies the MIP operator, `y = A x`, cell by cell from the unit cell-matrices without
+   * forming A. This is the multiplication of the shell matrix used when `options.matrix_free`
+   * is set.
+   */
+  void ApplyMatrixFree(Vec x, Vec y);
+
+  /**
+   * Applies the preconditioner of the matrix-free operator. The preconditioner is additive and
+   * two-level: an inverse of the diagonal cell blocks plus a coarse correction with the cell-wise
+   * aggregated (finite volume) operator, which is assembled and solved with algebraic multigrid.
+   */
+  void ApplyMatrixFreePreconditioner(Vec r, Vec z);
+
   /**
    * Still searching for a reference for this.
    *
@@ -84,8 +105,58 @@ public:
                       double epsilon = 1.0e-12);
 
 private:
+  /**Data of a cell face needed to apply the operator matrix-free.*/
+  struct MatrixFreeFace
+  {
+    enum class Type
+    {
+      NONE = 0,
+      INTERIOR = 1,
+      DIRICHLET = 2,
+      ROBIN = 3
+    };
+    Type type = Type::NONE;
+    /**Penalty coefficient per group.*/
+    std::vector<double> kappa;
+    /**Ghosted-local group-0 dof of the adjacent cell's node coinciding with each face node.*/
+    std::vector<int64_t> adj_dofs;
+    /**The coefficient a/b of a Robin condition.*/
+    double robin_coeff = 0.0;
+  };
+
+  /**Computes the face data, the ghost layout of the work vectors and creates the shell matrix
+   * and the coarse system of the matrix-free mode.*/
+  void InitializeMatrixFree();
+
+  /**Assembles the cell blocks and the coarse operator of the preconditioner.*/
+  void AssembleMatrixFreePreconditioner();
+
+  /**Calls `add(row, col, value, coeff)` for every group-independent entry of the operator,
+   * meaning that entry `(row + g, col + g)` of A is `value * coeff[g]` for every group `g`.
+   * Rows and columns are ghosted-local dof indices. Entries are visited in the order of
+   * `AssembleAand_b`.*/
+  template <typename Callable>
+  void VisitOperatorEntries(Callable&& add) const;
+
   std::shared_ptr<ScalarSpatialFunction> source_function_;
   std::shared_ptr<ScalarSpatialFunction> ref_solution_function_;
+
+  // Matrix-free mode
+  bool matrix_free_initialized_ = false;
+  std::vector<int64_t> mf_cell_dof_base_;
+  std::vector<std::vector<MatrixFreeFace>> mf_faces_;
+  std::vector<int64_t> mf_node_cell_;
+  std::vector<int64_t> mf_node_coarse_dof_;
+  std::vector<std::vector<MatDbl>> mf_cell_block_inverses_;
+  Vec x_ghosted_ = nullptr;
+  Vec y_ghosted_ = nullptr;
+
+  std::shared_ptr<opensn::SpatialDiscretization> coarse_sdm_;
+  std::unique_ptr<MatrixAssembler> coarse_assembler_;
+  Mat coarse_A_ = nullptr;
+  Vec coarse_r_ = nullptr;
+  Vec coarse_e_ = nullptr;
+  KSP coarse_ksp_ = nullptr;
 };
 
 } // namespace lbs
@@ -1,5 +1,6 @@
 #include "diffusion_pwlc_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/acceleration.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
 #include "framework/math/spatial_discretization/spatial_discretization.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_structs.h"
@@ -47,6 +48,8 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
   const std::string fname = "lbs::acceleration::DiffusionMIPSolver::"
                             "AssembleAand_b";
+  OpenSnLogicalErrorIf(options.matrix_free,
+                       "Matrix-free mode is not supported by DiffusionPWLCSolver.");
   if (A_ == nullptr or rhs_ == nullptr or ksp_ == nullptr)
     throw std::logic_error(fname + ": Some or all PETSc elements are null. "
                                    "Check that Initialize has been called.");
@@ -56,6 +59,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
   const size_t num_groups = uk_man_.unknowns_.front().num_components_;
 
   VecSet(rhs_, 0.0);
+  assembler_->Begin();
   for (const auto& cell : grid_.local_cells)
   {
     const size_t num_faces = cell.faces_.size();
@@ -116,7 +120,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
             Dg * intV_gradshapeI_gradshapeJ[i][j] + sigr_g * intV_shapeI_shapeJ[i][j];
 
           if (not node_is_dirichlet[j].first)
-            MatSetValue(A_, imap, jmap, entry_aij, ADD_VALUES);
+            assembler_->Add(imap, jmap, entry_aij);
           else
           {
             const double bcvalue = node_is_dirichlet[j].second;
@@ -155,7 +159,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
               // MatSetValue(A_, imap, imap, intV_shapeI[i], ADD_VALUES);
               // VecSetValue(rhs_, imap, bc_value * intV_shapeI[i], ADD_VALUES);
-              MatSetValue(A_, imap, imap, 1.0, ADD_VALUES);
+              assembler_->Add(imap, imap, 1.0);
               VecSetValue(rhs_, imap, bc_value, ADD_VALUES);
             } // for fi
 
@@ -183,7 +187,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
 
                   const double aij = (aval / bval) * intS_shapeI_shapeJ[i][j];
 
-                  MatSetValue(A_, ir, jr, aij, ADD_VALUES);
+                  assembler_->Add(ir, jr, aij);
                 } // for fj
               }   // if a nonzero
 
@@ -200,8 +204,7 @@ DiffusionPWLCSolver::AssembleAand_b(const std::vector<double>& q_vector)
     }           // for g
   }             // for cell
 
-  MatAssemblyBegin(A_, MAT_FINAL_ASSEMBLY);
-  MatAssemblyEnd(A_, MAT_FINAL_ASSEMBLY);
+  assembler_->Assemble();
   VecAssemblyBegin(rhs_);
   VecAssemblyEnd(rhs_);
 
@@ -44,6 +44,23 @@ lbs::LBSGroupset::GetInputParameters()
     "The number of subsets to apply to the set of groups in this set. This is "
     "useful for increasing pipeline size for parallel simulations");
 
+  params.AddOptionalParameter("max_mpi_message_size",
+                              0,
+                              "The maximum size, in bytes, of the messages of AAH sweeps of this "
+                              "groupset. A value of 0 uses the solver option of the same name.");
+
+  params.AddOptionalParameter("autotune_sweep_subsets",
+                              false,
+                              "If true, groupset_num_subsets, angle_aggregation_num_subsets and, "
+                              "for parallel AAH sweeps, max_mpi_message_size are chosen during "
+                              "initialization by timing trial sweeps of candidate values. The "
+                              "supplied values are among the candidates. The choice is logged so "
+                              "that it can be supplied directly in subsequent runs.");
+
+  params.AddOptionalParameter("autotune_num_trial_sweeps",
+                              3,
+                              "The number of timed trial sweeps per autotuning candidate.");
+
   params.AddOptionalParameter(
     "inner_linear_method", "richardson", "The iterative method to use for inner linear solves");
 
@@ -57,6 +74,18 @@ lbs::LBSGroupset::GetInputParameters()
 
   params.AddOptionalParameter(
     "allow_cycles", true, "Flag indicating whether cycles are to be allowed or not");
+  params.AddOptionalParameter("resolve_local_cycles",
+                              false,
+                              "If true, the cells of each local cyclic dependency are swept "
+                              "with sub-iterations until their angular fluxes converge, instead "
+                              "of lagging them to the next iteration. AAH sweeps only.");
+  params.AddOptionalParameter("local_cycle_max_its",
+                              100,
+                              "Maximum number of sub-iterations per local cyclic dependency.");
+  params.AddOptionalParameter("local_cycle_tol",
+                              1.0e-10,
+                              "Relative tolerance on the angular fluxes of local cyclic "
+                              "dependency sub-iterations.");
 
   params.AddOptionalParameter("log_sweep_events", false, "Turns on a log of sweep events");
 
@@ -71,6 +100,10 @@ lbs::LBSGroupset::GetInputParameters()
   params.AddOptionalParameter(
     "wgdsa_verbose", false, "If true, WGDSA routines will print verbosely");
   params.AddOptionalParameter("wgdsa_petsc_options", "", "PETSc options to pass to WGDSA solver");
+  params.AddOptionalParameter("wgdsa_matrix_free",
+                              false,
+                              "If true, the WGDSA diffusion operator is applied matrix-free and "
+                              "preconditioned with an assembled cell-wise low-order operator");
 
   // TG DSA options
   params.AddOptionalParameter(
@@ -80,6 +113,10 @@ lbs::LBSGroupset::GetInputParameters()
   params.AddOptionalParameter(
     "tgdsa_verbose", false, "If true, TGDSA routines will print verbosely");
   params.AddOptionalParameter("tgdsa_petsc_options", "", "PETSc options to pass to TGDSA solver");
+  params.AddOptionalParameter("tgdsa_matrix_free",
+                              false,
+                              "If true, the TGDSA diffusion operator is applied matrix-free and "
+                              "preconditioned with an assembled cell-wise low-order operator");
 
   // Constraints
   params.ConstrainParameterRange("angle_aggregation_type",
@@ -89,9 +126,16 @@ lbs::LBSGroupset::GetInputParameters()
 
   params.ConstrainParameterRange("groupset_num_subsets", AllowableRangeLowLimit::New(1));
 
+  params.ConstrainParameterRange("max_mpi_message_size", AllowableRangeLowLimit::New(0));
+
+  params.ConstrainParameterRange("autotune_num_trial_sweeps", AllowableRangeLowLimit::New(1));
+
   params.ConstrainParameterRange("inner_linear_method",
                                  AllowableRangeList::New({"richardson", "gmres", "bicgstab"}));
 
+  params.ConstrainParameterRange("local_cycle_max_its", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("local_cycle_tol", AllowableRangeLowLimit::New(1.0e-18));
+
   params.ConstrainParameterRange("l_abs_tol", AllowableRangeLowLimit::New(1.0e-18));
   params.ConstrainParameterRange("l_max_its", AllowableRangeLowLimit::New(0));
   params.ConstrainParameterRange("gmres_restart_interval", AllowableRangeLowLimit::New(1));
@@ -144,6 +188,10 @@ lbs::LBSGroupset::LBSGroupset(const InputParameters& params,
     angleagg_method_ = AngleAggregationType::AZIMUTHAL;
 
   master_num_ang_subsets_ = params.GetParamValue<int>("angle_aggregation_num_subsets");
+  max_mpi_message_size_ = params.GetParamValue<int>("max_mpi_message_size");
+
+  autotune_sweep_subsets_ = params.GetParamValue<bool>("autotune_sweep_subsets");
+  autotune_num_trial_sweeps_ = params.GetParamValue<int>("autotune_num_trial_sweeps");
 
   // Inner solver
   const auto inner_linear_method = params.GetParamValue<std::string>("inner_linear_method");
@@ -155,6 +203,9 @@ lbs::LBSGroupset::LBSGroupset(const InputParameters& params,
     iterative_method_ = IterativeMethod::KRYLOV_BICGSTAB;
 
   allow_cycles_ = params.GetParamValue<bool>("allow_cycles");
+  resolve_local_cycles_ = params.GetParamValue<bool>("resolve_local_cycles");
+  local_cycle_max_iterations_ = params.GetParamValue<int>("local_cycle_max_its");
+  local_cycle_tolerance_ = params.GetParamValue<double>("local_cycle_tol");
   residual_tolerance_ = params.GetParamValue<double>("l_abs_tol");
   max_iterations_ = params.GetParamValue<int>("l_max_its");
 
@@ -176,6 +227,9 @@ lbs::LBSGroupset::LBSGroupset(const InputParameters& params,
 
   wgdsa_string_ = params.GetParamValue<std::string>("wgdsa_petsc_options");
   tgdsa_string_ = params.GetParamValue<std::string>("tgdsa_petsc_options");
+
+  wgdsa_matrix_free_ = params.GetParamValue<bool>("wgdsa_matrix_free");
+  tgdsa_matrix_free_ = params.GetParamValue<bool>("tgdsa_matrix_free");
 }
 
 void
@@ -33,6 +33,10 @@ public:
 
   int master_num_grp_subsets_ = 1;
   int master_num_ang_subsets_ = 1;
+  /// Maximum AAH sweep message size in bytes. Zero uses the solver option.
+  int max_mpi_message_size_ = 0;
+  bool autotune_sweep_subsets_ = false;
+  int autotune_num_trial_sweeps_ = 3;
 
   std::vector<SubSetInfo> grp_subset_infos_;
 
@@ -43,6 +47,10 @@ public:
   int gmres_restart_intvl_ = 30;
 
   bool allow_cycles_ = false;
+  /// Sub-iterate local cyclic dependencies within each sweep instead of lagging them
+  bool resolve_local_cycles_ = false;
+  int local_cycle_max_iterations_ = 100;
+  double local_cycle_tolerance_ = 1.0e-10;
   bool log_sweep_events_ = false;
 
   bool apply_wgdsa_ = false;
@@ -55,6 +63,8 @@ public:
   bool tgdsa_verbose_ = false;
   std::string wgdsa_string_;
   std::string tgdsa_string_;
+  bool wgdsa_matrix_free_ = false;
+  bool tgdsa_matrix_free_ = false;
 
   std::shared_ptr<DiffusionMIPSolver> wgdsa_solver_;
   std::shared_ptr<DiffusionMIPSolver> tgdsa_solver_;
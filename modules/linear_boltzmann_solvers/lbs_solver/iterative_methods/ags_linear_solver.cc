@@ -115,6 +115,8 @@ AGSLinearSolver::Solve()
 
     lbs_solver.QMomentsLocal() = saved_qmoms; // Restore qmoms
 
+    lbs_solver.WriteRestartDataIfDue();
+
     if (error_norm < tolerance_options_.residual_absolute)
       break;
   } // for iteration
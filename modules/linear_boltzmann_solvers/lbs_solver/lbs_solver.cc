@@ -8,13 +8,19 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/acceleration/diffusion_mip_solver.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/groupset/lbs_groupset.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/point_source/point_source.h"
+#include "modules/linear_boltzmann_solvers/discrete_ordinates_solver/sweep/angle_aggregation/angle_aggregation.h"
 #include "framework/math/spatial_discretization/finite_element/piecewise_linear/piecewise_linear_discontinuous.h"
 #include "framework/physics/physics_material/multi_group_xs/adjoint_mgxs.h"
 #include "framework/physics/physics_material/physics_material.h"
 #include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mpi/mpi_cell_record_file.h"
+#include "framework/mpi/mpi_utils.h"
 #include "framework/math/time_integrations/time_integration.h"
+#include "framework/data_types/compressed_vector.h"
+#include "framework/data_types/byte_array.h"
 #include "framework/field_functions/field_function_grid_based.h"
 #include "framework/logging/log.h"
+#include "framework/utils/timer.h"
 #include "framework/runtime.h"
 #include "framework/memory_usage.h"
 #include "framework/object_factory.h"
@@ -99,6 +105,11 @@ LBSSolver::LBSSolver(const InputParameters& params) : Solver(params)
   }
 }
 
+LBSSolver::~LBSSolver()
+{
+  UnregisterMemoryConsumers(this);
+}
+
 size_t
 LBSSolver::GetSourceEventTag() const
 {
@@ -345,15 +356,80 @@ LBSSolver::PrecursorsNewLocal() const
 std::vector<VecDbl>&
 LBSSolver::PsiNewLocal()
 {
+  OpenSnLogicalErrorIf(options_.angular_flux_storage != AngularFluxStorage::DENSE,
+                       "Angular fluxes that are not stored densely are only accessible per "
+                       "groupset through ScopedPsiNewLocal.");
   return psi_new_local_;
 }
 
 const std::vector<VecDbl>&
 LBSSolver::PsiNewLocal() const
 {
+  OpenSnLogicalErrorIf(options_.angular_flux_storage != AngularFluxStorage::DENSE,
+                       "Angular fluxes that are not stored densely are only accessible per "
+                       "groupset through ScopedPsiNewLocal.");
   return psi_new_local_;
 }
 
+void
+LBSSolver::CompressAngularFluxes(int groupset_id)
+{
+  if (options_.angular_flux_storage == AngularFluxStorage::DENSE)
+    return;
+
+  auto& psi = psi_new_local_.at(groupset_id);
+  if (psi.empty())
+    return;
+
+  std::string spill_file_name;
+  if (options_.angular_flux_storage == AngularFluxStorage::DISK)
+    spill_file_name = options_.angular_flux_spill_folder_name + "/" + TextName() + "_psi_gs" +
+                      std::to_string(groupset_id) + "_" + std::to_string(opensn::mpi_comm.rank()) +
+                      ".bin";
+
+  // Each block holds all angles and groups of one node. The previous store is
+  // released first because it may own the spill file.
+  const auto& groupset = groupsets_.at(groupset_id);
+  auto& psi_compressed = psi_compressed_local_.at(groupset_id);
+  psi_compressed = nullptr;
+  psi_compressed = std::make_shared<CompressedVector>(
+    psi,
+    groupset.quadrature_->omegas_.size() * groupset.groups_.size(),
+    options_.angular_flux_compression_tolerance,
+    spill_file_name);
+  psi.clear();
+  psi.shrink_to_fit();
+}
+
+void
+LBSSolver::DecompressAngularFluxes(int groupset_id,
+                                   bool restore_values,
+                                   bool keep_compressed) const
+{
+  auto& psi_compressed = psi_compressed_local_.at(groupset_id);
+  if (not psi_compressed)
+    return;
+
+  auto& psi = psi_new_local_.at(groupset_id);
+  if (restore_values)
+    psi_compressed->Decompress(psi);
+  else
+    psi.assign(psi_compressed->Size(), 0.0);
+  if (not keep_compressed)
+    psi_compressed = nullptr;
+}
+
+void
+LBSSolver::ReleaseDenseAngularFluxes(int groupset_id) const
+{
+  if (not psi_compressed_local_.at(groupset_id))
+    return;
+
+  auto& psi = psi_new_local_.at(groupset_id);
+  psi.clear();
+  psi.shrink_to_fit();
+}
+
 std::vector<double>&
 LBSSolver::DensitiesLocal()
 {
@@ -378,6 +454,12 @@ LBSSolver::GetActiveSetSourceFunction() const
   return active_set_source_function_;
 }
 
+void
+LBSSolver::SetActiveSetSourceFunction(SetSourceFunction source_function)
+{
+  active_set_source_function_ = std::move(source_function);
+}
+
 std::shared_ptr<AGSLinearSolver>
 LBSSolver::GetPrimaryAGSSolver()
 {
@@ -467,10 +549,28 @@ LBSSolver::OptionsBlock()
     "write_restart_folder_name", "YRestart", "Folder name to use when writing restart data.");
   params.AddOptionalParameter(
     "write_restart_file_base", "restart", "File base name to use when writing restart data.");
-  params.AddOptionalParameter(
-    "write_restart_interval",
-    30.0,
-    "Interval at which restart data is to be written. Currently not implemented.");
+  params.AddOptionalParameter("write_restart_interval",
+                              30.0,
+                              "Interval, in minutes, at which restart data is written during "
+                              "across-groupset iterations.");
+  params.AddOptionalParameter("shared_restart_file",
+                              true,
+                              "Flag indicating whether restart data is written to a single file "
+                              "shared by all processes using collective MPI-IO. Shared restart "
+                              "files can be read with a different number of processes. If false, "
+                              "each process writes its own file.");
+  params.AddOptionalParameter("write_restart_async",
+                              false,
+                              "Flag indicating whether restart data is written asynchronously. "
+                              "The flux moments are copied to a staging buffer and written to "
+                              "the shared restart file with nonblocking collective MPI-IO, "
+                              "overlapping with subsequent iterations. Requires "
+                              "`shared_restart_file`.");
+  params.AddOptionalParameter("write_restart_memory_budget",
+                              1024.0,
+                              "Maximum size, in MB, of the staging buffer of asynchronous "
+                              "restart writes on any process. Restart data exceeding the budget "
+                              "is written synchronously.");
   params.AddOptionalParameter(
     "use_precursors", false, "Flag for using delayed neutron precursors.");
   params.AddOptionalParameter(
@@ -480,6 +580,24 @@ LBSSolver::OptionsBlock()
     "obtained elsewhere.");
   params.AddOptionalParameter(
     "save_angular_flux", false, "Flag indicating whether angular fluxes are to be stored or not.");
+  params.AddOptionalParameter(
+    "angular_flux_storage",
+    "dense",
+    "How saved angular fluxes are stored between groupset solves. Can be `\"dense\"`, "
+    "`\"compressed\"` or `\"disk\"`. Compressed angular fluxes are quantized per node "
+    "with the error bound `angular_flux_compression_tolerance` and are "
+    "decompressed while a groupset is swept or its angular fluxes are accessed. With "
+    "`\"disk\"` the compressed data is written to files in "
+    "`angular_flux_spill_folder_name`.");
+  params.AddOptionalParameter("angular_flux_compression_tolerance",
+                              1.0e-6,
+                              "Error bound of compressed angular fluxes, relative to the "
+                              "largest magnitude over the angles and groups of a node. A "
+                              "value of zero stores the angular fluxes losslessly.");
+  params.AddOptionalParameter("angular_flux_spill_folder_name",
+                              ".",
+                              "Folder in which angular fluxes are stored with "
+                              "`angular_flux_storage = \"disk\"`.");
   params.AddOptionalParameter(
     "adjoint", false, "Flag for toggling whether the solver is in adjoint mode.");
   params.AddOptionalParameter(
@@ -488,6 +606,10 @@ LBSSolver::OptionsBlock()
     "verbose_outer_iterations", true, "Flag to control verbosity of across-groupset iterations.");
   params.AddOptionalParameter(
     "verbose_ags_iterations", false, "Flag to control verbosity of across-groupset iterations.");
+  params.AddOptionalParameter("log_memory_usage",
+                              false,
+                              "Flag to log the memory usage by subsystem, maximized over "
+                              "processes, at the end of initialization.");
   params.AddOptionalParameter(
     "power_field_function_on",
     false,
@@ -544,6 +666,11 @@ LBSSolver::OptionsBlock()
   params.ConstrainParameterRange("spatial_discretization", AllowableRangeList::New({"pwld"}));
   params.ConstrainParameterRange("field_function_prefix_option",
                                  AllowableRangeList::New({"prefix", "solver_name"}));
+  params.ConstrainParameterRange("write_restart_memory_budget", AllowableRangeLowLimit::New(0.0));
+  params.ConstrainParameterRange("angular_flux_storage",
+                                 AllowableRangeList::New({"dense", "compressed", "disk"}));
+  params.ConstrainParameterRange("angular_flux_compression_tolerance",
+                                 AllowableRangeLowLimit::New(0.0));
 
   return params;
 }
@@ -621,8 +748,11 @@ LBSSolver::SetOptions(const InputParameters& params)
         // Set all solutions to zero.
         phi_old_local_.assign(phi_old_local_.size(), 0.0);
         phi_new_local_.assign(phi_new_local_.size(), 0.0);
-        for (auto& psi : psi_new_local_)
-          psi.assign(psi.size(), 0.0);
+        for (size_t gs = 0; gs < psi_new_local_.size(); ++gs)
+        {
+          auto psi = ScopedPsiNewLocal(static_cast<int>(gs));
+          psi->assign(psi->size(), 0.0);
+        }
         precursor_new_local_.assign(precursor_new_local_.size(), 0.0);
       }
     }
@@ -667,6 +797,15 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "write_restart_interval")
       options_.write_restart_interval = spec.GetValue<double>();
 
+    else if (spec.Name() == "shared_restart_file")
+      options_.shared_restart_file = spec.GetValue<bool>();
+
+    else if (spec.Name() == "write_restart_async")
+      options_.write_restart_async = spec.GetValue<bool>();
+
+    else if (spec.Name() == "write_restart_memory_budget")
+      options_.write_restart_memory_budget = spec.GetValue<double>();
+
     else if (spec.Name() == "use_precursors")
       options_.use_precursors = spec.GetValue<bool>();
 
@@ -676,6 +815,23 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "save_angular_flux")
       options_.save_angular_flux = spec.GetValue<bool>();
 
+    else if (spec.Name() == "angular_flux_storage")
+    {
+      const auto storage = spec.GetValue<std::string>();
+      if (storage == "dense")
+        options_.angular_flux_storage = AngularFluxStorage::DENSE;
+      else if (storage == "compressed")
+        options_.angular_flux_storage = AngularFluxStorage::COMPRESSED;
+      else if (storage == "disk")
+        options_.angular_flux_storage = AngularFluxStorage::DISK;
+    }
+
+    else if (spec.Name() == "angular_flux_compression_tolerance")
+      options_.angular_flux_compression_tolerance = spec.GetValue<double>();
+
+    else if (spec.Name() == "angular_flux_spill_folder_name")
+      options_.angular_flux_spill_folder_name = spec.GetValue<std::string>();
+
     else if (spec.Name() == "verbose_inner_iterations")
       options_.verbose_inner_iterations = spec.GetValue<bool>();
 
@@ -685,6 +841,9 @@ LBSSolver::SetOptions(const InputParameters& params)
     else if (spec.Name() == "verbose_outer_iterations")
       options_.verbose_outer_iterations = spec.GetValue<bool>();
 
+    else if (spec.Name() == "log_memory_usage")
+      options_.log_memory_usage = spec.GetValue<bool>();
+
     else if (spec.Name() == "power_field_function_on")
       options_.power_field_function_on = spec.GetValue<bool>();
 
@@ -815,6 +974,212 @@ LBSSolver::Initialize()
     distributed_source.Initialize(*this);
 
   source_event_tag_ = log.GetRepeatingEventTag("Set Source");
+
+  RegisterMemoryConsumers();
+}
+
+void
+LBSSolver::RegisterMemoryConsumers()
+{
+  UnregisterMemoryConsumers(this);
+
+  auto DiscretizationMemoryUsage = [this]
+  { return discretization_ ? discretization_->ComputeMemoryUsage() : 0; };
+
+  auto UnitCellMatricesMemoryUsage = [this]
+  {
+    auto MatricesMemoryUsage = [](const UnitCellMatrices& matrices)
+    {
+      size_t bytes = VectorMemoryUsage(matrices.intV_gradshapeI_gradshapeJ) +
+                     VectorMemoryUsage(matrices.intV_shapeI_gradshapeJ) +
+                     VectorMemoryUsage(matrices.intV_shapeI_shapeJ) +
+                     VectorMemoryUsage(matrices.intV_shapeI) +
+                     VectorMemoryUsage(matrices.intS_shapeI);
+      for (const auto& matrix : matrices.intS_shapeI_shapeJ)
+        bytes += VectorMemoryUsage(matrix);
+      for (const auto& matrix : matrices.intS_shapeI_gradshapeJ)
+        bytes += VectorMemoryUsage(matrix);
+      return bytes;
+    };
+
+    size_t bytes =
+      VectorMemoryUsage(unit_cell_matrices_) + MapMemoryUsage(unit_ghost_cell_matrices_);
+    for (const auto& matrices : unit_cell_matrices_)
+      bytes += MatricesMemoryUsage(matrices);
+    for (const auto& [global_id, matrices] : unit_ghost_cell_matrices_)
+      bytes += MatricesMemoryUsage(matrices);
+    return bytes;
+  };
+
+  auto FluxMomentsMemoryUsage = [this]
+  {
+    return VectorMemoryUsage(q_moments_local_) + VectorMemoryUsage(ext_src_moments_local_) +
+           VectorMemoryUsage(phi_new_local_) + VectorMemoryUsage(phi_old_local_) +
+           VectorMemoryUsage(precursor_new_local_) + VectorMemoryUsage(densities_local_);
+  };
+
+  auto PsiMemoryUsage = [this]
+  {
+    size_t bytes = VectorMemoryUsage(psi_new_local_);
+    for (const auto& psi_compressed : psi_compressed_local_)
+      if (psi_compressed)
+        bytes += psi_compressed->ComputeMemoryUsage();
+    return bytes;
+  };
+
+  auto FLUDSMemoryUsage = [this]
+  {
+    size_t bytes = 0;
+    for (const auto& groupset : groupsets_)
+      if (groupset.angle_agg_)
+        for (auto& angle_set_group : groupset.angle_agg_->angle_set_groups)
+          for (const auto& angle_set : angle_set_group.AngleSets())
+            bytes += angle_set->GetFLUDS().ComputeMemoryUsage();
+    return bytes;
+  };
+
+  auto ReflectingBoundariesMemoryUsage = [this]
+  {
+    size_t bytes = 0;
+    for (const auto& [bid, boundary] : sweep_boundaries_)
+      if (boundary->IsReflecting())
+        bytes += static_cast<const ReflectingBoundary&>(*boundary).ComputeMemoryUsage();
+    return bytes;
+  };
+
+  auto DSAMemoryUsage = [this]
+  {
+    size_t bytes = 0;
+    for (const auto& groupset : groupsets_)
+    {
+      if (groupset.wgdsa_solver_)
+        bytes += groupset.wgdsa_solver_->ComputeMemoryUsage();
+      if (groupset.tgdsa_solver_)
+        bytes += groupset.tgdsa_solver_->ComputeMemoryUsage();
+    }
+    return bytes;
+  };
+
+  RegisterMemoryConsumer(this, "spatial discretization", DiscretizationMemoryUsage);
+  RegisterMemoryConsumer(this, "unit cell matrices", UnitCellMatricesMemoryUsage);
+  RegisterMemoryConsumer(this, "flux moments", FluxMomentsMemoryUsage);
+  RegisterMemoryConsumer(this, "psi", PsiMemoryUsage);
+  RegisterMemoryConsumer(this, "fluds", FLUDSMemoryUsage);
+  RegisterMemoryConsumer(this, "reflecting boundaries", ReflectingBoundariesMemoryUsage);
+  RegisterMemoryConsumer(this, "petsc/dsa", DSAMemoryUsage);
+}
+
+void
+LBSSolver::BindExecutor(const std::string& executor_name)
+{
+  bound_executor_name_ = executor_name;
+}
+
+const std::string&
+LBSSolver::BoundExecutorName() const
+{
+  return bound_executor_name_;
+}
+
+void
+LBSSolver::Repartition(const std::vector<int64_t>& cell_partition_ids)
+{
+  OpenSnLogicalErrorIf(grid_ptr_ == nullptr,
+                       "The solver must be initialized before it can be repartitioned.");
+  OpenSnLogicalErrorIf(GetCurrentMesh() != grid_ptr_,
+                       "Only a solver on the current mesh can be repartitioned.");
+  OpenSnLogicalErrorIf(not bound_executor_name_.empty(),
+                       TextName() + " is bound to the executor " + bound_executor_name_ +
+                         ", which keeps state of the current grid, and cannot be repartitioned.");
+
+  auto new_grid = grid_ptr_->MakeRepartitioned(cell_partition_ids);
+
+  // Visits the state of a cell in a fixed order, on the old grid to pack it and
+  // on the new grid to unpack it. A cell has the same nodes on either grid.
+  auto ForEachCellValue = [this](const Cell& cell, auto&& Visit)
+  {
+    const auto& transport_view = cell_transport_views_[cell.local_id_];
+    const size_t num_nodes = transport_view.NumNodes();
+    const size_t phi_address = transport_view.MapDOF(0, 0, 0);
+    for (auto* phi : {&phi_old_local_, &phi_new_local_, &ext_src_moments_local_})
+      if (not phi->empty())
+        for (size_t k = 0; k < num_nodes * num_moments_ * num_groups_; ++k)
+          Visit((*phi)[phi_address + k]);
+
+    for (size_t gs = 0; gs < groupsets_.size(); ++gs)
+    {
+      auto& psi = psi_new_local_[gs];
+      if (psi.empty())
+        continue;
+
+      const auto& groupset = groupsets_[gs];
+      const size_t num_gs_angles = groupset.quadrature_->omegas_.size();
+      const size_t num_gs_groups = groupset.groups_.size();
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t n = 0; n < num_gs_angles; ++n)
+          for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
+            Visit(psi[discretization_->MapDOFLocal(cell, i, groupset.psi_uk_man_, n, gsg)]);
+    }
+
+    if (not precursor_new_local_.empty())
+      for (size_t j = 0; j < max_precursors_per_material_; ++j)
+        Visit(precursor_new_local_[cell.local_id_ * max_precursors_per_material_ + j]);
+
+    Visit(densities_local_[cell.local_id_]);
+  };
+
+  for (size_t gs = 0; gs < groupsets_.size(); ++gs)
+    DecompressAngularFluxes(static_cast<int>(gs));
+
+  // Pack the state of the local cells, keyed by global-id, for their new partitions
+  std::map<int, ByteArray> pid_send_map;
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    auto& data = pid_send_map[static_cast<int>(cell_partition_ids[cell.local_id_])];
+    data.Write<uint64_t>(cell.global_id_);
+    ForEachCellValue(cell, [&data](const double& value) { data.Write<double>(value); });
+  }
+
+  std::map<int, std::vector<std::byte>> pid_send_map_bytes;
+  for (auto& [pid, data] : pid_send_map)
+    pid_send_map_bytes[pid] = std::move(data.Data());
+  pid_send_map.clear();
+
+  const auto pid_recv_map_bytes = MapAllToAll(pid_send_map_bytes);
+  pid_send_map_bytes.clear();
+
+  // Re-initialize on the new grid. Restart data is not read again.
+  const bool has_ext_src_moments = not ext_src_moments_local_.empty();
+  const bool read_restart_data = options_.read_restart_data;
+  mesh_stack.back() = new_grid;
+  options_.read_restart_data = false;
+  Initialize();
+  options_.read_restart_data = read_restart_data;
+
+  if (has_ext_src_moments)
+    ext_src_moments_local_.assign(phi_new_local_.size(), 0.0);
+
+  // Unpack the state of the new local cells
+  for (const auto& [pid, bytes] : pid_recv_map_bytes)
+  {
+    const ByteArray data(bytes);
+    size_t address = 0;
+    while (address < data.Size())
+    {
+      const auto global_id = data.Read<uint64_t>(address, &address);
+      OpenSnLogicalErrorIf(not grid_ptr_->IsCellLocal(global_id),
+                           "Received the state of cell " + std::to_string(global_id) +
+                             ", which is not local after repartitioning.");
+      ForEachCellValue(grid_ptr_->cells[global_id],
+                       [&data, &address](double& value)
+                       { value = data.Read<double>(address, &address); });
+    }
+  }
+
+  for (size_t gs = 0; gs < groupsets_.size(); ++gs)
+    CompressAngularFluxes(static_cast<int>(gs));
+
+  UpdateFieldFunctions();
 }
 
 void
@@ -1277,6 +1642,7 @@ LBSSolver::InitializeParrays()
 
   // Setup groupset psi vectors
   psi_new_local_.clear();
+  psi_compressed_local_.assign(groupsets_.size(), nullptr);
   for (auto& groupset : groupsets_)
   {
     psi_new_local_.emplace_back();
@@ -1438,7 +1804,24 @@ void
 LBSSolver::InitializeFieldFunctions()
 {
   if (not field_functions_.empty())
+  {
+    if (&field_functions_.front()->GetSpatialDiscretization() == discretization_.get())
+      return;
+
+    // The solver was re-initialized on a new grid. The field functions are
+    // replaced in place so that their handles remain valid.
+    for (auto& ff : field_functions_)
+    {
+      auto new_ff =
+        std::make_shared<FieldFunctionGridBased>(ff->TextName(), discretization_, ff->Unknown());
+      std::replace(field_function_stack.begin(),
+                   field_function_stack.end(),
+                   std::static_pointer_cast<FieldFunction>(ff),
+                   std::static_pointer_cast<FieldFunction>(new_ff));
+      ff = new_ff;
+    }
     return;
+  }
 
   // Initialize Field Functions
   //                                              for flux moments
@@ -1629,6 +2012,11 @@ LBSSolver::InitializeSolverSchemes()
 
     primary_ags_solver_ = ags_solvers_.front();
   }
+
+  // This is the last step of initializing any LBS solver. Logging the memory
+  // usage involves collectives, so it is only done on request.
+  if (options_.log_memory_usage)
+    LogSubsystemMemoryUsage();
 }
 
 void
@@ -1664,6 +2052,7 @@ lbs::LBSSolver::InitWGDSA(LBSGroupset& groupset, bool vaccum_bcs_are_dirichlet)
     solver->options.max_iters = groupset.wgdsa_max_iters_;
     solver->options.verbose = groupset.wgdsa_verbose_;
     solver->options.additional_options_string = groupset.wgdsa_string_;
+    solver->options.matrix_free = groupset.wgdsa_matrix_free_;
 
     solver->Initialize();
 
@@ -1868,6 +2257,7 @@ lbs::LBSSolver::InitTGDSA(LBSGroupset& groupset)
     solver->options.max_iters = groupset.tgdsa_max_iters_;
     solver->options.verbose = groupset.tgdsa_verbose_;
     solver->options.additional_options_string = groupset.tgdsa_string_;
+    solver->options.matrix_free = groupset.tgdsa_matrix_free_;
 
     solver->Initialize();
 
@@ -1961,24 +2351,47 @@ LBSSolver::DisAssembleTGDSADeltaPhiVector(const LBSGroupset& groupset,
   }   // for cell
 }
 
-void
-LBSSolver::WriteRestartData(const std::string& folder_name, const std::string& file_base) const
+namespace
+{
+/**Creates the restart folder on the root, if it does not exist. Returns,
+ * on all processes, whether the folder is available.*/
+bool
+CreateRestartFolder(const std::string& folder_name)
 {
   typedef struct stat Stat;
   Stat st;
 
-  // Make sure folder exists
+  int folder_available = 1;
   if (opensn::mpi_comm.rank() == 0)
   {
     if (stat(folder_name.c_str(), &st) != 0) // if not exist, make it
       if ((mkdir(folder_name.c_str(), S_IRWXU | S_IRWXG | S_IRWXO) != 0) and (errno != EEXIST))
       {
         log.Log0Warning() << "Failed to create restart directory: " << folder_name;
-        return;
+        folder_available = 0;
       }
   }
 
-  opensn::mpi_comm.barrier();
+  opensn::mpi_comm.broadcast(folder_available, 0);
+  return folder_available == 1;
+}
+} // namespace
+
+void
+LBSSolver::WriteRestartData(const std::string& folder_name, const std::string& file_base) const
+{
+  // Make sure folder exists
+  if (not CreateRestartFolder(folder_name))
+    return;
+
+  // Write a single shared file
+  if (options_.shared_restart_file)
+  {
+    const auto file_name = folder_name + std::string("/") + file_base + std::string(".r");
+    WriteFluxMomentsCollective(phi_old_local_, file_name);
+    log.Log() << "Successfully wrote restart data: " << file_name;
+    return;
+  }
 
   // Create files
   // This step might fail for specific locations and
@@ -2004,8 +2417,7 @@ LBSSolver::WriteRestartData(const std::string& folder_name, const std::string& f
   {
     size_t phi_old_size = phi_old_local_.size();
     ofile.write((char*)&phi_old_size, sizeof(size_t));
-    for (auto val : phi_old_local_)
-      ofile.write((char*)&val, sizeof(double));
+    ofile.write((char*)phi_old_local_.data(), phi_old_size * sizeof(double));
 
     ofile.close();
   }
@@ -2027,6 +2439,15 @@ LBSSolver::WriteRestartData(const std::string& folder_name, const std::string& f
 void
 LBSSolver::ReadRestartData(const std::string& folder_name, const std::string& file_base)
 {
+  // Read a single shared file, if present
+  const auto shared_file_name = folder_name + std::string("/") + file_base + std::string(".r");
+  if (IsCellRecordFile(shared_file_name))
+  {
+    ReadFluxMomentsCollective(shared_file_name, phi_old_local_);
+    log.Log() << "Successfully read restart data: " << shared_file_name;
+    return;
+  }
+
   opensn::mpi_comm.barrier();
 
   // Open files
@@ -2061,15 +2482,9 @@ LBSSolver::ReadRestartData(const std::string& folder_name, const std::string& fi
     else
     {
       std::vector<double> temp_phi_old(phi_old_local_.size(), 0.0);
+      ifile.read((char*)temp_phi_old.data(), number_of_unknowns * sizeof(double));
 
-      size_t v = 0;
-      while (not ifile.eof())
-      {
-        ifile.read((char*)&temp_phi_old[v], sizeof(double));
-        ++v;
-      }
-
-      if (v != (number_of_unknowns + 1))
+      if (static_cast<size_t>(ifile.gcount()) != number_of_unknowns * sizeof(double))
       {
         location_succeeded = false;
         ifile.close();
@@ -2180,6 +2595,13 @@ void
 LBSSolver::ReadAngularFluxes(const std::string& file_base,
                              std::vector<std::vector<double>>& dest) const
 {
+  // Read a single shared file, if present
+  if (IsCellRecordFile(file_base + ".data"))
+  {
+    ReadAngularFluxesCollective(file_base + ".data", dest);
+    return;
+  }
+
   // Open file
   const auto file_name = file_base + std::to_string(opensn::mpi_comm.rank()) + ".data";
   std::ifstream file(file_name,
@@ -2537,6 +2959,13 @@ LBSSolver::ReadFluxMoments(const std::string& file_base,
                            std::vector<double>& dest,
                            bool single_file) const
 {
+  // Read a single shared file, if present
+  if (IsCellRecordFile(file_base + ".data"))
+  {
+    ReadFluxMomentsCollective(file_base + ".data", dest);
+    return;
+  }
+
   // Open file
   const auto file_name =
     file_base + (single_file ? "" : std::to_string(opensn::mpi_comm.rank())) + ".data";
@@ -2662,6 +3091,302 @@ LBSSolver::ReadFluxMoments(const std::string& file_base,
   file.close();
 }
 
+namespace
+{
+/**Identifiers stored as the first metadata entry of shared flux files.*/
+constexpr uint64_t FLUX_MOMENTS_RECORDS = 0;
+constexpr uint64_t ANGULAR_FLUXES_RECORDS = 1;
+} // namespace
+
+std::vector<size_t>
+LBSSolver::MapFileCellNodes(const Cell& cell,
+                            const double* file_node_xyz,
+                            size_t num_file_nodes) const
+{
+  const auto nodes = discretization_->GetCellNodeLocations(cell);
+  OpenSnLogicalErrorIf(nodes.size() != num_file_nodes,
+                       "Incompatible number of cell nodes encountered on cell " +
+                         std::to_string(cell.global_id_) + ".");
+
+  std::vector<size_t> mapping(num_file_nodes, 0);
+  for (size_t n = 0; n < num_file_nodes; ++n)
+  {
+    const Vector3 file_node(
+      file_node_xyz[3 * n], file_node_xyz[3 * n + 1], file_node_xyz[3 * n + 2]);
+
+    bool mapping_found = false;
+    for (size_t m = 0; m < nodes.size(); ++m)
+      if ((nodes[m] - file_node).NormSquare() < 1.0e-12)
+      {
+        mapping[n] = m;
+        mapping_found = true;
+        break;
+      }
+
+    OpenSnLogicalErrorIf(not mapping_found,
+                         "Incompatible node locations for cell " +
+                           std::to_string(cell.global_id_) + ".");
+  }
+  return mapping;
+}
+
+CellRecords
+LBSSolver::MakeFluxMomentRecords(const std::vector<double>& src) const
+{
+  const auto& uk_man = flux_moments_uk_man_;
+  OpenSnLogicalErrorIf(src.size() != discretization_->GetNumLocalDOFs(uk_man),
+                       "Incompatible flux moments vector provided.");
+
+  CellRecords records;
+  records.values.reserve(src.size() + 3 * local_node_count_);
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    for (const auto& node : discretization_->GetCellNodeLocations(cell))
+      records.values.insert(records.values.end(), {node.x, node.y, node.z});
+
+    const size_t num_nodes = discretization_->GetCellNumNodes(cell);
+    for (size_t i = 0; i < num_nodes; ++i)
+      for (size_t m = 0; m < num_moments_; ++m)
+        for (size_t g = 0; g < num_groups_; ++g)
+          records.values.push_back(src[discretization_->MapDOFLocal(cell, i, uk_man, m, g)]);
+
+    records.CloseRecord(cell.global_id_);
+  }
+
+  return records;
+}
+
+void
+LBSSolver::WriteFluxMomentsCollective(const std::vector<double>& src,
+                                      const std::string& file_name) const
+{
+  log.Log() << "Writing flux moments to " << file_name;
+
+  WriteCellRecordsCollective(
+    file_name, {FLUX_MOMENTS_RECORDS, num_moments_, num_groups_}, MakeFluxMomentRecords(src));
+}
+
+void
+LBSSolver::ReadFluxMomentsCollective(const std::string& file_name, std::vector<double>& dest) const
+{
+  log.Log() << "Reading flux moments from " << file_name;
+
+  std::vector<uint64_t> global_ids;
+  global_ids.reserve(grid_ptr_->local_cells.size());
+  for (const auto& cell : grid_ptr_->local_cells)
+    global_ids.push_back(cell.global_id_);
+
+  CellRecords records;
+  const auto metadata = ReadCellRecordsCollective(file_name, global_ids, records);
+
+  OpenSnLogicalErrorIf(metadata.size() != 3 or metadata[0] != FLUX_MOMENTS_RECORDS,
+                       file_name + " does not contain flux moments.");
+  OpenSnLogicalErrorIf(metadata[1] != num_moments_,
+                       "Incompatible number of moments found in file " + file_name + ".");
+  OpenSnLogicalErrorIf(metadata[2] != num_groups_,
+                       "Incompatible number of groups found in file " + file_name + ".");
+
+  const auto& uk_man = flux_moments_uk_man_;
+  const size_t node_record_size = 3 + num_moments_ * num_groups_;
+
+  dest.assign(discretization_->GetNumLocalDOFs(uk_man), 0.0);
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const size_t r = cell.local_id_;
+    OpenSnLogicalErrorIf(records.RecordSize(r) % node_record_size != 0,
+                         "Incompatible record size for cell " + std::to_string(cell.global_id_) +
+                           " in file " + file_name + ".");
+
+    const size_t num_file_nodes = records.RecordSize(r) / node_record_size;
+    const double* record = records.RecordData(r);
+    const auto mapping = MapFileCellNodes(cell, record, num_file_nodes);
+
+    const double* values = record + 3 * num_file_nodes;
+    for (size_t n = 0; n < num_file_nodes; ++n)
+      for (size_t m = 0; m < num_moments_; ++m)
+        for (size_t g = 0; g < num_groups_; ++g)
+          dest[discretization_->MapDOFLocal(cell, mapping[n], uk_man, m, g)] = *values++;
+  }
+}
+
+void
+LBSSolver::WriteAngularFluxesCollective(const std::vector<std::vector<double>>& src,
+                                        const std::string& file_name) const
+{
+  log.Log() << "Writing angular fluxes to " << file_name;
+
+  OpenSnLogicalErrorIf(src.size() != groupsets_.size(),
+                       "Incompatible number of groupset angular flux vectors provided.");
+
+  std::vector<uint64_t> metadata = {ANGULAR_FLUXES_RECORDS, groupsets_.size()};
+  for (const auto& groupset : groupsets_)
+  {
+    OpenSnLogicalErrorIf(src[groupset.id_].size() !=
+                           discretization_->GetNumLocalDOFs(groupset.psi_uk_man_),
+                         "Incompatible angular flux vector provided for groupset " +
+                           std::to_string(groupset.id_) + ".");
+    metadata.push_back(groupset.quadrature_->omegas_.size());
+    metadata.push_back(groupset.groups_.size());
+  }
+
+  // Each record holds the nodal positions followed by, for each groupset,
+  // the values ordered by node, angle and group
+  CellRecords records;
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    for (const auto& node : discretization_->GetCellNodeLocations(cell))
+      records.values.insert(records.values.end(), {node.x, node.y, node.z});
+
+    const size_t num_nodes = discretization_->GetCellNumNodes(cell);
+    for (const auto& groupset : groupsets_)
+    {
+      const auto& uk_man = groupset.psi_uk_man_;
+      const auto& psi = src[groupset.id_];
+      const size_t num_gs_angles = groupset.quadrature_->omegas_.size();
+      const size_t num_gs_groups = groupset.groups_.size();
+      for (size_t i = 0; i < num_nodes; ++i)
+        for (size_t n = 0; n < num_gs_angles; ++n)
+          for (size_t g = 0; g < num_gs_groups; ++g)
+            records.values.push_back(psi[discretization_->MapDOFLocal(cell, i, uk_man, n, g)]);
+    }
+
+    records.CloseRecord(cell.global_id_);
+  }
+
+  WriteCellRecordsCollective(file_name, metadata, records);
+}
+
+void
+LBSSolver::ReadAngularFluxesCollective(const std::string& file_name,
+                                       std::vector<std::vector<double>>& dest) const
+{
+  log.Log() << "Reading angular fluxes from " << file_name;
+
+  std::vector<uint64_t> global_ids;
+  global_ids.reserve(grid_ptr_->local_cells.size());
+  for (const auto& cell : grid_ptr_->local_cells)
+    global_ids.push_back(cell.global_id_);
+
+  CellRecords records;
+  const auto metadata = ReadCellRecordsCollective(file_name, global_ids, records);
+
+  OpenSnLogicalErrorIf(metadata.size() < 2 or metadata[0] != ANGULAR_FLUXES_RECORDS,
+                       file_name + " does not contain angular fluxes.");
+  OpenSnLogicalErrorIf(metadata[1] != groupsets_.size() or
+                         metadata.size() != 2 + 2 * groupsets_.size(),
+                       "Incompatible number of groupsets found in file " + file_name + ".");
+
+  size_t node_record_size = 3;
+  dest.clear();
+  for (const auto& groupset : groupsets_)
+  {
+    const size_t num_gs_angles = groupset.quadrature_->omegas_.size();
+    const size_t num_gs_groups = groupset.groups_.size();
+    OpenSnLogicalErrorIf(metadata[2 + 2 * groupset.id_] != num_gs_angles,
+                         "Incompatible number of groupset angles found in file " + file_name +
+                           " for groupset " + std::to_string(groupset.id_) + ".");
+    OpenSnLogicalErrorIf(metadata[3 + 2 * groupset.id_] != num_gs_groups,
+                         "Incompatible number of groupset groups found in file " + file_name +
+                           " for groupset " + std::to_string(groupset.id_) + ".");
+
+    node_record_size += num_gs_angles * num_gs_groups;
+    dest.emplace_back(discretization_->GetNumLocalDOFs(groupset.psi_uk_man_), 0.0);
+  }
+
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const size_t r = cell.local_id_;
+    OpenSnLogicalErrorIf(records.RecordSize(r) % node_record_size != 0,
+                         "Incompatible record size for cell " + std::to_string(cell.global_id_) +
+                           " in file " + file_name + ".");
+
+    const size_t num_file_nodes = records.RecordSize(r) / node_record_size;
+    const double* record = records.RecordData(r);
+    const auto mapping = MapFileCellNodes(cell, record, num_file_nodes);
+
+    const double* values = record + 3 * num_file_nodes;
+    for (const auto& groupset : groupsets_)
+    {
+      const auto& uk_man = groupset.psi_uk_man_;
+      auto& psi = dest[groupset.id_];
+      const size_t num_gs_angles = groupset.quadrature_->omegas_.size();
+      const size_t num_gs_groups = groupset.groups_.size();
+      for (size_t i = 0; i < num_file_nodes; ++i)
+        for (size_t n = 0; n < num_gs_angles; ++n)
+          for (size_t g = 0; g < num_gs_groups; ++g)
+            psi[discretization_->MapDOFLocal(cell, mapping[i], uk_man, n, g)] = *values++;
+    }
+  }
+}
+
+void
+LBSSolver::WriteRestartDataIfDue()
+{
+  if (restart_writer_)
+    restart_writer_->Progress();
+
+  if (not options_.write_restart_data)
+    return;
+
+  // Decide on the root so that all processes enter the collective write
+  const double time_minutes = program_timer.GetTime() / 60000.0;
+  int due = (time_minutes - last_restart_write_) >= options_.write_restart_interval ? 1 : 0;
+  opensn::mpi_comm.broadcast(due, 0);
+  if (due == 0)
+    return;
+
+  last_restart_write_ = time_minutes;
+  if (options_.write_restart_async)
+    WriteRestartDataAsync(options_.write_restart_folder_name, options_.write_restart_file_base);
+  else
+    WriteRestartData(options_.write_restart_folder_name, options_.write_restart_file_base);
+}
+
+void
+LBSSolver::WriteRestartDataAsync(const std::string& folder_name, const std::string& file_base)
+{
+  // The staging buffer holds the nodal positions and the flux moments
+  const double local_staging_mb =
+    static_cast<double>(phi_old_local_.size() + 3 * local_node_count_) * sizeof(double) /
+    (1024.0 * 1024.0);
+  double max_staging_mb = 0.0;
+  mpi_comm.all_reduce(local_staging_mb, max_staging_mb, mpi::op::max<double>());
+
+  if (not options_.shared_restart_file or max_staging_mb > options_.write_restart_memory_budget)
+  {
+    if (options_.shared_restart_file)
+      log.Log0Warning() << "Restart data staging buffer of " << max_staging_mb
+                        << " MB exceeds the memory budget of "
+                        << options_.write_restart_memory_budget
+                        << " MB. Writing restart data synchronously.";
+    FinishRestartWrites();
+    WriteRestartData(folder_name, file_base);
+    return;
+  }
+
+  if (not CreateRestartFolder(folder_name))
+    return;
+
+  if (not restart_writer_)
+    restart_writer_ = std::make_shared<AsyncCellRecordWriter>();
+
+  const auto file_name = folder_name + std::string("/") + file_base + std::string(".r");
+  restart_writer_->Start(file_name,
+                         {FLUX_MOMENTS_RECORDS, num_moments_, num_groups_},
+                         MakeFluxMomentRecords(phi_old_local_));
+  log.Log() << "Started asynchronous write of restart data: " << file_name;
+}
+
+void
+LBSSolver::FinishRestartWrites()
+{
+  if (restart_writer_ and restart_writer_->InFlight())
+  {
+    restart_writer_->Wait();
+    log.Log() << "Successfully wrote restart data asynchronously";
+  }
+}
+
 void
 LBSSolver::UpdateFieldFunctions()
 {
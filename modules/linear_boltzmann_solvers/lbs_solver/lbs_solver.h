@@ -10,12 +10,16 @@
 #include "framework/math/linear_solver/linear_solver.h"
 #include "framework/physics/solver_base/solver.h"
 #include <petscksp.h>
+#include <type_traits>
 
 namespace opensn
 {
 
 class MPICommunicatorSet;
 class GridFaceHistogram;
+class AsyncCellRecordWriter;
+class CompressedVector;
+struct CellRecords;
 
 class TimeIntegration;
 
@@ -38,7 +42,7 @@ public:
   LBSSolver(const LBSSolver&) = delete;
   LBSSolver& operator=(const LBSSolver&) = delete;
 
-  virtual ~LBSSolver() = default;
+  virtual ~LBSSolver();
 
   /**
    * Returns the source event tag used for logging the time it takes to set source moments.
@@ -243,15 +247,96 @@ public:
   const std::vector<double>& PrecursorsNewLocal() const;
 
   /**
-   * Read/write access to newest updated angular flux vector.
+   * Read/write access to newest updated angular flux vector. Only available with
+   * dense `angular_flux_storage`; use `ScopedPsiNewLocal` otherwise.
    */
   std::vector<VecDbl>& PsiNewLocal();
 
   /**
-   * Read access to newest updated angular flux vector.
+   * Read access to newest updated angular flux vector. Only available with dense
+   * `angular_flux_storage`; use `ScopedPsiNewLocal` otherwise.
    */
   const std::vector<VecDbl>& PsiNewLocal() const;
 
+  /**
+   * Dense access to the angular fluxes of one groupset for the lifetime of the
+   * object. Compressed angular fluxes are decompressed into the dense storage when
+   * the object is created. When it is destroyed, writable access compresses them
+   * again and read-only access releases the dense copy, so compressed angular
+   * fluxes only take their dense size while they are in use.
+   */
+  template <bool Writable>
+  class ScopedAngularFluxes
+  {
+  public:
+    using SolverType = std::conditional_t<Writable, LBSSolver, const LBSSolver>;
+    using ValuesType =
+      std::conditional_t<Writable, std::vector<double>, const std::vector<double>>;
+
+    ScopedAngularFluxes(SolverType& solver, int groupset_id)
+      : solver_(solver),
+        groupset_id_(groupset_id),
+        compressed_(solver.psi_compressed_local_.at(groupset_id) != nullptr)
+    {
+      if (compressed_)
+        solver_.DecompressAngularFluxes(groupset_id_, true, not Writable);
+    }
+
+    ~ScopedAngularFluxes()
+    {
+      if (not compressed_)
+        return;
+      if constexpr (Writable)
+        solver_.CompressAngularFluxes(groupset_id_);
+      else
+        solver_.ReleaseDenseAngularFluxes(groupset_id_);
+    }
+
+    ScopedAngularFluxes(const ScopedAngularFluxes&) = delete;
+    ScopedAngularFluxes& operator=(const ScopedAngularFluxes&) = delete;
+
+    ValuesType& operator*() const { return solver_.psi_new_local_.at(groupset_id_); }
+    ValuesType* operator->() const { return &solver_.psi_new_local_.at(groupset_id_); }
+
+  private:
+    SolverType& solver_;
+    const int groupset_id_;
+    const bool compressed_;
+  };
+
+  /**
+   * Scoped read/write access to the angular fluxes of a groupset, in any
+   * `angular_flux_storage`. Modified compressed angular fluxes are compressed
+   * again when the access ends.
+   */
+  ScopedAngularFluxes<true> ScopedPsiNewLocal(int groupset_id) { return {*this, groupset_id}; }
+
+  /**
+   * Scoped read access to the angular fluxes of a groupset, in any
+   * `angular_flux_storage`. The compressed data is kept unchanged.
+   */
+  ScopedAngularFluxes<false> ScopedPsiNewLocal(int groupset_id) const
+  {
+    return {*this, groupset_id};
+  }
+
+  /**
+   * Replaces the angular fluxes of a groupset by their compressed form, releasing
+   * the dense storage, unless `angular_flux_storage` is dense. Scoped accessors and
+   * sweeps decompress them again.
+   */
+  void CompressAngularFluxes(int groupset_id);
+
+  /**
+   * Restores the dense angular fluxes of a groupset if they are compressed. If
+   * `restore_values` is false, e.g., when the angular fluxes are about to be
+   * overwritten by a sweep, the dense storage is zeroed instead. The compressed
+   * data is released unless `keep_compressed` is true.
+   */
+  void DecompressAngularFluxes(int groupset_id,
+                               bool restore_values = true,
+                               bool keep_compressed = false) const;
+
   /**
    * Read/write access to the cell-wise densities.
    */
@@ -269,6 +354,13 @@ public:
 
   SetSourceFunction GetActiveSetSourceFunction() const;
 
+  /**
+   * Replaces the active source function. Solvers created by the solver
+   * schemes reference the active source function and therefore use the new
+   * one without being recreated.
+   */
+  void SetActiveSetSourceFunction(SetSourceFunction source_function);
+
   std::shared_ptr<AGSLinearSolver> GetPrimaryAGSSolver();
 
   std::vector<std::shared_ptr<LinearSolver>>& GetWGSSolvers();
@@ -336,15 +428,41 @@ public:
                                       std::vector<double>& ref_phi_new);
 
   /**
-   * Writes phi_old to restart file.
+   * Writes phi_old to restart file. If the `shared_restart_file` option is set,
+   * all processes write to the single file `folder_name/file_base.r`,
+   * otherwise each process writes its own file `folder_name/file_baseX.r`.
    */
   void WriteRestartData(const std::string& folder_name, const std::string& file_base) const;
 
   /**
-   * Read phi_old from restart file.
+   * Read phi_old from restart file. A shared restart file is used if present,
+   * in which case the number of processes may differ from the one used to
+   * write it.
    */
   void ReadRestartData(const std::string& folder_name, const std::string& file_base);
 
+  /**
+   * Writes restart data if `write_restart_data` is set and at least
+   * `write_restart_interval` minutes have passed since the last write. The
+   * decision is made on the root and broadcast, so this must be called
+   * collectively. Also pushes the progress of an asynchronous write in flight.
+   */
+  void WriteRestartDataIfDue();
+
+  /**
+   * Copies phi_old to a staging buffer and starts writing it to the shared
+   * restart file `folder_name/file_base.r` with nonblocking collective I/O.
+   * The write completes while the solver continues. If the staging buffer
+   * would exceed `write_restart_memory_budget` on any process, or shared
+   * restart files are disabled, the data is written synchronously instead.
+   */
+  void WriteRestartDataAsync(const std::string& folder_name, const std::string& file_base);
+
+  /**
+   * Waits for an asynchronous restart write in flight, if any, to complete.
+   */
+  void FinishRestartWrites();
+
   /**
    * Writes a full angular flux vector to file.
    */
@@ -353,6 +471,8 @@ public:
 
   /**
    * Reads a full angular flux vector from a file into the specified vector.
+   * If `file_base.data` is a shared file written with `WriteAngularFluxesCollective`,
+   * it is read collectively instead of the per-process files.
    */
   void ReadAngularFluxes(const std::string& file_base,
                          std::vector<std::vector<double>>& dest) const;
@@ -383,11 +503,42 @@ public:
 
   /**
    * Reads a flux moments vector from a file into the specified vector.
+   * If `file_base.data` is a shared file written with `WriteFluxMomentsCollective`,
+   * it is read collectively instead of the per-process files.
    */
   void ReadFluxMoments(const std::string& file_base,
                        std::vector<double>& dest,
                        bool single_file = false) const;
 
+  /**
+   * Collectively writes a flux moments vector to a single file shared by all
+   * processes. Each cell's nodal positions and values are stored as one record
+   * keyed by the cell's global-id.
+   */
+  void WriteFluxMomentsCollective(const std::vector<double>& src,
+                                  const std::string& file_name) const;
+
+  /**
+   * Collectively reads a flux moments vector from a shared file. The file may
+   * have been written with a different number of processes and partitioning.
+   */
+  void ReadFluxMomentsCollective(const std::string& file_name, std::vector<double>& dest) const;
+
+  /**
+   * Collectively writes the angular fluxes of all groupsets to a single file
+   * shared by all processes.
+   */
+  void WriteAngularFluxesCollective(const std::vector<std::vector<double>>& src,
+                                    const std::string& file_name) const;
+
+  /**
+   * Collectively reads the angular fluxes of all groupsets from a shared file.
+   * The file may have been written with a different number of processes and
+   * partitioning.
+   */
+  void ReadAngularFluxesCollective(const std::string& file_name,
+                                   std::vector<std::vector<double>>& dest) const;
+
   /**
    * Copy relevant section of phi_old to the field functions.
    */
@@ -481,6 +632,33 @@ public:
                                                           Vec x,
                                                           PhiSTLOption which_phi);
 
+  /**
+   * Moves the solver to a repartitioned copy of its grid.
+   * `cell_partition_ids[i]` is the new partition of the local cell with
+   * local-id `i`. The flux moments, external source moments, angular fluxes,
+   * precursors and densities follow their cells and the solver, including its
+   * sweep data structures, is re-initialized on the new grid, which replaces
+   * the current mesh. Field functions keep their handles. Meant to be called
+   * between solves. A solver bound to an executor with `BindExecutor` cannot
+   * be repartitioned. Derived solvers that keep further state per cell must
+   * override this to migrate that state or to refuse. This is a collective
+   * call.
+   */
+  virtual void Repartition(const std::vector<int64_t>& cell_partition_ids);
+
+  /**
+   * Records that the named executor holds on to the iterative solvers of this
+   * solver or to state sized for its current grid. Meant to be called by such
+   * executors upon initialization. Bound solvers cannot be repartitioned.
+   */
+  void BindExecutor(const std::string& executor_name);
+
+  /**
+   * Returns the name of the last executor bound with `BindExecutor`, or an empty
+   * string if there is none.
+   */
+  const std::string& BoundExecutorName() const;
+
   /**
    * A method for post-processing an adjoint solution.
    *
@@ -499,6 +677,12 @@ protected:
    */
   void PrintSimHeader();
 
+  /**
+   * Releases the dense angular fluxes of a groupset that are also held in
+   * compressed form.
+   */
+  void ReleaseDenseAngularFluxes(int groupset_id) const;
+
   virtual void InitializeSpatialDiscretization();
   void ComputeUnitIntegrals();
 
@@ -521,13 +705,28 @@ protected:
 
   /**Initializes transport related boundaries. */
   void InitializeBoundaries();
+  /**Registers the data structures of this solver with the per-subsystem
+   * memory accounting. Sizes are evaluated when queried, so structures
+   * created after this call, e.g., sweep data, are included.*/
+  void RegisterMemoryConsumers();
   virtual void InitializeSolverSchemes();
   virtual void InitializeWGSSolvers(){};
   /**Initializes the Within-Group DSA solver. */
   void InitTGDSA(LBSGroupset& groupset);
 
+  /**Maps the nodes of a cell record read from file to the nodes of the local
+   * cell by position. Entry `i` is the local node of file node `i`.*/
+  std::vector<size_t> MapFileCellNodes(const Cell& cell,
+                                       const double* file_node_xyz,
+                                       size_t num_file_nodes) const;
+
+  /**Packs a flux moments vector into per-cell records holding the nodal
+   * positions followed by the values ordered by node, moment and group.*/
+  CellRecords MakeFluxMomentRecords(const std::vector<double>& src) const;
+
   size_t source_event_tag_ = 0;
   double last_restart_write_ = 0.0;
+  std::shared_ptr<AsyncCellRecordWriter> restart_writer_ = nullptr;
 
   lbs::Options options_;
   size_t num_moments_ = 0;
@@ -566,7 +765,9 @@ protected:
 
   std::vector<double> q_moments_local_, ext_src_moments_local_;
   std::vector<double> phi_new_local_, phi_old_local_;
-  std::vector<std::vector<double>> psi_new_local_;
+  /// Angular fluxes are decompressed during scoped access, also through const methods
+  mutable std::vector<std::vector<double>> psi_new_local_;
+  mutable std::vector<std::shared_ptr<CompressedVector>> psi_compressed_local_;
   std::vector<double> precursor_new_local_;
   std::vector<double> densities_local_;
 
@@ -581,6 +782,8 @@ protected:
 
   /**Time integration parameter meant to be set by an executor*/
   std::shared_ptr<const TimeIntegration> time_integration_ = nullptr;
+  /**Name of the last executor that cached state of this solver*/
+  std::string bound_executor_name_;
 
   /**Cleans up memory consuming items. */
   static void CleanUpWGDSA(LBSGroupset& groupset);
@@ -195,6 +195,14 @@ enum class PhiSTLOption
   PHI_NEW = 2
 };
 
+/**How saved angular fluxes are stored between groupset solves.*/
+enum class AngularFluxStorage
+{
+  DENSE = 0,      ///< Uncompressed in memory
+  COMPRESSED = 1, ///< Lossy, error-bounded compression in memory
+  DISK = 2        ///< Lossy, error-bounded compression spilled to disk
+};
+
 class LBSGroupset;
 typedef std::function<void(const LBSGroupset& groupset,
                            std::vector<double>& q,
@@ -223,17 +231,24 @@ struct Options
   std::string write_restart_folder_name = std::string("YRestart");
   std::string write_restart_file_base = std::string("restart");
   double write_restart_interval = 30.0;
+  bool shared_restart_file = true;
+  bool write_restart_async = false;
+  double write_restart_memory_budget = 1024.0;
 
   bool use_precursors = false;
   bool use_src_moments = false;
 
   bool save_angular_flux = false;
+  AngularFluxStorage angular_flux_storage = AngularFluxStorage::DENSE;
+  double angular_flux_compression_tolerance = 1.0e-6;
+  std::string angular_flux_spill_folder_name = ".";
 
   bool adjoint = false;
 
   bool verbose_inner_iterations = true;
   bool verbose_ags_iterations = false;
   bool verbose_outer_iterations = true;
+  bool log_memory_usage = false;
 
   bool power_field_function_on = false;
   double power_default_kappa = 3.20435e-11; // 200MeV to Joule
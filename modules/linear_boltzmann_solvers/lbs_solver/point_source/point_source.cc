@@ -58,26 +58,24 @@ PointSource::Initialize(const LBSSolver& lbs_solver)
   // Find local subscribers
   double total_volume = 0.0;
   std::vector<Subscriber> subscribers;
-  for (const auto& cell : grid.local_cells)
+  for (const uint64_t local_id : grid.FindLocalCellsContainingPoint(location_))
   {
-    if (grid.CheckPointInsideCell(cell, location_))
-    {
-      const auto& cell_mapping = discretization.GetCellMapping(cell);
-      const auto& fe_values = unit_cell_matrices[cell.local_id_];
-
-      // Map the point source to the finite element space
-      std::vector<double> shape_vals;
-      cell_mapping.ShapeValues(location_, shape_vals);
-      const auto M_inv = Inverse(fe_values.intV_shapeI_shapeJ);
-      const auto node_wgts = MatMul(M_inv, shape_vals);
-
-      // Increment the total volume
-      total_volume += cell_mapping.CellVolume();
-
-      // Add to subscribers
-      subscribers.push_back(
-        Subscriber{cell_mapping.CellVolume(), cell.local_id_, shape_vals, node_wgts});
-    }
+    const auto& cell = grid.local_cells[local_id];
+    const auto& cell_mapping = discretization.GetCellMapping(cell);
+    const auto& fe_values = unit_cell_matrices[cell.local_id_];
+
+    // Map the point source to the finite element space
+    std::vector<double> shape_vals;
+    cell_mapping.ShapeValues(location_, shape_vals);
+    const auto M_inv = Inverse(fe_values.intV_shapeI_shapeJ);
+    const auto node_wgts = MatMul(M_inv, shape_vals);
+
+    // Increment the total volume
+    total_volume += cell_mapping.CellVolume();
+
+    // Add to subscribers
+    subscribers.push_back(
+      Subscriber{cell_mapping.CellVolume(), cell.local_id_, shape_vals, node_wgts});
   }
 
   // If the point source lies on a partition boundary, ghost cells must be
@@ -1,5 +1,8 @@
 #include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/transient_source_function.h"
 
+#include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+
 namespace opensn
 {
 namespace lbs
@@ -7,8 +10,12 @@ namespace lbs
 
 TransientSourceFunction::TransientSourceFunction(const LBSSolver& lbs_solver,
                                                  double& ref_dt,
-                                                 SteppingMethod& method)
-  : SourceFunction(lbs_solver), dt_(ref_dt), method_(method)
+                                                 double& ref_theta,
+                                                 const std::vector<double>& ref_precursors_prev)
+  : SourceFunction(lbs_solver),
+    dt_(ref_dt),
+    theta_(ref_theta),
+    precursors_prev_(ref_precursors_prev)
 {
 }
 
@@ -18,18 +25,7 @@ TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                                            const std::vector<double>& nu_delayed_sigma_f,
                                            const double* phi) const
 {
-  const auto& BackwardEuler = SteppingMethod::IMPLICIT_EULER;
-  const auto& CrankNicolson = SteppingMethod::CRANK_NICOLSON;
-
-  double theta;
-  if (method_ == BackwardEuler)
-    theta = 1.0;
-  else if (method_ == CrankNicolson)
-    theta = 0.5;
-  else
-    theta = 0.7;
-
-  const double eff_dt = theta * dt_;
+  const double eff_dt = theta_ * dt_;
 
   double value = 0.0;
   if (apply_ags_fission_src_)
@@ -41,7 +37,7 @@ TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                                (1.0 + eff_dt * precursor.decay_constant);
 
           value += coeff * eff_dt * precursor.fractional_yield * rho * nu_delayed_sigma_f[gp] *
-                   phi[gp] / cell_volume_;
+                   phi[gp];
         }
 
   if (apply_wgs_fission_src_)
@@ -52,11 +48,59 @@ TransientSourceFunction::AddDelayedFission(const PrecursorList& precursors,
                              (1.0 + eff_dt * precursor.decay_constant);
 
         value += coeff * eff_dt * precursor.fractional_yield * rho * nu_delayed_sigma_f[gp] *
-                 phi[gp] / cell_volume_;
+                 phi[gp];
       }
 
   return value;
 }
 
+void
+TransientSourceFunction::AddAdditionalSources(const LBSGroupset& groupset,
+                                              std::vector<double>& q,
+                                              const std::vector<double>& phi,
+                                              const SourceFlags source_flags)
+{
+  SourceFunction::AddAdditionalSources(groupset, q, phi, source_flags);
+
+  if (apply_fixed_src_ and lbs_solver_.Options().use_precursors)
+    AddPreviousPrecursorSources(q);
+}
+
+void
+TransientSourceFunction::AddPreviousPrecursorSources(std::vector<double>& q) const
+{
+  const double eff_dt = theta_ * dt_;
+  const size_t J = lbs_solver_.MaxPrecursorsPerMaterial();
+  const auto& densities = lbs_solver_.DensitiesLocal();
+  const auto& cell_transport_views = lbs_solver_.GetCellTransportViews();
+
+  for (const auto& cell : lbs_solver_.Grid().local_cells)
+  {
+    const auto& transport_view = cell_transport_views[cell.local_id_];
+    const auto& xs = transport_view.XS();
+    if (not xs.IsFissionable())
+      continue;
+
+    const double rho = densities[cell.local_id_];
+    const auto& precursors = xs.Precursors();
+
+    // The precursor concentrations are cell-averaged, the source is isotropic
+    for (size_t g = gs_i_; g <= gs_f_; ++g)
+    {
+      double value = 0.0;
+      for (size_t j = 0; j < xs.NumPrecursors(); ++j)
+      {
+        const auto& precursor = precursors[j];
+        value += precursor.emission_spectrum[g] * precursor.decay_constant /
+                 (1.0 + eff_dt * precursor.decay_constant) * rho *
+                 precursors_prev_[cell.local_id_ * J + j];
+      }
+
+      for (int i = 0; i < transport_view.NumNodes(); ++i)
+        q[transport_view.MapDOF(i, 0, 0) + g] += value;
+    }
+  }
+}
+
 } // namespace lbs
 } // namespace opensn
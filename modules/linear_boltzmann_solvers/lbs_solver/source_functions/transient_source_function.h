@@ -2,31 +2,47 @@
 
 #include "modules/linear_boltzmann_solvers/lbs_solver/source_functions/source_function.h"
 
-#include "framework/math/math_time_stepping.h"
-
 namespace opensn
 {
 namespace lbs
 {
 
 /**A transient source function needs to adjust the AddDelayedFission
- * routine to properly fit with the current timestepping method and timestep.*/
+ * routine to properly fit with the current timestepping method and timestep.
+ * With a theta-scheme, the delayed neutron source at \f$ t^{n+\theta} \f$ is
+ * \f$ \chi_j \lambda_j (C_j^n + \theta \Delta t \beta_j \nu_d \sigma_f \phi)
+ * / (1 + \theta \Delta t \lambda_j) \f$. The part involving the previous
+ * precursor concentrations is a fixed source.*/
 class TransientSourceFunction : public SourceFunction
 {
 private:
   double& dt_;
-  SteppingMethod& method_;
+  double& theta_;
+  const std::vector<double>& precursors_prev_;
 
 public:
   /**Constructor for the transient source function. The only difference
    * as compared to a steady source function is the treatment of delayed
-   * fission.*/
-  TransientSourceFunction(const LBSSolver& lbs_solver, double& ref_dt, SteppingMethod& method);
+   * fission. The time step, theta and the cell-averaged precursor
+   * concentrations at the previous time are referenced, not copied.*/
+  TransientSourceFunction(const LBSSolver& lbs_solver,
+                          double& ref_dt,
+                          double& ref_theta,
+                          const std::vector<double>& ref_precursors_prev);
 
   double AddDelayedFission(const PrecursorList& precursors,
                            const double& rho,
                            const std::vector<double>& nu_delayed_sigma_f,
                            const double* phi) const override;
+
+  void AddAdditionalSources(const LBSGroupset& groupset,
+                            std::vector<double>& q,
+                            const std::vector<double>& phi,
+                            const SourceFlags source_flags) override;
+
+  /**Adds the decay of the precursors at the previous time to the
+   * isotropic moments of the destination vector.*/
+  void AddPreviousPrecursorSources(std::vector<double>& q) const;
 };
 
 } // namespace lbs
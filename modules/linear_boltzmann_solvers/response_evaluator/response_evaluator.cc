@@ -6,6 +6,9 @@
 #include "framework/object_factory.h"
 #include "mpicpp-lite/mpicpp-lite.h"
 
+#include <algorithm>
+#include <set>
+
 namespace mpi = mpicpp_lite;
 
 namespace opensn
@@ -13,6 +16,28 @@ namespace opensn
 namespace lbs
 {
 
+namespace
+{
+
+/**Adds the product of the m x k matrix `a` and the k x n matrix `b` to the
+ * m x n matrix `c`. All matrices are dense and row-major.*/
+void
+AccumulateProduct(
+  const size_t m, const size_t n, const size_t k, const double* a, const double* b, double* c)
+{
+  for (size_t i = 0; i < m; ++i)
+    for (size_t l = 0; l < k; ++l)
+    {
+      const double a_il = a[i * k + l];
+      if (a_il == 0.0)
+        continue;
+      for (size_t j = 0; j < n; ++j)
+        c[i * n + j] += a_il * b[l * n + j];
+    }
+}
+
+} // namespace
+
 OpenSnRegisterObjectInNamespace(lbs, ResponseEvaluator);
 
 InputParameters
@@ -85,12 +110,7 @@ ResponseEvaluator::SetOptions(const InputParameters& params)
 
   if (user_params.Has("clear_sources"))
     if (user_params.GetParamValue<bool>("clear_sources"))
-    {
-      material_sources_.clear();
-      point_sources_.clear();
-      distributed_sources_.clear();
-      boundary_sources_.clear();
-    }
+      ClearForwardSources();
 
   if (user_params.Has("sources"))
   {
@@ -139,7 +159,30 @@ ResponseEvaluator::SetBufferOptions(const InputParameters& params)
   if (prefixes.Has("angular_fluxes"))
     lbs_solver_.ReadAngularFluxes(prefixes.GetParamValue<std::string>("angular_fluxes"), psi);
 
-  adjoint_buffers_[name] = {phi, psi};
+  // Compress the angular fluxes per groupset with blocks holding all angles and
+  // groups of one node
+  CompressedAngularFluxBuffer psi_compressed;
+  const auto& options = lbs_solver_.Options();
+  if (options.angular_flux_storage != AngularFluxStorage::DENSE)
+  {
+    for (size_t gs = 0; gs < psi.size(); ++gs)
+    {
+      std::string spill_file_name;
+      if (options.angular_flux_storage == AngularFluxStorage::DISK)
+        spill_file_name = options.angular_flux_spill_folder_name + "/response_" + name + "_psi_gs" +
+                          std::to_string(gs) + "_" + std::to_string(mpi_comm.rank()) + ".bin";
+      const auto& groupset = lbs_solver_.Groupsets()[gs];
+      psi_compressed.push_back(std::make_shared<CompressedVector>(
+        psi[gs],
+        groupset.quadrature_->omegas_.size() * groupset.groups_.size(),
+        options.angular_flux_compression_tolerance,
+        spill_file_name));
+      psi[gs] = std::vector<double>();
+    }
+    psi.clear();
+  }
+
+  adjoint_buffers_[name] = {std::move(phi), std::move(psi), std::move(psi_compressed)};
   log.Log0Verbose1() << "Adjoint buffer " << name << " added to the stack.";
 }
 
@@ -173,6 +216,20 @@ ResponseEvaluator::SourceOptionsBlock()
 
 void
 ResponseEvaluator::SetSourceOptions(const InputParameters& params)
+{
+  AddSources(params, sources_);
+}
+
+ResponseEvaluator::SourceSet
+ResponseEvaluator::MakeSourceSet(const InputParameters& params) const
+{
+  SourceSet sources;
+  AddSources(params, sources);
+  return sources;
+}
+
+void
+ResponseEvaluator::AddSources(const InputParameters& params, SourceSet& sources) const
 {
   params.RequireBlockTypeIs(ParameterBlockType::BLOCK);
 
@@ -184,7 +241,7 @@ ResponseEvaluator::SetSourceOptions(const InputParameters& params)
     {
       auto msrc_params = MaterialSourceOptionsBlock();
       msrc_params.AssignParameters(user_msrc_params.GetParam(p));
-      SetMaterialSourceOptions(msrc_params);
+      AddMaterialSource(msrc_params, sources);
     }
   }
 
@@ -194,9 +251,9 @@ ResponseEvaluator::SetSourceOptions(const InputParameters& params)
     const auto& user_psrc_params = params.GetParam("point");
     for (int p = 0; p < user_psrc_params.NumParameters(); ++p)
     {
-      point_sources_.push_back(GetStackItem<PointSource>(
+      sources.point.push_back(GetStackItem<PointSource>(
         object_stack, user_psrc_params.GetParam(p).GetValue<size_t>(), __FUNCTION__));
-      point_sources_.back().Initialize(lbs_solver_);
+      sources.point.back().Initialize(lbs_solver_);
     }
   }
 
@@ -206,9 +263,9 @@ ResponseEvaluator::SetSourceOptions(const InputParameters& params)
     const auto& user_dsrc_params = params.GetParam("distributed");
     for (int p = 0; p < user_dsrc_params.NumParameters(); ++p)
     {
-      distributed_sources_.push_back(GetStackItem<DistributedSource>(
+      sources.distributed.push_back(GetStackItem<DistributedSource>(
         object_stack, user_dsrc_params.GetParam(p).GetValue<size_t>(), __FUNCTION__));
-      distributed_sources_.back().Initialize(lbs_solver_);
+      sources.distributed.back().Initialize(lbs_solver_);
     }
   }
 
@@ -220,7 +277,7 @@ ResponseEvaluator::SetSourceOptions(const InputParameters& params)
     {
       auto bsrc_params = LBSSolver::BoundaryOptionsBlock();
       bsrc_params.AssignParameters(user_bsrc_params.GetParam(p));
-      SetBoundarySourceOptions(bsrc_params);
+      AddBoundarySource(bsrc_params, sources);
     }
   }
 }
@@ -245,9 +302,15 @@ ResponseEvaluator::MaterialSourceOptionsBlock()
 
 void
 ResponseEvaluator::SetMaterialSourceOptions(const InputParameters& params)
+{
+  AddMaterialSource(params, sources_);
+}
+
+void
+ResponseEvaluator::AddMaterialSource(const InputParameters& params, SourceSet& sources) const
 {
   const auto matid = params.GetParamValue<int>("material_id");
-  OpenSnInvalidArgumentIf(material_sources_.count(matid) > 0,
+  OpenSnInvalidArgumentIf(sources.material.count(matid) > 0,
                           "A material source for material id " + std::to_string(matid) +
                             " already exists.");
 
@@ -259,12 +322,18 @@ ResponseEvaluator::SetMaterialSourceOptions(const InputParameters& params)
                             std::to_string(lbs_solver_.NumGroups()) + " but got " +
                             std::to_string(values.size()) + ".");
 
-  material_sources_[matid] = values;
+  sources.material[matid] = values;
   log.Log0Verbose1() << "Material source for material id " << matid << " added to the stack.";
 }
 
 void
 ResponseEvaluator::SetBoundarySourceOptions(const InputParameters& params)
+{
+  AddBoundarySource(params, sources_);
+}
+
+void
+ResponseEvaluator::AddBoundarySource(const InputParameters& params, SourceSet& sources) const
 {
   const auto bndry_name = params.GetParamValue<std::string>("name");
   const auto bndry_type = params.GetParamValue<std::string>("type");
@@ -275,10 +344,17 @@ ResponseEvaluator::SetBoundarySourceOptions(const InputParameters& params)
     OpenSnInvalidArgumentIf(not params.Has("group_strength"),
                             "Parameter \"group_strength\" is required for "
                             "boundaries of type \"isotropic\".");
-    params.RequireParameterBlockTypeIs("values", ParameterBlockType::ARRAY);
+    params.RequireParameterBlockTypeIs("group_strength", ParameterBlockType::ARRAY);
 
-    boundary_sources_[bid] = {BoundaryType::ISOTROPIC,
-                              params.GetParamVectorValue<double>("group_strength")};
+    const auto values = params.GetParamVectorValue<double>("group_strength");
+    OpenSnInvalidArgumentIf(values.size() != lbs_solver_.NumGroups(),
+                            "The number of boundary source values and groups "
+                            "in the underlying solver do not match. "
+                            "Expected " +
+                              std::to_string(lbs_solver_.NumGroups()) + " but got " +
+                              std::to_string(values.size()) + ".");
+
+    sources.boundary[bid] = {BoundaryType::ISOTROPIC, values};
   }
   else
     log.Log0Warning() << "Unsupported boundary type. Skipping the entry.";
@@ -287,31 +363,78 @@ ResponseEvaluator::SetBoundarySourceOptions(const InputParameters& params)
 void
 ResponseEvaluator::ClearForwardSources()
 {
-  material_sources_.clear();
-  point_sources_.clear();
-  distributed_sources_.clear();
-  boundary_sources_.clear();
+  sources_ = SourceSet();
 }
 
 double
-ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
+ResponseEvaluator::EvaluateResponse(const std::string& buffer_name) const
+{
+  return FoldSources({&adjoint_buffers_.at(buffer_name)}, {&sources_}).front();
+}
+
+std::vector<std::vector<double>>
+ResponseEvaluator::EvaluateResponses(const std::vector<std::string>& buffer_names,
+                                     const std::vector<SourceSet>& source_sets) const
+{
+  std::vector<const AdjointBuffer*> buffers;
+  for (const auto& buffer_name : buffer_names)
+  {
+    OpenSnInvalidArgumentIf(adjoint_buffers_.count(buffer_name) == 0,
+                            "An adjoint buffer with name " + buffer_name + " does not exist.");
+    buffers.push_back(&adjoint_buffers_.at(buffer_name));
+  }
+
+  std::vector<const SourceSet*> sets;
+  for (const auto& source_set : source_sets)
+    sets.push_back(&source_set);
+
+  const auto responses = FoldSources(buffers, sets);
+
+  const auto num_buffers = buffers.size();
+  std::vector<std::vector<double>> set_responses(sets.size());
+  for (size_t s = 0; s < sets.size(); ++s)
+    set_responses[s].assign(responses.begin() + s * num_buffers,
+                            responses.begin() + (s + 1) * num_buffers);
+  return set_responses;
+}
+
+std::vector<double>
+ResponseEvaluator::FoldSources(const std::vector<const AdjointBuffer*>& buffers,
+                               const std::vector<const SourceSet*>& source_sets) const
 {
-  const auto& buffer_data = adjoint_buffers_.at(buffer);
-  const auto& phi_dagger = buffer_data.first;
-  const auto& psi_dagger = buffer_data.second;
-
-  OpenSnLogicalErrorIf(not material_sources_.empty() and phi_dagger.empty(),
-                       "If material sources are present, adjoint flux moments "
-                       "must be available for response evaluation.");
-  OpenSnLogicalErrorIf(not point_sources_.empty() and phi_dagger.empty(),
-                       "If point sources are set, adjoint flux moments "
-                       "must be available for response evaluation.");
-  OpenSnLogicalErrorIf(not distributed_sources_.empty() and phi_dagger.empty(),
-                       "if distributed sources are set, adjoint flux moments "
-                       "must be available for response evaluation.");
-  OpenSnLogicalErrorIf(not boundary_sources_.empty() and psi_dagger.empty(),
-                       "If boundary sources are set, adjoint angular fluxes "
-                       "must be available for response evaluation.");
+  const auto num_buffers = buffers.size();
+  const auto num_sets = source_sets.size();
+
+  // The materials and boundaries with a source in any source set
+  std::set<int> source_materials;
+  std::set<uint64_t> source_boundaries;
+  bool has_point_sources = false;
+  bool has_distributed_sources = false;
+  for (const auto* sources : source_sets)
+  {
+    for (const auto& [matid, strength] : sources->material)
+      source_materials.insert(matid);
+    for (const auto& [bid, preference] : sources->boundary)
+      source_boundaries.insert(bid);
+    has_point_sources = has_point_sources or not sources->point.empty();
+    has_distributed_sources = has_distributed_sources or not sources->distributed.empty();
+  }
+
+  for (const auto* buffer : buffers)
+  {
+    OpenSnLogicalErrorIf(not source_materials.empty() and buffer->phi.empty(),
+                         "If material sources are present, adjoint flux moments "
+                         "must be available for response evaluation.");
+    OpenSnLogicalErrorIf(has_point_sources and buffer->phi.empty(),
+                         "If point sources are set, adjoint flux moments "
+                         "must be available for response evaluation.");
+    OpenSnLogicalErrorIf(has_distributed_sources and buffer->phi.empty(),
+                         "if distributed sources are set, adjoint flux moments "
+                         "must be available for response evaluation.");
+    OpenSnLogicalErrorIf(not source_boundaries.empty() and not buffer->HasAngularFluxes(),
+                         "If boundary sources are set, adjoint angular fluxes "
+                         "must be available for response evaluation.");
+  }
 
   const auto& grid = lbs_solver_.Grid();
   const auto& discretization = lbs_solver_.SpatialDiscretization();
@@ -319,42 +442,83 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
   const auto& unit_cell_matrices = lbs_solver_.GetUnitCellMatrices();
   const auto num_groups = lbs_solver_.NumGroups();
 
-  double local_response = 0.0;
+  std::vector<double> local_responses(num_sets * num_buffers, 0.0);
+
+  // Source strength matrix with a row per source set and a column per group
+  std::vector<double> strengths(num_sets * num_groups);
+
+  // Response function matrix with a row per group and a column per buffer
+  std::vector<double> response_function(num_groups * num_buffers);
 
   // Material sources
-  if (not material_sources_.empty())
+  if (not source_materials.empty())
   {
+    // Volume-integrated adjoint flux of each source material
+    std::map<int, std::vector<double>> material_response_functions;
+    for (const auto matid : source_materials)
+      material_response_functions[matid].assign(num_groups * num_buffers, 0.0);
+
     for (const auto& cell : grid.local_cells)
     {
-      const auto& cell_mapping = discretization.GetCellMapping(cell);
+      const auto it = material_response_functions.find(cell.material_id_);
+      if (it == material_response_functions.end())
+        continue;
+
+      auto& material_response_function = it->second;
       const auto& transport_view = transport_views[cell.local_id_];
       const auto& fe_values = unit_cell_matrices[cell.local_id_];
-      const auto num_cell_nodes = cell_mapping.NumNodes();
-
-      if (material_sources_.count(cell.material_id_) > 0)
+      const auto num_cell_nodes = transport_view.NumNodes();
+      for (size_t i = 0; i < num_cell_nodes; ++i)
       {
-        const auto& src = material_sources_.at(cell.material_id_);
-        for (size_t i = 0; i < num_cell_nodes; ++i)
+        const auto dof_map = transport_view.MapDOF(i, 0, 0);
+        const auto& V_i = fe_values.intV_shapeI[i];
+        for (size_t b = 0; b < num_buffers; ++b)
         {
-          const auto dof_map = transport_view.MapDOF(i, 0, 0);
-          const auto& V_i = fe_values.intV_shapeI[i];
+          const auto& phi_dagger = buffers[b]->phi;
           for (size_t g = 0; g < num_groups; ++g)
-            local_response += src[g] * phi_dagger[dof_map + g] * V_i;
+            material_response_function[g * num_buffers + b] += V_i * phi_dagger[dof_map + g];
         }
+      } // for node i
+    }   // for cell
+
+    for (const auto& [matid, material_response_function] : material_response_functions)
+    {
+      strengths.assign(num_sets * num_groups, 0.0);
+      for (size_t s = 0; s < num_sets; ++s)
+      {
+        const auto& material_sources = source_sets[s]->material;
+        const auto it = material_sources.find(matid);
+        if (it != material_sources.end())
+          std::copy(it->second.begin(), it->second.end(), &strengths[s * num_groups]);
       }
-    } // for cell
-  }   // if material sources
+      AccumulateProduct(num_sets,
+                        num_buffers,
+                        num_groups,
+                        strengths.data(),
+                        material_response_function.data(),
+                        local_responses.data());
+    }
+  } // if material sources
 
   // Boundary sources
-  if (not boundary_sources_.empty())
+  if (not source_boundaries.empty())
   {
-    size_t gs = 0;
-    for (const auto& groupset : lbs_solver_.Groupsets())
+    // Incoming adjoint partial current on each source boundary. Isotropic boundary
+    // sources are independent of the node and direction and are applied afterwards.
+    std::map<uint64_t, std::vector<double>> boundary_response_functions;
+    for (const auto bid : source_boundaries)
+      boundary_response_functions[bid].assign(num_groups * num_buffers, 0.0);
+
+    // Accumulates the incoming partial currents of a groupset for buffer `b`, whose
+    // adjoint angular fluxes are accessed through `psi_dagger[dof]`
+    auto AccumulateBoundaryResponse =
+      [&](const LBSGroupset& groupset, auto&& psi_dagger, const size_t b)
     {
       const auto& uk_man = groupset.psi_uk_man_;
       const auto& quadrature = groupset.quadrature_;
       const auto& num_gs_angles = quadrature->omegas_.size();
       const auto& num_gs_groups = groupset.groups_.size();
+      const auto first_group = groupset.groups_.front().id_;
 
       for (const auto& cell : grid.local_cells)
       {
@@ -364,18 +528,15 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
         size_t f = 0;
         for (const auto& face : cell.faces_)
         {
-          if (not face.has_neighbor_ and boundary_sources_.count(face.neighbor_id_) > 0)
+          if (not face.has_neighbor_ and boundary_response_functions.count(face.neighbor_id_) > 0)
           {
-            const auto bndry_id = face.neighbor_id_;
+            auto& boundary_response_function = boundary_response_functions[face.neighbor_id_];
             const auto num_face_nodes = cell_mapping.NumFaceNodes(f);
             for (size_t fi = 0; fi < num_face_nodes; ++fi)
             {
               const auto i = cell_mapping.MapFaceNode(f, fi);
-              const auto& node = grid.vertices[cell.vertex_ids_[i]];
               const auto& intF_shapeI = fe_values.intS_shapeI[f][i];
 
-              const auto psi_bndry = EvaluateBoundaryCondition(bndry_id, node, groupset);
-
               for (size_t n = 0; n < num_gs_angles; ++n)
               {
                 const auto& omega = quadrature->omegas_[n];
@@ -387,8 +548,8 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
                   const auto dof_map = discretization.MapDOFLocal(cell, i, uk_man, n, 0);
 
                   for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
-                    local_response +=
-                      weight * psi_dagger[gs][dof_map + gsg] * psi_bndry[num_gs_groups * n + gsg];
+                    boundary_response_function[(first_group + gsg) * num_buffers + b] +=
+                      weight * psi_dagger[dof_map + gsg];
                 } // if outgoing
               }
             } // for face node fi
@@ -396,75 +557,114 @@ ResponseEvaluator::EvaluateResponse(const std::string& buffer) const
           ++f;
         } // for face
       }   // for cell
-      ++gs;
-    } // for groupset
-  }   // if boundary sources
-
-  // Point sources
-  for (const auto& point_source : point_sources_)
-    for (const auto& subscriber : point_source.Subscribers())
-    {
-      const auto& cell = grid.local_cells[subscriber.cell_local_id];
-      const auto& transport_view = transport_views[cell.local_id_];
+    };
 
-      const auto& src = point_source.Strength();
-      const auto& vol_wt = subscriber.volume_weight;
-
-      const auto num_cell_nodes = transport_view.NumNodes();
-      for (size_t i = 0; i < num_cell_nodes; ++i)
+    const auto& groupsets = lbs_solver_.Groupsets();
+    for (size_t b = 0; b < num_buffers; ++b)
+      for (size_t gs = 0; gs < groupsets.size(); ++gs)
       {
-        const auto dof_map = transport_view.MapDOF(i, 0, 0);
-        const auto& shape_val = subscriber.shape_values[i];
-        for (size_t g = 0; g < num_groups; ++g)
-          local_response += vol_wt * shape_val * src[g] * phi_dagger[dof_map + g];
-      } // for node i
-    }   // for subscriber
+        if (buffers[b]->psi_compressed.empty())
+          AccumulateBoundaryResponse(groupsets[gs], buffers[b]->psi[gs], b);
+        else
+        {
+          CompressedVector::Reader psi_dagger(*buffers[b]->psi_compressed[gs]);
+          AccumulateBoundaryResponse(groupsets[gs], psi_dagger, b);
+        }
+      } // for groupset
 
-  // Distributed sources
-  for (const auto& distributed_source : distributed_sources_)
-    for (const uint64_t local_id : distributed_source.Subscribers())
+    for (const auto& [bid, boundary_response_function] : boundary_response_functions)
     {
-      const auto& cell = grid.local_cells[local_id];
-      const auto& transport_view = transport_views[cell.local_id_];
-      const auto& fe_values = unit_cell_matrices[cell.local_id_];
-      const auto& nodes = discretization.GetCellNodeLocations(cell);
-
-      const auto num_cell_nodes = transport_view.NumNodes();
-      for (size_t i = 0; i < num_cell_nodes; ++i)
+      strengths.assign(num_sets * num_groups, 0.0);
+      for (size_t s = 0; s < num_sets; ++s)
       {
-        const auto& V_i = fe_values.intV_shapeI[i];
-        const auto dof_map = transport_view.MapDOF(i, 0, 0);
-        const auto& vals = distributed_source(cell, nodes[i], num_groups);
-        for (size_t g = 0; g < num_groups; ++g)
-          local_response += vals[g] * phi_dagger[dof_map + g] * V_i;
+        const auto& boundary_sources = source_sets[s]->boundary;
+        const auto it = boundary_sources.find(bid);
+        if (it == boundary_sources.end())
+          continue;
+
+        const auto& bc = it->second;
+        OpenSnLogicalErrorIf(bc.type != BoundaryType::ISOTROPIC,
+                             "Unexpected behavior. Unsupported boundary condition encountered.");
+        std::copy(bc.isotropic_mg_source.begin(),
+                  bc.isotropic_mg_source.end(),
+                  &strengths[s * num_groups]);
       }
+      AccumulateProduct(num_sets,
+                        num_buffers,
+                        num_groups,
+                        strengths.data(),
+                        boundary_response_function.data(),
+                        local_responses.data());
     }
+  } // if boundary sources
 
-  double global_response = 0.0;
-  mpi_comm.all_reduce(local_response, global_response, mpi::op::sum<double>());
-  return global_response;
-}
+  // Point sources
+  for (size_t s = 0; s < num_sets; ++s)
+    for (const auto& point_source : source_sets[s]->point)
+    {
+      response_function.assign(num_groups * num_buffers, 0.0);
+      for (const auto& subscriber : point_source.Subscribers())
+      {
+        const auto& cell = grid.local_cells[subscriber.cell_local_id];
+        const auto& transport_view = transport_views[cell.local_id_];
+        const auto& vol_wt = subscriber.volume_weight;
 
-std::vector<double>
-ResponseEvaluator::EvaluateBoundaryCondition(const uint64_t boundary_id,
-                                             const Vector3& node,
-                                             const LBSGroupset& groupset,
-                                             const double) const
-{
-  const auto num_gs_angles = groupset.quadrature_->omegas_.size();
-  const auto num_gs_groups = groupset.groups_.size();
-  const auto first_group = groupset.groups_.front().id_;
+        const auto num_cell_nodes = transport_view.NumNodes();
+        for (size_t i = 0; i < num_cell_nodes; ++i)
+        {
+          const auto dof_map = transport_view.MapDOF(i, 0, 0);
+          const auto& shape_val = subscriber.shape_values[i];
+          for (size_t b = 0; b < num_buffers; ++b)
+          {
+            const auto& phi_dagger = buffers[b]->phi;
+            for (size_t g = 0; g < num_groups; ++g)
+              response_function[g * num_buffers + b] +=
+                vol_wt * shape_val * phi_dagger[dof_map + g];
+          }
+        } // for node i
+      }   // for subscriber
 
-  std::vector<double> psi;
-  const auto& bc = boundary_sources_.at(boundary_id);
-  if (bc.type == BoundaryType::ISOTROPIC)
-  {
-    for (size_t n = 0; n < num_gs_angles; ++n)
-      for (size_t gsg = 0; gsg < num_gs_groups; ++gsg)
-        psi.emplace_back(bc.isotropic_mg_source[first_group + gsg]);
-    return psi;
-  }
-  OpenSnLogicalError("Unexpected behavior. Unsupported boundary condition encountered.");
+      AccumulateProduct(1,
+                        num_buffers,
+                        num_groups,
+                        point_source.Strength().data(),
+                        response_function.data(),
+                        &local_responses[s * num_buffers]);
+    } // for point source
+
+  // Distributed sources
+  for (size_t s = 0; s < num_sets; ++s)
+    for (const auto& distributed_source : source_sets[s]->distributed)
+      for (const uint64_t local_id : distributed_source.Subscribers())
+      {
+        const auto& cell = grid.local_cells[local_id];
+        const auto& transport_view = transport_views[cell.local_id_];
+        const auto& fe_values = unit_cell_matrices[cell.local_id_];
+        const auto& nodes = discretization.GetCellNodeLocations(cell);
+
+        const auto num_cell_nodes = transport_view.NumNodes();
+        for (size_t i = 0; i < num_cell_nodes; ++i)
+        {
+          const auto& V_i = fe_values.intV_shapeI[i];
+          const auto dof_map = transport_view.MapDOF(i, 0, 0);
+          const auto& vals = distributed_source(cell, nodes[i], num_groups);
+          for (size_t b = 0; b < num_buffers; ++b)
+          {
+            const auto& phi_dagger = buffers[b]->phi;
+            double response = 0.0;
+            for (size_t g = 0; g < num_groups; ++g)
+              response += vals[g] * phi_dagger[dof_map + g];
+            local_responses[s * num_buffers + b] += response * V_i;
+          }
+        } // for node i
+      }   // for subscriber
+
+  std::vector<double> global_responses(local_responses.size(), 0.0);
+  mpi_comm.all_reduce(local_responses.data(),
+                      local_responses.size(),
+                      global_responses.data(),
+                      mpi::op::sum<double>());
+  return global_responses;
 }
 
 } // namespace lbs
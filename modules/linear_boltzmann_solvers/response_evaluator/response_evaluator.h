@@ -2,6 +2,7 @@
 
 #include "framework/object.h"
 #include "modules/linear_boltzmann_solvers/lbs_solver/lbs_solver.h"
+#include "framework/data_types/compressed_vector.h"
 
 namespace opensn
 {
@@ -51,13 +52,34 @@ namespace lbs
         end
     end
  \endcode
+ * When many source configurations are of interest, they can instead be evaluated
+ * against several buffers at once with a single pass over the mesh and a single
+ * reduction,
+ \code
+    responses = lbs.EvaluateResponses(evaluator, buffer_names, sources)
+ \endcode
+ * where `responses[i][buffer_names[j]]` is the response of source `i` with buffer `j`.
  */
 class ResponseEvaluator : public Object
 {
 private:
   using FluxMomentBuffer = std::vector<double>;
   using AngularFluxBuffer = std::vector<std::vector<double>>;
-  using AdjointBuffer = std::pair<FluxMomentBuffer, AngularFluxBuffer>;
+  using CompressedAngularFluxBuffer = std::vector<std::shared_ptr<CompressedVector>>;
+
+  /**
+   * The adjoint solution of a buffer. Angular fluxes are stored per groupset,
+   * either dense or compressed as specified by the `angular_flux_storage` option
+   * of the solver.
+   */
+  struct AdjointBuffer
+  {
+    FluxMomentBuffer phi;
+    AngularFluxBuffer psi;
+    CompressedAngularFluxBuffer psi_compressed;
+
+    bool HasAngularFluxes() const { return not psi.empty() or not psi_compressed.empty(); }
+  };
 
   using MaterialSources = std::map<int, std::vector<double>>;
   using PointSources = std::vector<PointSource>;
@@ -65,6 +87,15 @@ private:
   using BoundarySources = std::map<uint64_t, BoundaryPreference>;
 
 public:
+  /**A forward source configuration.*/
+  struct SourceSet
+  {
+    MaterialSources material;
+    PointSources point;
+    DistributedSources distributed;
+    BoundarySources boundary;
+  };
+
   explicit ResponseEvaluator(const InputParameters& params);
 
   static InputParameters OptionsBlock();
@@ -81,6 +112,12 @@ public:
 
   void SetBoundarySourceOptions(const InputParameters& params);
 
+  /**
+   * Creates a source set from a block with the syntax of `SourceOptionsBlock`
+   * without modifying the sources of the response evaluator.
+   */
+  SourceSet MakeSourceSet(const InputParameters& params) const;
+
   /**
    * Clear the existing forward sources from the response evaluator.
    */
@@ -92,29 +129,40 @@ public:
    */
   double EvaluateResponse(const std::string& buffer_name) const;
 
+  /**
+   * Evaluate the responses of each source set with each of the specified adjoint
+   * buffers. The result is indexed by source set and then by buffer. All responses
+   * are computed with one pass over the mesh and one reduction.
+   */
+  std::vector<std::vector<double>>
+  EvaluateResponses(const std::vector<std::string>& buffer_names,
+                    const std::vector<SourceSet>& source_sets) const;
+
 private:
+  void AddSources(const InputParameters& params, SourceSet& sources) const;
+  void AddMaterialSource(const InputParameters& params, SourceSet& sources) const;
+  void AddBoundarySource(const InputParameters& params, SourceSet& sources) const;
+
   /**
-   * Evaluates a boundary source and returns the angular flux on the boundary.
+   * Folds the source sets against the adjoint buffers and returns the responses
+   * as a row-major matrix with a row per source set and a column per buffer.
    *
-   * This returns the full angular flux at a particular spatial location, for a particular
-   * groupset, at a particular time, for a particular boundary. No boundary normal information
-   * is included in the evaluation. The incident fluxes are obtained within the EvaluateResponse
-   * routine.
+   * The adjoint solutions are first reduced to group-wise response functions,
+   * i.e., the volume-integrated adjoint flux of each material and the incoming
+   * adjoint partial current on each boundary. The material and boundary responses
+   * are then products of source strength matrices, with a row per source set and a
+   * column per group, and response function matrices, with a row per group and a
+   * column per buffer. Point and distributed sources are folded directly.
    */
-  std::vector<double> EvaluateBoundaryCondition(const uint64_t boundary_id,
-                                                const Vector3& node,
-                                                const LBSGroupset& groupset,
-                                                const double time = 0.0) const;
+  std::vector<double> FoldSources(const std::vector<const AdjointBuffer*>& buffers,
+                                  const std::vector<const SourceSet*>& source_sets) const;
 
 private:
   LBSSolver& lbs_solver_;
 
   std::map<std::string, AdjointBuffer> adjoint_buffers_;
 
-  MaterialSources material_sources_;
-  PointSources point_sources_;
-  DistributedSources distributed_sources_;
-  BoundarySources boundary_sources_;
+  SourceSet sources_;
 
 public:
   /// Returns the input parameters for this object.
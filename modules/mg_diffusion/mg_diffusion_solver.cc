@@ -12,6 +12,7 @@
 #include "framework/math/spatial_discretization/finite_element/finite_element_data.h"
 #include "modules/mg_diffusion/mg_diffusion_bndry.h"
 #include "modules/mg_diffusion/tools.h"
+#include "framework/math/petsc_utils/petsc_matrix_assembler.h"
 #include <iomanip>
 
 namespace opensn
@@ -26,7 +27,8 @@ Solver::Solver(const std::string& name)
                     {"verbose_level", int64_t(0)},
                     {"thermal_flux_tolerance", 1.0e-2},
                     {"max_thermal_iters", int64_t(500)},
-                    {"do_two_grid", false}})
+                    {"do_two_grid", false},
+                    {"do_thermal_block_solve", false}})
 {
 }
 
@@ -40,6 +42,18 @@ Solver::~Solver()
   }
   VecDestroy(&b_);
 
+  for (auto& petsc_solver : petsc_solvers_)
+    KSPDestroy(&petsc_solver.ksp);
+
+  if (do_thermal_block_solve_)
+  {
+    if (not petsc_solvers_.empty())
+      KSPDestroy(&thermal_solver_.ksp);
+    VecDestroy(&x_thermal_);
+    VecDestroy(&b_thermal_);
+    MatDestroy(&A_thermal_);
+  }
+
   if (last_fast_group_ < num_groups_)
   {
     VecDestroy(&thermal_dphi_);
@@ -138,8 +152,10 @@ Solver::Initialize()
     A_[g] = CreateSquareMatrix(n, N);
     InitMatrixSparsity(A_[g], nodal_nnz_in_diag, nodal_nnz_off_diag);
   }
-  // initialize b
-  VecDuplicate(bext_.front(), &b_);
+  // initialize b, ghosted so that in-scattering can be accumulated locally
+  b_ = CreateVectorWithGhosts(
+    n, N, static_cast<int64_t>(ghost_dof_indices.size()), ghost_dof_indices);
+  VecSet(b_, 0.0);
   // initialize old flux for thermal groups
   if (last_fast_group_ < num_groups_)
   {
@@ -162,6 +178,9 @@ Solver::Initialize()
     //                                                        ghost_dof_indices);
   }
 
+  if (do_thermal_block_solve_)
+    mg_diffusion::Solver::InitializeThermalBlockSystem(nodal_nnz_in_diag, nodal_nnz_off_diag);
+
   if (do_two_grid_)
     mg_diffusion::Solver::Compute_TwoGrid_VolumeFractions();
 
@@ -321,8 +340,22 @@ Solver::Initialize_Materials(std::set<int>& material_ids)
 
   last_fast_group_ = lfg;
 
+  //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Thermal block solve
+  do_thermal_block_solve_ = basic_options_("do_thermal_block_solve").BoolValue();
+  if ((lfg == num_groups_) and do_thermal_block_solve_)
+  {
+    log.Log0Warning() << "Thermal block solve is not needed without upscattering. "
+                         "Groups will be solved one at a time.";
+    do_thermal_block_solve_ = false;
+  }
+
   //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%% Compute two-grid params
   do_two_grid_ = basic_options_("do_two_grid").BoolValue();
+  if (do_two_grid_ and do_thermal_block_solve_)
+  {
+    log.Log0Warning() << "Two-grid acceleration is not used with the thermal block solve.";
+    do_two_grid_ = false;
+  }
   if ((lfg == num_groups_) and do_two_grid_)
   {
     log.Log0Error() << "Two-grid is not possible with no upscattering.";
@@ -525,6 +558,21 @@ Solver::Assemble_A_bext()
   // Assemble the system
   unsigned int i_two_grid = do_two_grid_ ? 1 : 0;
 
+  // Cell dof maps and mass matrices are kept for the in-scattering sources
+  cell_local_dofs_.clear();
+  cell_node_offsets_.assign(1, 0);
+  cell_mass_matrices_.clear();
+  cell_mass_matrix_offsets_.assign(1, 0);
+
+  std::vector<MatrixAssembler> assemblers;
+  for (auto& A : A_)
+    assemblers.emplace_back(A);
+  MatrixAssembler thermal_assembler(A_thermal_);
+  for (auto& assembler : assemblers)
+    assembler.Begin();
+  if (do_thermal_block_solve_)
+    thermal_assembler.Begin();
+
   for (const auto& cell : grid.local_cells)
   {
     const auto& cell_mapping = sdm.GetCellMapping(cell);
@@ -568,6 +616,7 @@ Solver::Assemble_A_bext()
           entry_kij +=
             fe_vol_data.ShapeGrad(i, qp).Dot(fe_vol_data.ShapeGrad(j, qp)) * fe_vol_data.JxW(qp);
         } // for qp
+        cell_mass_matrices_.push_back(entry_mij);
         for (uint g = 0; g < num_groups_; ++g)
           Acell[g][i][j] = entry_mij * sigma_r[g] + entry_kij * D[g];
 
@@ -580,6 +629,11 @@ Solver::Assemble_A_bext()
       for (uint g = 0; g < num_groups_; ++g)
         rhs_cell[g][i] = entry_rhsi * (qext->source_value_g_[g]);
     } // for i
+    cell_mass_matrix_offsets_.push_back(cell_mass_matrices_.size());
+
+    for (size_t i = 0; i < num_nodes; ++i)
+      cell_local_dofs_.push_back(sdm.MapDOFLocal(cell, i));
+    cell_node_offsets_.push_back(cell_local_dofs_.size());
 
     // Deal with BC (all based on variations of Robin)
     const size_t num_faces = cell.faces_.size();
@@ -659,10 +713,44 @@ Solver::Assemble_A_bext()
         VecSetValue(bext_[g], imap[i], rhs_cell[g][i], ADD_VALUES);
 
     for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
+      assemblers[g].AddElementMatrix(imap, imap, Acell[g]);
+
+    // Coupled thermal-group matrix: the within-group operators on the block
+    // diagonals and the thermal transfers off the block diagonals
+    if (do_thermal_block_solve_)
+    {
+      const size_t num_thermal = num_groups_ - last_fast_group_;
+      const size_t block_dim = num_nodes * num_thermal;
+      const double* M = &cell_mass_matrices_[cell_mass_matrix_offsets_[cell.local_id_]];
+      const auto& S = xs->TransferMatrix(0);
+
+      std::vector<int64_t> block_map(block_dim);
       for (size_t i = 0; i < num_nodes; ++i)
-        for (size_t j = 0; j < num_nodes; ++j)
-          MatSetValue(A_[g], imap[i], imap[j], Acell[g][i][j], ADD_VALUES);
+        for (size_t gt = 0; gt < num_thermal; ++gt)
+          block_map[i * num_thermal + gt] = imap[i] * num_thermal + gt;
 
+      std::vector<double> Ablock(block_dim * block_dim, 0.0);
+      for (uint g = last_fast_group_; g < num_groups_; ++g)
+      {
+        const size_t gt = g - last_fast_group_;
+        for (size_t i = 0; i < num_nodes; ++i)
+          for (size_t j = 0; j < num_nodes; ++j)
+            Ablock[(i * num_thermal + gt) * block_dim + j * num_thermal + gt] = Acell[g][i][j];
+
+        for (const auto& [row_g, gprime, sigma_sm] : S.Row(g))
+        {
+          if (gprime < last_fast_group_ or gprime == g)
+            continue;
+          const size_t gpt = gprime - last_fast_group_;
+          for (size_t i = 0; i < num_nodes; ++i)
+            for (size_t j = 0; j < num_nodes; ++j)
+              Ablock[(i * num_thermal + gt) * block_dim + j * num_thermal + gpt] -=
+                sigma_sm * M[i * num_nodes + j];
+        }
+      }
+
+      thermal_assembler.AddElementMatrix(block_map, block_map, Ablock);
+    }
   } // for cell
 
   log.Log() << "Global assembly";
@@ -672,11 +760,10 @@ Solver::Assemble_A_bext()
     VecAssemblyBegin(bext_[g]);
     VecAssemblyEnd(bext_[g]);
   }
-  for (uint g = 0; g < num_groups_ + i_two_grid; ++g)
-  {
-    MatAssemblyBegin(A_[g], MAT_FINAL_ASSEMBLY);
-    MatAssemblyEnd(A_[g], MAT_FINAL_ASSEMBLY);
-  }
+  for (auto& assembler : assemblers)
+    assembler.Assemble();
+  if (do_thermal_block_solve_)
+    thermal_assembler.Assemble();
 
   //  PetscViewer viewer;
   //  PetscViewerASCIIOpen(opensn::mpi_comm,"A2_before_bc.m",&viewer);
@@ -698,19 +785,8 @@ Solver::Execute()
 {
   log.Log() << "\nExecuting CFEM Multigroup Diffusion solver";
 
-  // Create Krylov Solver
-  // setup KSP once for all
-  petsc_solver_ = CreateCommonKrylovSolverSetup(A_.front(),
-                                                TextName(),
-                                                KSPCG,
-                                                PCGAMG,
-                                                0.0,
-                                                basic_options_("residual_tolerance").FloatValue(),
-                                                basic_options_("max_inner_iters").IntegerValue());
-
-  KSPSetApplicationContext(petsc_solver_.ksp, (void*)&my_app_context_);
-  KSPMonitorCancel(petsc_solver_.ksp);
-  KSPMonitorSet(petsc_solver_.ksp, &mg_diffusion::MGKSPMonitor, nullptr, nullptr);
+  // Create Krylov Solvers
+  mg_diffusion::Solver::InitializeGroupSolvers();
 
   int64_t iverbose = basic_options_("verbose_level").IntegerValue();
   my_app_context_.verbose = iverbose > 1 ? PETSC_TRUE : PETSC_FALSE;
@@ -741,45 +817,50 @@ Solver::Execute()
   double thermal_error_all;
   double thermal_error_g;
 
-  do
+  if (do_thermal_block_solve_)
+    mg_diffusion::Solver::SolveThermalBlock(iverbose);
+  else
   {
-    thermal_error_all = 0.0;
-    for (unsigned int g = last_fast_group_; g < num_groups_; ++g)
+    do
     {
-      // conpute rhs src
-      mg_diffusion::Solver::Assemble_RHS(g, iverbose);
-      // copy solution
-      VecCopy(x_[g], x_old_[g]);
-      // solve group g for new solution
-      mg_diffusion::Solver::SolveOneGroupProblem(g, iverbose);
-      // compute L2 norm of thermal error for current g (requires one more copy)
-      VecCopy(x_[g], thermal_dphi_);
-      VecAXPY(thermal_dphi_, -1.0, x_old_[g]);
-      VecNorm(thermal_dphi_, NORM_2, &thermal_error_g);
-      thermal_error_all = std::max(thermal_error_all, thermal_error_g);
-    }
-    // perform two-grid
-    if (do_two_grid_)
-    {
-      mg_diffusion::Solver::Assemble_RHS_TwoGrid(iverbose);
-      mg_diffusion::Solver::SolveOneGroupProblem(num_groups_, iverbose);
-      mg_diffusion::Solver::Update_Flux_With_TwoGrid(iverbose);
-    }
+      thermal_error_all = 0.0;
+      for (unsigned int g = last_fast_group_; g < num_groups_; ++g)
+      {
+        // conpute rhs src
+        mg_diffusion::Solver::Assemble_RHS(g, iverbose);
+        // copy solution
+        VecCopy(x_[g], x_old_[g]);
+        // solve group g for new solution
+        mg_diffusion::Solver::SolveOneGroupProblem(g, iverbose);
+        // compute L2 norm of thermal error for current g (requires one more copy)
+        VecCopy(x_[g], thermal_dphi_);
+        VecAXPY(thermal_dphi_, -1.0, x_old_[g]);
+        VecNorm(thermal_dphi_, NORM_2, &thermal_error_g);
+        thermal_error_all = std::max(thermal_error_all, thermal_error_g);
+      }
+      // perform two-grid
+      if (do_two_grid_)
+      {
+        mg_diffusion::Solver::Assemble_RHS_TwoGrid(iverbose);
+        mg_diffusion::Solver::SolveOneGroupProblem(num_groups_, iverbose);
+        mg_diffusion::Solver::Update_Flux_With_TwoGrid(iverbose);
+      }
 
-    if (iverbose > 0)
-      log.Log() << " --thermal iteration = " << std::setw(5) << std::right << thermal_iteration
-                << ", Error=" << std::setw(11) << std::right << std::scientific
-                << std::setprecision(7) << thermal_error_all << std::endl;
+      if (iverbose > 0)
+        log.Log() << " --thermal iteration = " << std::setw(5) << std::right << thermal_iteration
+                  << ", Error=" << std::setw(11) << std::right << std::scientific
+                  << std::setprecision(7) << thermal_error_all << std::endl;
 
-    ++thermal_iteration;
-  } while ((thermal_error_all > thermal_tol) and (thermal_iteration < max_thermal_iters));
+      ++thermal_iteration;
+    } while ((thermal_error_all > thermal_tol) and (thermal_iteration < max_thermal_iters));
 
-  if (iverbose > 0)
-  {
-    if (thermal_error_all < thermal_tol)
-      std::cout << "\nThermal iterations converged for fixed-source problem" << std::endl;
-    else
-      std::cout << "\nThermal iterations NOT converged for fixed-source problem" << std::endl;
+    if (iverbose > 0)
+    {
+      if (thermal_error_all < thermal_tol)
+        std::cout << "\nThermal iterations converged for fixed-source problem" << std::endl;
+      else
+        std::cout << "\nThermal iterations NOT converged for fixed-source problem" << std::endl;
+    }
   }
 
   UpdateFieldFunctions();
@@ -792,53 +873,195 @@ Solver::Assemble_RHS(const unsigned int g, const int64_t verbose)
   if (verbose > 2)
     log.Log() << "\nAssemblying RHS for group " + std::to_string(g);
 
+  AssembleInScatteringRHS(g, num_groups_);
+}
+
+void
+Solver::AssembleInScatteringRHS(const unsigned int g, const unsigned int gp_end)
+{
   // copy the external source vector for group g into b
-  VecSet(b_, 0.0);
   VecCopy(bext_[g], b_);
 
-  const auto& sdm = *mg_diffusion::Solver::sdm_ptr_;
-  // compute inscattering term
-  for (const auto& cell : mg_diffusion::Solver::grid_ptr_->local_cells)
+  std::vector<GhostVecLocalRaw> xlocal(num_groups_);
+  for (uint gp = 0; gp < num_groups_; ++gp)
+    xlocal[gp] = GetGhostVectorLocalViewRead(x_[gp]);
+
+  // compute the in-scattered flux at the nodes of each cell
+  std::vector<double> phi_s(cell_local_dofs_.size(), 0.0);
+  for (const auto& cell : grid_ptr_->local_cells)
   {
-    const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
-    const size_t num_nodes = cell_mapping.NumNodes();
+    const size_t node_offset = cell_node_offsets_[cell.local_id_];
+    const size_t num_nodes = cell_node_offsets_[cell.local_id_ + 1] - node_offset;
 
-    const auto& xs = matid_to_xs_map.at(cell.material_id_);
-    const auto& S = xs->TransferMatrix(0);
+    const auto& S = matid_to_xs_map.at(cell.material_id_)->TransferMatrix(0);
 
     for (const auto& [row_g, gprime, sigma_sm] : S.Row(g))
     {
-      if (gprime != g) // g and row_g are the same, maybe different int types
+      // g and row_g are the same, maybe different int types
+      if (gprime != g and gprime < gp_end)
       {
-        const double* xlocal;
-        VecGetArrayRead(x_[gprime], &xlocal);
-
-        for (size_t i = 0; i < num_nodes; ++i)
-        {
-          const int64_t imap = sdm.MapDOF(cell, i);
-          double inscatter_g = 0.0;
-
-          for (size_t j = 0; j < num_nodes; ++j)
-          {
-            const int64_t jmap = sdm.MapDOFLocal(cell, j);
-
-            // get flux at node j
-            const double flxj_gp = xlocal[jmap];
-            for (size_t qp : fe_vol_data.QuadraturePointIndices())
-              inscatter_g += sigma_sm * flxj_gp * fe_vol_data.ShapeValue(i, qp) *
-                             fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
-          } // for j
-          // add inscattering value to vector
-          VecSetValue(b_, imap, inscatter_g, ADD_VALUES);
-        } // for i
-        VecRestoreArrayRead(x_[gprime], &xlocal);
+        const double* x_gp = xlocal[gprime].x_localized_raw;
+        for (size_t j = 0; j < num_nodes; ++j)
+          phi_s[node_offset + j] += sigma_sm * x_gp[cell_local_dofs_[node_offset + j]];
       } // if gp!=g
     }   // for gprime
   }     // for cell
 
-  VecAssemblyBegin(b_);
-  VecAssemblyEnd(b_);
+  for (uint gp = 0; gp < num_groups_; ++gp)
+    RestoreGhostVectorLocalViewRead(x_[gp], xlocal[gp]);
+
+  AddMassMatrixProduct(b_, phi_s);
+}
+
+void
+Solver::AddMassMatrixProduct(Vec b, const std::vector<double>& phi)
+{
+  Vec b_localized;
+  VecGhostGetLocalForm(b, &b_localized);
+  PetscInt num_localized = 0;
+  VecGetLocalSize(b_localized, &num_localized);
+  double* b_raw;
+  VecGetArray(b_localized, &b_raw);
+
+  // ghost entries only carry contributions destined for other processes
+  std::fill(b_raw + num_local_dofs_, b_raw + num_localized, 0.0);
+
+  for (const auto& cell : grid_ptr_->local_cells)
+  {
+    const size_t node_offset = cell_node_offsets_[cell.local_id_];
+    const size_t num_nodes = cell_node_offsets_[cell.local_id_ + 1] - node_offset;
+    const double* M = &cell_mass_matrices_[cell_mass_matrix_offsets_[cell.local_id_]];
+    const double* phi_cell = &phi[node_offset];
+
+    for (size_t i = 0; i < num_nodes; ++i)
+    {
+      double value = 0.0;
+      for (size_t j = 0; j < num_nodes; ++j)
+        value += M[i * num_nodes + j] * phi_cell[j];
+      b_raw[cell_local_dofs_[node_offset + i]] += value;
+    }
+  }
+
+  VecRestoreArray(b_localized, &b_raw);
+  VecGhostRestoreLocalForm(b, &b_localized);
+
+  VecGhostUpdateBegin(b, ADD_VALUES, SCATTER_REVERSE);
+  VecGhostUpdateEnd(b, ADD_VALUES, SCATTER_REVERSE);
+}
+
+void
+Solver::InitializeGroupSolvers()
+{
+  if (not petsc_solvers_.empty())
+    return;
+
+  // The operators never change, hence each preconditioner is set up on the
+  // first solve of its group and reused for all subsequent thermal iterations
+  for (auto& A : A_)
+  {
+    auto petsc_solver =
+      CreateCommonKrylovSolverSetup(A,
+                                    TextName(),
+                                    KSPCG,
+                                    PCGAMG,
+                                    0.0,
+                                    basic_options_("residual_tolerance").FloatValue(),
+                                    basic_options_("max_inner_iters").IntegerValue());
+
+    KSPSetApplicationContext(petsc_solver.ksp, (void*)&my_app_context_);
+    KSPMonitorCancel(petsc_solver.ksp);
+    KSPMonitorSet(petsc_solver.ksp, &mg_diffusion::MGKSPMonitor, nullptr, nullptr);
+
+    petsc_solvers_.push_back(petsc_solver);
+  }
+
+  if (do_thermal_block_solve_)
+  {
+    // The transfers make the coupled system nonsymmetric
+    thermal_solver_ =
+      CreateCommonKrylovSolverSetup(A_thermal_,
+                                    TextName() + "_thermal_",
+                                    KSPGMRES,
+                                    PCGAMG,
+                                    0.0,
+                                    basic_options_("residual_tolerance").FloatValue(),
+                                    basic_options_("max_inner_iters").IntegerValue());
+
+    KSPSetApplicationContext(thermal_solver_.ksp, (void*)&my_app_context_);
+    KSPMonitorCancel(thermal_solver_.ksp);
+    KSPMonitorSet(thermal_solver_.ksp, &mg_diffusion::MGKSPMonitor, nullptr, nullptr);
+  }
+}
+
+void
+Solver::InitializeThermalBlockSystem(const std::vector<int64_t>& nodal_nnz_in_diag,
+                                     const std::vector<int64_t>& nodal_nnz_off_diag)
+{
+  const auto num_thermal = static_cast<int64_t>(num_groups_ - last_fast_group_);
+  const auto n = static_cast<int64_t>(num_local_dofs_) * num_thermal;
+  const auto N = static_cast<int64_t>(num_globl_dofs_) * num_thermal;
+
+  log.Log() << "Initializing thermal block system with " << num_thermal
+            << " thermal groups and " << N << " unknowns";
+
+  // Every thermal group of a node couples to every thermal group of its
+  // neighbors through the transfers
+  std::vector<int64_t> block_nnz_in_diag(n);
+  std::vector<int64_t> block_nnz_off_diag(n);
+  for (size_t i = 0; i < num_local_dofs_; ++i)
+    for (int64_t gt = 0; gt < num_thermal; ++gt)
+    {
+      block_nnz_in_diag[i * num_thermal + gt] = nodal_nnz_in_diag[i] * num_thermal;
+      block_nnz_off_diag[i * num_thermal + gt] = nodal_nnz_off_diag[i] * num_thermal;
+    }
+
+  // The block size must be set before the matrix is preallocated so that
+  // block-aware preconditioners, e.g., GAMG or field-split, can use it
+  MatCreate(opensn::mpi_comm, &A_thermal_);
+  MatSetType(A_thermal_, MATMPIAIJ);
+  MatSetSizes(A_thermal_, n, n, N, N);
+  MatSetBlockSize(A_thermal_, num_thermal);
+  InitMatrixSparsity(A_thermal_, block_nnz_in_diag, block_nnz_off_diag);
+
+  MatCreateVecs(A_thermal_, &x_thermal_, &b_thermal_);
+  VecSet(x_thermal_, 0.0);
+}
+
+void
+Solver::SolveThermalBlock(const int64_t verbose)
+{
+  if (verbose > 1)
+    log.Log() << "Solving thermal groups " << last_fast_group_ << " to " << num_groups_ - 1
+              << " as one block";
+
+  // Only the in-scattering from the fast groups is a source. The thermal
+  // transfers are part of the block operator.
+  for (unsigned int g = last_fast_group_; g < num_groups_; ++g)
+  {
+    const auto gt = static_cast<PetscInt>(g - last_fast_group_);
+    AssembleInScatteringRHS(g, last_fast_group_);
+    VecStrideScatter(b_, gt, b_thermal_, INSERT_VALUES);
+    VecStrideScatter(x_[g], gt, x_thermal_, INSERT_VALUES);
+  }
+
+  KSPSolve(thermal_solver_.ksp, b_thermal_, x_thermal_);
+
+  for (unsigned int g = last_fast_group_; g < num_groups_; ++g)
+  {
+    const auto gt = static_cast<PetscInt>(g - last_fast_group_);
+    VecStrideGather(x_thermal_, gt, x_[g], INSERT_VALUES);
+    CommunicateGhostEntries(x_[g]);
+  }
+
+  if (verbose > 0)
+  {
+    PetscInt its;
+    KSPGetIterationNumber(thermal_solver_.ksp, &its);
+    KSPConvergedReason reason;
+    KSPGetConvergedReason(thermal_solver_.ksp, &reason);
+    log.Log() << " --thermal block solve iterations = " << its
+              << (reason > 0 ? ", converged" : ", NOT converged");
+  }
 }
 
 void
@@ -847,8 +1070,7 @@ Solver::SolveOneGroupProblem(const unsigned int g, const int64_t verbose)
   if (verbose > 1)
     log.Log() << "Solving group: " << g;
 
-  KSPSetOperators(petsc_solver_.ksp, A_[g], A_[g]);
-  KSPSolve(petsc_solver_.ksp, b_, x_[g]);
+  KSPSolve(petsc_solvers_[g].ksp, b_, x_[g]);
 
   // this is required to compute the inscattering RHS correctly in parallel
   CommunicateGhostEntries(x_[g]);
@@ -865,13 +1087,20 @@ Solver::Assemble_RHS_TwoGrid(const int64_t verbose)
 
   VecSet(b_, 0.0);
 
-  const auto& sdm = *sdm_ptr_;
-  // compute inscattering term
+  std::vector<GhostVecLocalRaw> xlocal(num_groups_);
+  std::vector<GhostVecLocalRaw> xlocal_old(num_groups_);
+  for (uint gp = last_fast_group_; gp < num_groups_; ++gp)
+  {
+    xlocal[gp] = GetGhostVectorLocalViewRead(x_[gp]);
+    xlocal_old[gp] = GetGhostVectorLocalViewRead(x_old_[gp]);
+  }
+
+  // compute the up-scattered flux change at the nodes of each cell
+  std::vector<double> delta_phi_s(cell_local_dofs_.size(), 0.0);
   for (const auto& cell : grid_ptr_->local_cells)
   {
-    const auto& cell_mapping = sdm.GetCellMapping(cell);
-    const auto fe_vol_data = cell_mapping.MakeVolumetricFiniteElementData();
-    const size_t num_nodes = cell_mapping.NumNodes();
+    const size_t node_offset = cell_node_offsets_[cell.local_id_];
+    const size_t num_nodes = cell_node_offsets_[cell.local_id_ + 1] - node_offset;
 
     const auto& S = matid_to_xs_map.at(cell.material_id_)->TransferMatrix(0);
 
@@ -881,40 +1110,25 @@ Solver::Assemble_RHS_TwoGrid(const int64_t verbose)
       {
         if (gprime > g) // the upper part for the residual of two-grid accel
         {
-          const double* xlocal;
-          const double* xlocal_old;
-          VecGetArrayRead(x_[gprime], &xlocal);
-          VecGetArrayRead(x_old_[gprime], &xlocal_old);
-
-          for (size_t i = 0; i < num_nodes; ++i)
+          const double* x_gp = xlocal[gprime].x_localized_raw;
+          const double* x_old_gp = xlocal_old[gprime].x_localized_raw;
+          for (size_t j = 0; j < num_nodes; ++j)
           {
-            const int64_t imap = sdm.MapDOF(cell, i);
-            double inscatter_g = 0.0;
-
-            for (size_t j = 0; j < num_nodes; ++j)
-            {
-              const int64_t jmap = sdm.MapDOFLocal(cell, j);
-
-              // get flux at node j
-              const double delta_flxj_gp = xlocal[jmap] - xlocal_old[jmap];
-              for (size_t qp : fe_vol_data.QuadraturePointIndices())
-                inscatter_g += sigma_sm * delta_flxj_gp * fe_vol_data.ShapeValue(i, qp) *
-                               fe_vol_data.ShapeValue(j, qp) * fe_vol_data.JxW(qp);
-            } // for j
-            // add inscattering value to vector
-            VecSetValue(b_, imap, inscatter_g, ADD_VALUES);
-          } // for i
-          VecRestoreArrayRead(x_[gprime], &xlocal);
-          VecRestoreArrayRead(x_old_[gprime], &xlocal_old);
+            const int64_t jmap = cell_local_dofs_[node_offset + j];
+            delta_phi_s[node_offset + j] += sigma_sm * (x_gp[jmap] - x_old_gp[jmap]);
+          }
         } // if gp!=g
       }   // for gprime
     }     // for g
   }       // for cell
 
-  VecAssemblyBegin(b_);
-  VecAssemblyEnd(b_);
-  //  VecView(b, PETSC_VIEWER_STDERR_WORLD);
-  //  chi::Exit(1234);
+  for (uint gp = last_fast_group_; gp < num_groups_; ++gp)
+  {
+    RestoreGhostVectorLocalViewRead(x_[gp], xlocal[gp]);
+    RestoreGhostVectorLocalViewRead(x_old_[gp], xlocal_old[gp]);
+  }
+
+  AddMassMatrixProduct(b_, delta_phi_s);
 }
 
 void
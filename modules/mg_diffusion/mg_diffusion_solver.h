@@ -48,6 +48,7 @@ public:
   uint num_groups_ = 0;
   uint last_fast_group_ = 0;
   bool do_two_grid_ = false;
+  bool do_thermal_block_solve_ = false;
 
   size_t num_local_dofs_ = 0;
   size_t num_globl_dofs_ = 0;
@@ -63,12 +64,30 @@ public:
 
   /// error vector for thermal fluxes
   Vec thermal_dphi_ = nullptr;
-  /// actual rhs vector for the linear system A[g] x[g] = b
+  /// actual rhs vector for the linear system A[g] x[g] = b (ghosted)
   Vec b_ = nullptr;
 
-  PETScSolverSetup petsc_solver_;
+  /// Krylov solver for each group (and the two-grid operator). Each solver
+  /// keeps its own preconditioner so that it is set up only once.
+  std::vector<PETScSolverSetup> petsc_solvers_;
   KSPAppContext my_app_context_;
 
+  /// coupled thermal-group matrix with a nodal block layout
+  Mat A_thermal_ = nullptr;
+  /// coupled thermal-group solution and rhs vectors
+  Vec x_thermal_ = nullptr;
+  Vec b_thermal_ = nullptr;
+  PETScSolverSetup thermal_solver_;
+
+  /// local dof indices of the nodes of each local cell
+  std::vector<int64_t> cell_local_dofs_;
+  /// offsets into cell_local_dofs_ for each local cell
+  std::vector<size_t> cell_node_offsets_;
+  /// row-major mass matrices of each local cell
+  std::vector<double> cell_mass_matrices_;
+  /// offsets into cell_mass_matrices_ for each local cell
+  std::vector<size_t> cell_mass_matrix_offsets_;
+
   std::vector<std::vector<double>> VF_;
 
   //  typedef std::pair<BoundaryType,std::vector<double>> BoundaryInfo;
@@ -96,6 +115,17 @@ public:
   void SolveOneGroupProblem(unsigned int g, int64_t iverbose);
   void Update_Flux_With_TwoGrid(int64_t iverbose);
 
+  /**
+   * Solves all thermal groups at once with the coupled thermal-group matrix,
+   * replacing the Gauss-Seidel thermal iterations.
+   */
+  void SolveThermalBlock(int64_t iverbose);
+
+  /**
+   * Creates the Krylov solvers of all groups, if not yet created.
+   */
+  void InitializeGroupSolvers();
+
   /**
    * Updates the field functions with the lates data.
    */
@@ -107,6 +137,27 @@ protected:
   std::map<int, std::shared_ptr<IsotropicMultiGrpSource>> matid_to_src_map;
 
   std::map<int, TwoGridCollapsedInfo> map_mat_id_2_tginfo;
+
+  /**
+   * Adds the product of each local cell mass matrix with the cell-local values
+   * of `phi` to the ghosted vector `b`. Contributions to ghost entries are
+   * accumulated locally and sent to their owners.
+   */
+  void AddMassMatrixProduct(Vec b, const std::vector<double>& phi);
+
+  /**
+   * Sets b to the external source of group `g` plus the in-scattering from
+   * groups `[0, gp_end)`, excluding `g` itself.
+   */
+  void AssembleInScatteringRHS(unsigned int g, unsigned int gp_end);
+
+  /**
+   * Creates the coupled thermal-group matrix and vectors. Unknowns are
+   * ordered node-major, i.e., with the thermal groups of a node contiguous,
+   * and the block size is the number of thermal groups.
+   */
+  void InitializeThermalBlockSystem(const std::vector<int64_t>& nodal_nnz_in_diag,
+                                    const std::vector<int64_t>& nodal_nnz_off_diag);
   //  std::map<int, Multigroup_D_and_sigR> map_mat_id_2_tgXS;
 };
 
@@ -6,6 +6,7 @@
 #include "framework/logging/log.h"
 
 #include <numeric>
+#include <cmath>
 
 namespace opensn
 {
@@ -37,17 +38,27 @@ TransientSolver::GetInputParameters()
 
   params.AddOptionalParameter("initial_population", 1.0, "Initial neutron population");
 
+  params.AddOptionalParameter("time_integration",
+                              "implicit_euler",
+                              "Time integration scheme to use. The scheme \"sdirk2\" is an "
+                              "L-stable, second order SDIRK method with an embedded first order "
+                              "error estimate which adapts the time step size.");
+
+  params.AddOptionalParameter(
+    "rel_tol", 1.0e-4, "Relative error tolerance per time step for adaptive time integration.");
   params.AddOptionalParameter(
-    "time_integration", "implicit_euler", "Time integration scheme to use");
+    "abs_tol", 1.0e-8, "Absolute error tolerance per time step for adaptive time integration.");
 
   auto time_intgl_list =
-    AllowableRangeList::New({"explicit_euler", "implicit_euler", "crank_nicolson"});
+    AllowableRangeList::New({"explicit_euler", "implicit_euler", "crank_nicolson", "sdirk2"});
 
   params.ConstrainParameterRange("time_integration", std::move(time_intgl_list));
 
   params.ConstrainParameterRange("gen_time", AllowableRangeLowLimit::New(1.0e-12));
   params.ConstrainParameterRange("initial_source", AllowableRangeLowLimit::New(0.0));
   params.ConstrainParameterRange("initial_population", AllowableRangeLowLimit::New(0.0));
+  params.ConstrainParameterRange("rel_tol", AllowableRangeLowLimit::New(0.0, false));
+  params.ConstrainParameterRange("abs_tol", AllowableRangeLowLimit::New(0.0, false));
   return params;
 }
 
@@ -59,6 +70,8 @@ TransientSolver::TransientSolver(const InputParameters& params)
     rho_(params.GetParamValue<double>("initial_rho")),
     source_strength_(params.GetParamValue<double>("initial_source")),
     time_integration_(params.GetParamValue<std::string>("time_integration")),
+    rel_tol_(params.GetParamValue<double>("rel_tol")),
+    abs_tol_(params.GetParamValue<double>("abs_tol")),
     num_precursors_(lambdas_.size())
 {
   log.Log() << "Created solver " << TextName();
@@ -92,8 +105,6 @@ TransientSolver::Initialize()
   // Initializing linalg items
   const auto& J = num_precursors_;
   A_ = DynamicMatrix<double>(J + 1, J + 1, 0.0);
-  I_ = A_;
-  I_.SetDiagonal(1.0);
 
   x_t_ = DynamicVector<double>(J + 1, 0.0);
 
@@ -109,6 +120,13 @@ TransientSolver::Initialize()
   q_.resize(J + 1, 0.0);
   q_[0] = source_strength_;
 
+  inv_diag_.assign(J + 1, 0.0);
+  factor_coeff_ = -1.0;
+  rhs_ = DynamicVector<double>(J + 1, 0.0);
+  y1_ = rhs_;
+  err_ = rhs_;
+  x_tp1_ = rhs_;
+
   // Initializing x
   // If there is a source and the reactivity is < 0 then
   // there exists a unique solution.
@@ -153,7 +171,7 @@ TransientSolver::Step()
 {
   log.Log() << "Solver \"" + TextName() + "\" " + timestepper_->StringTimeInfo();
 
-  const double dt = timestepper_->TimeStepSize();
+  double dt = timestepper_->TimeStepSize();
 
   A_[0][0] = beta_ * (rho_ - 1.0) / gen_time_;
 
@@ -168,16 +186,55 @@ TransientSolver::Step()
 
     const double inv_tau = theta * dt;
 
-    auto A_theta = I_ - inv_tau * A_;
-    auto b_theta = x_t_ + inv_tau * q_;
+    for (size_t i = 0; i < rhs_.size(); ++i)
+      rhs_[i] = x_t_[i] + inv_tau * q_[i];
 
-    auto x_theta = A_theta.Inverse() * b_theta;
+    SolveShifted(inv_tau, rhs_, y1_);
 
-    x_tp1_ = x_t_ + (1.0 / theta) * (x_theta - x_t_);
+    for (size_t i = 0; i < x_tp1_.size(); ++i)
+      x_tp1_[i] = x_t_[i] + (1.0 / theta) * (y1_[i] - x_t_[i]);
   }
   else if (time_integration_ == "explicit_euler")
   {
-    x_tp1_ = x_t_ + dt * A_ * x_t_ + dt * q_;
+    for (size_t i = 0; i < x_tp1_.size(); ++i)
+    {
+      double Ax_i = 0.0;
+      for (size_t j = 0; j < x_t_.size(); ++j)
+        Ax_i += A_[i][j] * x_t_[j];
+      x_tp1_[i] = x_t_[i] + dt * (Ax_i + q_[i]);
+    }
+  }
+  else if (time_integration_ == "sdirk2")
+  {
+    // Step size factors: safety, maximum growth and maximum reduction
+    const double safety = 0.9;
+    const double max_factor = 5.0;
+    const double min_factor = 0.2;
+    const double dt_min = timestepper_->MinimumTimeStepSize();
+
+    // Repeat the step with reduced step sizes until the error is acceptable
+    while (true)
+    {
+      const double error = StepSDIRK2(dt);
+      const double factor =
+        std::min(max_factor,
+                 std::max(min_factor, safety / std::sqrt(std::max(error, 1.0e-10))));
+
+      if (error <= 1.0)
+      {
+        dt_next_ = std::max(dt * factor, dt_min);
+        break;
+      }
+      if (dt <= dt_min)
+      {
+        log.Log0Warning() << TextName() << ": Error estimate " << error
+                          << " exceeds the tolerance at the minimum time step size.";
+        dt_next_ = dt_min;
+        break;
+      }
+      dt = std::max(dt * factor, dt_min);
+    }
+    timestepper_->SetTimeStepSize(dt);
   }
   else
     OpenSnLogicalError("Unsupported time integration scheme.");
@@ -195,6 +252,75 @@ TransientSolver::Advance()
 {
   x_t_ = x_tp1_;
   timestepper_->Advance();
+  if (time_integration_ == "sdirk2")
+    timestepper_->SetTimeStepSize(dt_next_);
+}
+
+void
+TransientSolver::SolveShifted(double c, const DynamicVector<double>& b, DynamicVector<double>& x)
+{
+  const auto& J = num_precursors_;
+
+  // Eliminating the precursor unknowns only depends on c
+  if (c != factor_coeff_)
+  {
+    schur_sum_ = 0.0;
+    for (size_t j = 1; j <= J; ++j)
+    {
+      inv_diag_[j] = 1.0 / (1.0 - c * A_[j][j]);
+      schur_sum_ += c * A_[0][j] * c * A_[j][0] * inv_diag_[j];
+    }
+    factor_coeff_ = c;
+  }
+
+  // Population, with the current A[0][0] in the pivot
+  double rhs_0 = b[0];
+  for (size_t j = 1; j <= J; ++j)
+    rhs_0 += c * A_[0][j] * b[j] * inv_diag_[j];
+  x[0] = rhs_0 / (1.0 - c * A_[0][0] - schur_sum_);
+
+  // Precursors
+  for (size_t j = 1; j <= J; ++j)
+    x[j] = (b[j] + c * A_[j][0] * x[0]) * inv_diag_[j];
+}
+
+double
+TransientSolver::StepSDIRK2(double dt)
+{
+  const double gamma = 1.0 - 1.0 / std::sqrt(2.0);
+  const double c = gamma * dt;
+  const size_t n = x_t_.size();
+
+  // Stage 1: (I - c A) Y1 = x + c q
+  for (size_t i = 0; i < n; ++i)
+    rhs_[i] = x_t_[i] + c * q_[i];
+  SolveShifted(c, rhs_, y1_);
+
+  // Stage 2: (I - c A) Y2 = x + (1 - gamma) dt f(Y1) + c q, with
+  // f(Y1) = (Y1 - x)/c. The method is stiffly accurate, i.e., x^{n+1} = Y2.
+  for (size_t i = 0; i < n; ++i)
+  {
+    const double f1 = (y1_[i] - x_t_[i]) / c;
+    rhs_[i] = x_t_[i] + (1.0 - gamma) * dt * f1 + c * q_[i];
+    err_[i] = x_t_[i] + dt * f1;
+  }
+  SolveShifted(c, rhs_, x_tp1_);
+
+  // Difference to the embedded solution x + dt f(Y1), filtered with
+  // (I - c A)^{-1} so that stiff components do not inflate the estimate
+  for (size_t i = 0; i < n; ++i)
+    rhs_[i] = x_tp1_[i] - err_[i];
+  SolveShifted(c, rhs_, err_);
+
+  double norm = 0.0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    const double scale =
+      abs_tol_ + rel_tol_ * std::max(std::fabs(x_t_[i]), std::fabs(x_tp1_[i]));
+    norm += (err_[i] / scale) * (err_[i] / scale);
+  }
+
+  return std::sqrt(norm / static_cast<double>(n));
 }
 
 ParameterBlock
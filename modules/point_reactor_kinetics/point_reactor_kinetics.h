@@ -22,12 +22,24 @@ private:
   double source_strength_;
   std::string time_integration_;
 
+  double rel_tol_;
+  double abs_tol_;
+
   size_t num_precursors_;
-  DynamicMatrix<double> A_, I_;
+  DynamicMatrix<double> A_;
   DynamicVector<double> x_t_, x_tp1_, q_;
   double beta_ = 1.0;
   double period_tph_ = 0.0;
 
+  // Factorization of I - c*A for the last coefficient c
+  double factor_coeff_ = -1.0;
+  std::vector<double> inv_diag_;
+  double schur_sum_ = 0.0;
+
+  // Adaptive stepping
+  double dt_next_ = 0.0;
+  DynamicVector<double> rhs_, y1_, err_;
+
 public:
   /**Sets input parameters.*/
   static InputParameters GetInputParameters();
@@ -75,6 +87,20 @@ public:
 
   /**Sets the value of rho.*/
   void SetRho(double value);
+
+private:
+  /**Solves \f$ (I - c A) x = b \f$. The system matrix is an arrowhead matrix:
+   * apart from the diagonal only its first row and column are nonzero. It is
+   * factored by eliminating the precursor unknowns, which is cached for the
+   * last coefficient `c`. A change of the reactivity only modifies `A[0][0]`,
+   * a rank-one modification that only affects the scalar pivot of the
+   * factorization, so the cached factorization stays valid.*/
+  void SolveShifted(double c, const DynamicVector<double>& b, DynamicVector<double>& x);
+
+  /**Takes a step of the L-stable, stiffly accurate two-stage SDIRK method of
+   * order 2 from `x_t_` to `x_tp1_`. Returns the weighted RMS norm of the
+   * difference to the embedded first order solution.*/
+  double StepSDIRK2(double dt);
 };
 
 } // namespace prk
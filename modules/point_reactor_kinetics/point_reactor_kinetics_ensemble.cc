@@ -0,0 +1,288 @@
+#include "modules/point_reactor_kinetics/point_reactor_kinetics_ensemble.h"
+
+#include "framework/math/functions/function_dimA_to_dimB.h"
+#include "framework/physics/time_steppers/time_stepper.h"
+#include "framework/object_factory.h"
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include <numeric>
+
+namespace opensn
+{
+namespace prk
+{
+
+OpenSnRegisterObjectInNamespace(prk, EnsembleSolver);
+
+namespace
+{
+
+/**Expands a per member parameter that is given either for all members or
+ * once for the whole ensemble.*/
+std::vector<double>
+PerMember(const InputParameters& params, const std::string& name, size_t num_members)
+{
+  auto values = params.GetParamVectorValue<double>(name);
+  OpenSnInvalidArgumentIf(values.size() != 1 and values.size() != num_members,
+                          "Parameter \"" + name + "\" must have 1 or " +
+                            std::to_string(num_members) + " entries.");
+  if (values.size() == 1)
+    values.assign(num_members, values.front());
+  return values;
+}
+
+} // namespace
+
+InputParameters
+EnsembleSolver::GetInputParameters()
+{
+  InputParameters params = opensn::Solver::GetInputParameters();
+
+  params.SetGeneralDescription(
+    "Ensemble of point reactor kinetics models advanced together. The members share the delayed "
+    "neutron data but have their own generation time, source and reactivity history.");
+  params.SetDocGroup("prk");
+
+  params.ChangeExistingParamToOptional("name", "prk_EnsembleSolver");
+
+  std::vector<double> default_lambdas = {0.0124, 0.0304, 0.111, 0.301, 1.14, 3.01};
+  std::vector<double> default_betas = {0.00021, 0.00142, 0.00127, 0.00257, 0.00075, 0.00027};
+
+  params.AddOptionalParameterArray(
+    "precursor_lambdas", default_lambdas, "An array of decay constants");
+  params.AddOptionalParameterArray(
+    "precursor_betas", default_betas, "An array of fractional delayed neutron fractions");
+
+  params.AddRequiredParameter<size_t>("num_members", "The number of ensemble members.");
+
+  params.AddOptionalParameterArray(
+    "gen_times", std::vector<double>{1.0e-5}, "Neutron generation time [s], once or per member.");
+  params.AddOptionalParameterArray(
+    "initial_rhos", std::vector<double>{0.0}, "Initial reactivity [$], once or per member.");
+  params.AddOptionalParameterArray(
+    "sources", std::vector<double>{0.0}, "Source strength [/s], once or per member.");
+
+  params.AddOptionalParameterArray(
+    "reactivity_functions",
+    std::vector<size_t>{},
+    "Handles to functions of time returning the reactivity [$], once or per member. Functions "
+    "are evaluated at the time of the implicit stage. If not supplied, the initial reactivities "
+    "are kept constant.");
+
+  params.AddOptionalParameter(
+    "time_integration", "implicit_euler", "Time integration scheme to use");
+  params.ConstrainParameterRange("time_integration",
+                                 AllowableRangeList::New({"implicit_euler", "crank_nicolson"}));
+
+  params.AddOptionalParameter(
+    "history_interval", 1, "The populations are recorded every this many time steps.");
+  params.ConstrainParameterRange("history_interval", AllowableRangeLowLimit::New(1));
+  params.ConstrainParameterRange("num_members", AllowableRangeLowLimit::New(1));
+
+  return params;
+}
+
+EnsembleSolver::EnsembleSolver(const InputParameters& params)
+  : opensn::Solver(params),
+    lambdas_(params.GetParamVectorValue<double>("precursor_lambdas")),
+    betas_(params.GetParamVectorValue<double>("precursor_betas")),
+    time_integration_(params.GetParamValue<std::string>("time_integration")),
+    num_members_(params.GetParamValue<size_t>("num_members")),
+    num_precursors_(lambdas_.size()),
+    history_interval_(params.GetParamValue<size_t>("history_interval"))
+{
+  OpenSnInvalidArgumentIf(lambdas_.size() != betas_.size(),
+                          "Number of precursors cannot be deduced from precursor data because "
+                          "the data lists are of different size.");
+
+  const auto gen_times = PerMember(params, "gen_times", num_members_);
+  for (const double gen_time : gen_times)
+  {
+    OpenSnInvalidArgumentIf(gen_time <= 0.0, "Generation times must be positive.");
+    inv_gen_times_.push_back(1.0 / gen_time);
+  }
+  rhos_ = PerMember(params, "initial_rhos", num_members_);
+  sources_ = PerMember(params, "sources", num_members_);
+
+  const auto function_handles = params.GetParamVectorValue<size_t>("reactivity_functions");
+  OpenSnInvalidArgumentIf(not function_handles.empty() and function_handles.size() != 1 and
+                            function_handles.size() != num_members_,
+                          "Parameter \"reactivity_functions\" must have 0, 1 or " +
+                            std::to_string(num_members_) + " entries.");
+  for (const size_t handle : function_handles)
+    rho_functions_.push_back(
+      GetStackItemPtrAsType<FunctionDimAToDimB>(object_stack, handle, __FUNCTION__));
+}
+
+void
+EnsembleSolver::Initialize()
+{
+  const size_t N = num_members_;
+  const size_t J = num_precursors_;
+
+  beta_ = std::accumulate(betas_.begin(), betas_.end(), 0.0);
+
+  populations_.assign(N, 0.0);
+  precursors_.assign(J * N, 0.0);
+  populations_new_ = populations_;
+  precursors_new_ = precursors_;
+  rhs_.assign(N, 0.0);
+  inv_diag_.assign(J, 0.0);
+
+  // Members with a source and negative reactivity start from their
+  // subcritical equilibrium, all others from a critical state with unit
+  // population
+  for (size_t m = 0; m < N; ++m)
+  {
+    if (sources_[m] > 0.0 and rhos_[m] < 0.0)
+      populations_[m] = -sources_[m] / (beta_ * rhos_[m] * inv_gen_times_[m]);
+    else
+      populations_[m] = 1.0;
+  }
+  for (size_t j = 0; j < J; ++j)
+  {
+    const double coeff = betas_[j] / lambdas_[j];
+    double* C_j = &precursors_[j * N];
+    for (size_t m = 0; m < N; ++m)
+      C_j[m] = coeff * inv_gen_times_[m] * populations_[m];
+  }
+
+  history_times_.clear();
+  population_history_.clear();
+  RecordHistory();
+
+  log.Log() << "Initialized " << TextName() << " with " << N << " members";
+}
+
+void
+EnsembleSolver::Execute()
+{
+  while (timestepper_->IsActive())
+  {
+    Step();
+    Advance();
+  }
+}
+
+void
+EnsembleSolver::Step()
+{
+  const size_t N = num_members_;
+  const size_t J = num_precursors_;
+
+  const double dt = timestepper_->TimeStepSize();
+  const double theta = time_integration_ == "crank_nicolson" ? 0.5 : 1.0;
+  const double c = theta * dt;
+  const double inv_theta = 1.0 / theta;
+
+  // Reactivities at the implicit stage
+  if (not rho_functions_.empty())
+  {
+    const double t_theta = timestepper_->Time() + c;
+    if (rho_functions_.size() == 1)
+      rhos_.assign(N, rho_functions_.front()->ScalarFunction1Parameter(t_theta));
+    else
+      for (size_t m = 0; m < N; ++m)
+        rhos_[m] = rho_functions_[m]->ScalarFunction1Parameter(t_theta);
+  }
+
+  // The system I - c A_m of each member is an arrowhead matrix. The
+  // precursor equations are eliminated, which leaves a scalar equation for
+  // the population at the implicit stage.
+  double schur_sum = 0.0;
+  for (size_t j = 0; j < J; ++j)
+  {
+    inv_diag_[j] = 1.0 / (1.0 + c * lambdas_[j]);
+    schur_sum += c * lambdas_[j] * c * betas_[j] * inv_diag_[j];
+  }
+
+  double* P_new = populations_new_.data();
+  const double* P = populations_.data();
+
+  for (size_t m = 0; m < N; ++m)
+    rhs_[m] = P[m] + c * sources_[m];
+  for (size_t j = 0; j < J; ++j)
+  {
+    const double coeff = c * lambdas_[j] * inv_diag_[j];
+    const double* C_j = &precursors_[j * N];
+    for (size_t m = 0; m < N; ++m)
+      rhs_[m] += coeff * C_j[m];
+  }
+
+  // Population at the implicit stage, stored in P_new for now
+  for (size_t m = 0; m < N; ++m)
+  {
+    const double pivot =
+      1.0 - c * inv_gen_times_[m] * (beta_ * (rhos_[m] - 1.0) + schur_sum / c);
+    P_new[m] = rhs_[m] / pivot;
+  }
+
+  // Precursors at the implicit stage, extrapolated to the end of the step
+  for (size_t j = 0; j < J; ++j)
+  {
+    const double coeff = c * betas_[j];
+    const double* C_j = &precursors_[j * N];
+    double* C_new_j = &precursors_new_[j * N];
+    for (size_t m = 0; m < N; ++m)
+    {
+      const double C_theta = (C_j[m] + coeff * inv_gen_times_[m] * P_new[m]) * inv_diag_[j];
+      C_new_j[m] = C_j[m] + inv_theta * (C_theta - C_j[m]);
+    }
+  }
+
+  for (size_t m = 0; m < N; ++m)
+    P_new[m] = P[m] + inv_theta * (P_new[m] - P[m]);
+}
+
+void
+EnsembleSolver::Advance()
+{
+  populations_.swap(populations_new_);
+  precursors_.swap(precursors_new_);
+  timestepper_->Advance();
+
+  if (timestepper_->TimeStepIndex() % history_interval_ == 0 or not timestepper_->IsActive())
+    RecordHistory();
+}
+
+void
+EnsembleSolver::RecordHistory()
+{
+  history_times_.push_back(timestepper_->Time());
+  population_history_.insert(population_history_.end(), populations_.begin(), populations_.end());
+}
+
+ParameterBlock
+EnsembleSolver::GetInfo(const ParameterBlock& params) const
+{
+  const auto param_name = params.GetParamValue<std::string>("name");
+
+  if (param_name == "num_members")
+    return ParameterBlock("", num_members_);
+  else if (param_name == "populations")
+    return ParameterBlock("", populations_);
+  else if (param_name == "rhos")
+    return ParameterBlock("", rhos_);
+  else if (param_name == "history_times")
+    return ParameterBlock("", history_times_);
+  else if (param_name == "population_history")
+  {
+    if (not params.Has("member"))
+      return ParameterBlock("", population_history_);
+
+    const auto m = params.GetParamValue<size_t>("member");
+    OpenSnInvalidArgumentIf(m >= num_members_,
+                            "Member " + std::to_string(m) + " out of range.");
+    std::vector<double> history;
+    history.reserve(history_times_.size());
+    for (size_t k = 0; k < history_times_.size(); ++k)
+      history.push_back(population_history_[k * num_members_ + m]);
+    return ParameterBlock("", history);
+  }
+  else
+    OpenSnInvalidArgument("Unsupported info name \"" + param_name + "\".");
+}
+
+} // namespace prk
+} // namespace opensn
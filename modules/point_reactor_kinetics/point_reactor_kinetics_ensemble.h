@@ -0,0 +1,94 @@
+#pragma once
+
+#include "framework/physics/solver_base/solver.h"
+
+#include <memory>
+
+namespace opensn
+{
+class FunctionDimAToDimB;
+
+namespace prk
+{
+
+/**Ensemble of point reactor kinetics models. All members share the delayed
+ * neutron data but each member has its own neutron generation time, source
+ * strength and reactivity history. The states of all members are stored in
+ * structure-of-arrays form, i.e., the populations of all members are
+ * contiguous, followed by the concentrations of each precursor group for all
+ * members, and the members are advanced together in one native time stepping
+ * loop with the member index as the innermost loop.*/
+class EnsembleSolver : public opensn::Solver
+{
+private:
+  const std::vector<double> lambdas_;
+  const std::vector<double> betas_;
+  const std::string time_integration_;
+  const size_t num_members_;
+  const size_t num_precursors_;
+  const size_t history_interval_;
+
+  std::vector<std::shared_ptr<FunctionDimAToDimB>> rho_functions_;
+  double beta_ = 1.0;
+
+  // Per member data
+  std::vector<double> inv_gen_times_;
+  std::vector<double> sources_;
+  std::vector<double> rhos_;
+
+  // State at the current time and at the end of the time step. Precursor
+  // concentration j of member m is at index j * N + m.
+  std::vector<double> populations_;
+  std::vector<double> precursors_;
+  std::vector<double> populations_new_;
+  std::vector<double> precursors_new_;
+
+  // Scratch
+  std::vector<double> rhs_;
+  std::vector<double> inv_diag_;
+
+  // Recorded histories
+  std::vector<double> history_times_;
+  std::vector<double> population_history_;
+
+public:
+  /**Sets input parameters.*/
+  static InputParameters GetInputParameters();
+  /**Constructor.*/
+  explicit EnsembleSolver(const InputParameters& params);
+
+  void Initialize() override;
+  void Execute() override;
+  void Step() override;
+  void Advance() override;
+
+  /**\addtogroup prk
+   *
+   * \section EnsembleInfo Information that can be requested
+   * - `num_members`, The number of ensemble members
+   * - `populations`, The current populations of all members
+   * - `rhos`, The reactivities used in the last time step
+   * - `history_times`, The times at which the populations were recorded
+   * - `population_history`, The recorded populations of the member given
+   *   with the `member` parameter, or, without it, of all members with the
+   *   member index varying fastest
+   */
+  ParameterBlock GetInfo(const ParameterBlock& params) const override;
+
+  /**Returns the current populations of all members.*/
+  const std::vector<double>& Populations() const { return populations_; }
+
+  /**Returns the times at which the populations were recorded.*/
+  const std::vector<double>& HistoryTimes() const { return history_times_; }
+
+  /**Returns the recorded populations. Entry `k * N + m` is the population of
+   * member `m` at `HistoryTimes()[k]`.*/
+  const std::vector<double>& PopulationHistory() const { return population_history_; }
+
+private:
+  /**Records the current populations.*/
+  void RecordHistory();
+};
+
+} // namespace prk
+} // namespace opensn
@@ -0,0 +1,229 @@
+#include "framework/data_types/compressed_vector.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include "lua/framework/console/console.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock data_types_Test01(const InputParameters& params);
+
+RegisterWrapperFunctionNamespace(unit_tests, data_types_Test01, nullptr, data_types_Test01);
+
+namespace
+{
+
+/**Returns true if every decompressed value is within `tolerance` times the
+ * largest magnitude of its block of the original value.*/
+bool
+WithinErrorBound(const std::vector<double>& values,
+                 const std::vector<double>& decompressed,
+                 const size_t block_size,
+                 const double tolerance)
+{
+  if (decompressed.size() != values.size())
+    return false;
+
+  constexpr double eps = std::numeric_limits<double>::epsilon();
+  for (size_t begin = 0; begin < values.size(); begin += block_size)
+  {
+    const size_t end = std::min(begin + block_size, values.size());
+    double max_abs = 0.0;
+    for (size_t i = begin; i < end; ++i)
+      max_abs = std::max(max_abs, std::fabs(values[i]));
+
+    // Allow for the round-off of the dequantization itself
+    const double bound = tolerance * max_abs + 8.0 * eps * max_abs;
+    for (size_t i = begin; i < end; ++i)
+      if (std::fabs(decompressed[i] - values[i]) > bound)
+        return false;
+  }
+  return true;
+}
+
+/**Returns true if the values are bitwise identical.*/
+bool
+BitwiseEqual(const std::vector<double>& a, const std::vector<double>& b)
+{
+  return a.size() == b.size() and std::memcmp(a.data(), b.data(), a.size() * sizeof(double)) == 0;
+}
+
+void
+LogResult(const std::string& name, const bool passed)
+{
+  opensn::log.Log() << "CompressedVector " << name << " ... " << (passed ? "Passed" : "Failed");
+}
+
+} // namespace
+
+ParameterBlock
+data_types_Test01(const InputParameters&)
+{
+  std::mt19937 generator(20241019);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+
+  // Random blocks, including a shorter last block, scaled per block so the
+  // error bound is relative to each block's own magnitude
+  const size_t block_size = 7;
+  std::vector<double> values(1000);
+  for (size_t i = 0; i < values.size(); ++i)
+    values[i] = std::ldexp(distribution(generator), static_cast<int>(i / block_size) % 20 - 10);
+
+  // Error bound
+  {
+    bool passed = true;
+    for (const double tolerance : {1.0e-1, 1.0e-3, 1.0e-6, 1.0e-12})
+    {
+      const CompressedVector compressed(values, block_size, tolerance);
+      std::vector<double> decompressed;
+      compressed.Decompress(decompressed);
+      passed = passed and WithinErrorBound(values, decompressed, block_size, tolerance);
+      passed = passed and compressed.CompressedDataSize() < values.size() * sizeof(double);
+    }
+    LogResult("error bound", passed);
+  }
+
+  // A zero tolerance, and a tolerance too small to quantize with fewer than
+  // 53 bits, are lossless
+  {
+    bool passed = true;
+    for (const double tolerance : {0.0, 1.0e-17})
+    {
+      const CompressedVector compressed(values, block_size, tolerance);
+      std::vector<double> decompressed;
+      compressed.Decompress(decompressed);
+      passed = passed and BitwiseEqual(values, decompressed);
+    }
+    LogResult("lossless", passed);
+  }
+
+  // Constant blocks need no compressed data and are reproduced exactly
+  {
+    std::vector<double> constant_values(4 * block_size, 0.0);
+    std::fill(constant_values.begin() + block_size, constant_values.begin() + 2 * block_size, 1.5);
+    std::fill(constant_values.begin() + 2 * block_size, constant_values.end(), -3.0e-7);
+
+    const CompressedVector compressed(constant_values, block_size, 1.0e-6);
+    std::vector<double> decompressed;
+    compressed.Decompress(decompressed);
+    LogResult("constant blocks",
+              BitwiseEqual(constant_values, decompressed) and
+                compressed.CompressedDataSize() == 0);
+  }
+
+  // Every block spans [-1, 1], so each value needs ceil(log2(1/tolerance + 1))
+  // = 14 bits and blocks of 5 values straddle 64-bit word boundaries
+  {
+    const size_t straddle_block_size = 5;
+    const double tolerance = 1.0e-4;
+    std::vector<double> straddle_values;
+    for (size_t b = 0; b < 4; ++b)
+    {
+      straddle_values.insert(straddle_values.end(), {-1.0, 1.0});
+      for (size_t i = 2; i < straddle_block_size; ++i)
+        straddle_values.push_back(distribution(generator));
+    }
+
+    const CompressedVector compressed(straddle_values, straddle_block_size, tolerance);
+    std::vector<double> decompressed;
+    compressed.Decompress(decompressed);
+
+    // 4 blocks x 5 values x 14 bits = 280 bits in 5 words
+    LogResult("word boundaries",
+              WithinErrorBound(straddle_values, decompressed, straddle_block_size, tolerance) and
+                compressed.CompressedDataSize() == 5 * sizeof(uint64_t));
+  }
+
+  // Spilled data matches the in-memory data and only the headers stay in memory
+  {
+    const double tolerance = 1.0e-6;
+    const CompressedVector in_memory(values, block_size, tolerance);
+    const CompressedVector spilled(values,
+                                   block_size,
+                                   tolerance,
+                                   "data_types_test_01_" + std::to_string(opensn::mpi_comm.rank()) +
+                                     ".spill");
+
+    std::vector<double> in_memory_values, spilled_values;
+    in_memory.Decompress(in_memory_values);
+    spilled.Decompress(spilled_values);
+
+    // Read backwards so the reader has to move to the previous block
+    bool reader_passed = true;
+    CompressedVector::Reader reader(spilled);
+    for (size_t i = values.size(); i-- > 0;)
+      reader_passed = reader_passed and reader[i] == in_memory_values[i];
+
+    LogResult("spilled",
+              spilled.IsSpilled() and BitwiseEqual(in_memory_values, spilled_values) and
+                reader_passed and spilled.CompressedDataSize() == in_memory.CompressedDataSize() and
+                spilled.ComputeMemoryUsage() < in_memory.ComputeMemoryUsage());
+  }
+
+  // Block offsets are stored relative to chunks of blocks. Lossless blocks this
+  // large give chunks of 2 blocks, so 5 blocks span 3 chunks.
+  {
+    const size_t large_block_size = 200000;
+    std::vector<double> large_values(5 * large_block_size);
+    for (auto& value : large_values)
+      value = distribution(generator);
+
+    const CompressedVector compressed(large_values, large_block_size, 0.0);
+    std::vector<double> decompressed;
+    compressed.Decompress(decompressed);
+
+    bool reader_passed = true;
+    CompressedVector::Reader reader(compressed);
+    for (size_t i = large_values.size(); i-- > 0;)
+      reader_passed = reader_passed and reader[i] == large_values[i];
+
+    LogResult("chunks", BitwiseEqual(large_values, decompressed) and reader_passed);
+  }
+
+  // Angular fluxes with one block per node, holding 8 angles of 1 and 8 groups
+  // whose magnitudes decrease by group. Everything, headers included, must take
+  // less memory than the raw values, in memory and on disk.
+  {
+    const size_t num_angles = 8;
+    const size_t num_nodes = 500;
+    const double tolerance = 1.0e-6;
+    bool passed = true;
+    for (const size_t num_groups : {1, 8})
+    {
+      const size_t node_block_size = num_angles * num_groups;
+      std::vector<double> psi(num_nodes * node_block_size);
+      for (size_t i = 0; i < psi.size(); ++i)
+        psi[i] = std::ldexp(1.0 + 0.5 * distribution(generator),
+                            -static_cast<int>(i % num_groups));
+      const size_t raw_size = psi.size() * sizeof(double);
+
+      const CompressedVector in_memory(psi, node_block_size, tolerance);
+      const CompressedVector spilled(psi,
+                                     node_block_size,
+                                     tolerance,
+                                     "data_types_test_01_psi_" +
+                                       std::to_string(opensn::mpi_comm.rank()) + ".spill");
+
+      std::vector<double> decompressed;
+      in_memory.Decompress(decompressed);
+      passed = passed and WithinErrorBound(psi, decompressed, node_block_size, tolerance) and
+               in_memory.ComputeMemoryUsage() < raw_size and
+               spilled.ComputeMemoryUsage() + spilled.CompressedDataSize() < raw_size;
+    }
+    LogResult("memory below raw", passed);
+  }
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
@@ -0,0 +1 @@
+unit_tests.data_types_Test01()
@@ -0,0 +1,64 @@
+#include "lua/framework/console/console.h"
+#include "framework/graphs/sweep_graph_partitioner.h"
+#include "framework/object_factory.h"
+
+#include "framework/mesh/mesh.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock TestSweepGraphPartitioner00(const InputParameters&);
+
+RegisterWrapperFunctionNamespace(unit_tests,
+                                 TestSweepGraphPartitioner00,
+                                 nullptr,
+                                 TestSweepGraphPartitioner00);
+
+ParameterBlock
+TestSweepGraphPartitioner00(const InputParameters&)
+{
+  opensn::log.Log() << "GOLD_BEGIN";
+
+  InputParameters valid_parameters = SweepGraphPartitioner::GetInputParameters();
+  valid_parameters.AssignParameters(ParameterBlock());
+
+  SweepGraphPartitioner partitioner(valid_parameters);
+
+  // 4x4 planar grid with uniform weights, 4 parts
+  {
+    std::vector<std::vector<uint64_t>> dummy_graph(16);
+    std::vector<Vector3> centroids;
+    for (const double y : {-1.5, -0.5, 0.5, 1.5})
+      for (const double x : {-1.5, -0.5, 0.5, 1.5})
+        centroids.emplace_back(x, y, 0.0);
+
+    auto cell_pids = partitioner.Partition(dummy_graph, centroids, 4);
+
+    for (const int64_t pid : cell_pids)
+      opensn::log.Log() << pid;
+  }
+
+  // Row of 4 cells with a heavy first cell, 2 parts
+  {
+    std::vector<std::vector<uint64_t>> dummy_graph(4);
+    std::vector<Vector3> centroids = {
+      {0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {2.0, 0.0, 0.0}, {3.0, 0.0, 0.0}};
+    std::vector<double> weights = {3.0, 1.0, 1.0, 1.0};
+
+    auto cell_pids = partitioner.PartitionWeighted(dummy_graph, centroids, weights, 2);
+
+    for (const int64_t pid : cell_pids)
+      opensn::log.Log() << pid;
+  }
+
+  opensn::log.Log() << "GOLD_END";
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
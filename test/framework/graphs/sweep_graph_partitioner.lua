@@ -0,0 +1 @@
+unit_tests.TestSweepGraphPartitioner00()
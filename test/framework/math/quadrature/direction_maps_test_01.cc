@@ -0,0 +1,224 @@
+#include "framework/math/quadratures/angular_product_quadrature.h"
+#include "framework/math/quadratures/sldfesq/sldfe_sq.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include "lua/framework/console/console.h"
+
+#include <array>
+#include <cmath>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock math_DirectionMaps_Test01(const InputParameters& params);
+
+RegisterWrapperFunctionNamespace(unit_tests,
+                                 math_DirectionMaps_Test01,
+                                 nullptr,
+                                 math_DirectionMaps_Test01);
+
+namespace
+{
+
+/**Returns the index of the direction closest to `omega` within the direction
+ * tolerance, found by testing every direction, or -1.*/
+int
+BruteForceFind(const AngularQuadrature& quadrature, const Vector3& omega)
+{
+  int closest = -1;
+  double closest_distance = AngularQuadrature::DIRECTION_TOLERANCE;
+  for (size_t n = 0; n < quadrature.omegas_.size(); ++n)
+  {
+    const double distance = (quadrature.omegas_[n] - omega).Norm();
+    if (distance < closest_distance)
+    {
+      closest = static_cast<int>(n);
+      closest_distance = distance;
+    }
+  }
+  return closest;
+}
+
+/**Returns true if every direction, with and without a perturbation smaller
+ * than the tolerance, is found, and if directions perturbed by more than the
+ * tolerance are found only when testing every direction finds them.*/
+bool
+CheckFindDirection(const AngularQuadrature& quadrature)
+{
+  const double tolerance = AngularQuadrature::DIRECTION_TOLERANCE;
+  bool passed = true;
+  for (size_t n = 0; n < quadrature.omegas_.size(); ++n)
+  {
+    const auto& omega = quadrature.omegas_[n];
+    const int index = static_cast<int>(n);
+    const Vector3 near = omega + Vector3(0.3, -0.3, 0.3) * tolerance;
+    const Vector3 far = omega + Vector3(2.0, -2.0, 2.0) * tolerance;
+    passed = passed and quadrature.FindDirection(omega) == index and
+             quadrature.FindDirection(near) == index and
+             quadrature.FindDirection(far) == BruteForceFind(quadrature, far) and
+             quadrature.FindDirection(far) != index;
+  }
+  return passed;
+}
+
+/**Returns true if the direction map has an entry for every direction and
+ * agrees with testing every direction for each transformed direction.*/
+template <typename Transform>
+bool
+MatchesBruteForce(const AngularQuadrature& quadrature,
+                  const std::vector<int>& direction_map,
+                  const Transform& transform)
+{
+  if (direction_map.size() != quadrature.omegas_.size())
+    return false;
+  for (size_t n = 0; n < quadrature.omegas_.size(); ++n)
+    if (direction_map[n] != BruteForceFind(quadrature, transform(quadrature.omegas_[n])))
+      return false;
+  return true;
+}
+
+/**Returns the number of directions that are mapped to another direction.*/
+size_t
+NumMapped(const std::vector<int>& direction_map)
+{
+  size_t num_mapped = 0;
+  for (const int n : direction_map)
+    if (n >= 0)
+      ++num_mapped;
+  return num_mapped;
+}
+
+/**Checks the opposing direction maps of problems of 1, 2 and 3 dimensions.
+ * `num_opposing` holds the expected number of mapped directions for each.*/
+bool
+CheckOpposingDirectionMaps(const AngularQuadrature& quadrature,
+                           const std::array<size_t, 3>& num_opposing)
+{
+  bool passed = true;
+  for (int dimension = 1; dimension <= 3; ++dimension)
+  {
+    const auto& direction_map = quadrature.GetOpposingDirectionMap(dimension);
+    passed = passed and NumMapped(direction_map) == num_opposing[dimension - 1] and
+             MatchesBruteForce(quadrature,
+                               direction_map,
+                               [dimension](const Vector3& omega)
+                               {
+                                 if (dimension == 1)
+                                   return Vector3(omega.x, omega.y, -omega.z);
+                                 if (dimension == 2)
+                                   return Vector3(-omega.x, -omega.y, omega.z);
+                                 return -1.0 * omega;
+                               });
+  }
+  return passed;
+}
+
+/**Checks the reflected direction maps for the axis normals, with the expected
+ * number of mapped directions for each axis in `num_reflected`, and a normal
+ * off the axes. The reference returned for the first normal must stay valid
+ * while maps for the other normals are added.*/
+bool
+CheckReflectedDirectionMaps(const AngularQuadrature& quadrature,
+                            const std::array<size_t, 3>& num_reflected)
+{
+  const std::vector<Vector3> normals = {Vector3(1.0, 0.0, 0.0),
+                                        Vector3(0.0, 1.0, 0.0),
+                                        Vector3(0.0, 0.0, 1.0),
+                                        Vector3(-1.0, 0.0, 0.0),
+                                        Vector3(0.0, -1.0, 0.0),
+                                        Vector3(0.0, 0.0, -1.0),
+                                        Vector3(1.0, 1.0, 0.0).Normalized(),
+                                        Vector3(1.0, -2.0, 0.5).Normalized()};
+
+  const auto& first_map = quadrature.GetReflectedDirectionMap(normals.front());
+  const auto first_map_copy = first_map;
+
+  bool passed = true;
+  for (size_t i = 0; i < normals.size(); ++i)
+  {
+    const auto& normal = normals[i];
+    const auto& direction_map = quadrature.GetReflectedDirectionMap(normal);
+    passed = passed and MatchesBruteForce(quadrature,
+                                          direction_map,
+                                          [&normal](const Vector3& omega)
+                                          { return omega - 2.0 * normal * omega.Dot(normal); });
+    if (i < 6)
+      passed = passed and NumMapped(direction_map) == num_reflected[i % 3];
+  }
+
+  return passed and &quadrature.GetReflectedDirectionMap(normals.front()) == &first_map and
+         first_map == first_map_copy;
+}
+
+void
+LogResult(const std::string& name, const bool passed)
+{
+  opensn::log.Log() << "DirectionMaps " << name << " ... " << (passed ? "Passed" : "Failed");
+}
+
+} // namespace
+
+ParameterBlock
+math_DirectionMaps_Test01(const InputParameters&)
+{
+  // Product quadrature. Every direction has its opposite and its reflections
+  // about the axis planes.
+  {
+    const AngularQuadratureProdGLC quadrature(8, 4);
+    const size_t num_dirs = quadrature.omegas_.size();
+    LogResult("product find", CheckFindDirection(quadrature));
+    LogResult("product opposing",
+              CheckOpposingDirectionMaps(quadrature, {num_dirs, num_dirs, num_dirs}));
+    LogResult("product reflected",
+              CheckReflectedDirectionMaps(quadrature, {num_dirs, num_dirs, num_dirs}));
+  }
+
+  // Product quadrature optimized for polar symmetry, as used in 2D. Only the
+  // upper hemisphere is left, so only directions with opposite x and y
+  // components, or reflections about the x and y planes, are in the quadrature.
+  {
+    AngularQuadratureProdGLC quadrature(8, 4);
+    quadrature.OptimizeForPolarSymmetry(4.0 * M_PI);
+    const size_t num_dirs = quadrature.omegas_.size();
+    LogResult("polar symmetric find", CheckFindDirection(quadrature));
+    LogResult("polar symmetric opposing",
+              CheckOpposingDirectionMaps(quadrature, {0, num_dirs, 0}));
+    LogResult("polar symmetric reflected",
+              CheckReflectedDirectionMaps(quadrature, {num_dirs, num_dirs, 0}));
+  }
+
+  // SLDFESQ quadrature, before and after a local refinement that rebuilds the
+  // directions. The maps computed before the refinement must not be reused.
+  {
+    SimplifiedLDFESQ::Quadrature quadrature;
+    quadrature.GenerateInitialRefinement(1);
+    const size_t num_dirs = quadrature.omegas_.size();
+    LogResult("SLDFESQ find", CheckFindDirection(quadrature));
+    LogResult("SLDFESQ opposing",
+              CheckOpposingDirectionMaps(quadrature, {num_dirs, num_dirs, num_dirs}));
+    LogResult("SLDFESQ reflected",
+              CheckReflectedDirectionMaps(quadrature, {num_dirs, num_dirs, num_dirs}));
+
+    // Refining around a direction in the first octant removes the symmetry of
+    // the refined directions, so only the direction counts are compared
+    quadrature.LocallyRefine(Vector3(0.25, 0.5, 1.0), 30.0 * M_PI / 180.0);
+    const Vector3 normal(1.0, 0.0, 0.0);
+    LogResult("SLDFESQ refined",
+              quadrature.omegas_.size() > num_dirs and CheckFindDirection(quadrature) and
+                MatchesBruteForce(quadrature,
+                                  quadrature.GetOpposingDirectionMap(3),
+                                  [](const Vector3& omega) { return -1.0 * omega; }) and
+                MatchesBruteForce(quadrature,
+                                  quadrature.GetReflectedDirectionMap(normal),
+                                  [&normal](const Vector3& omega)
+                                  { return omega - 2.0 * normal * omega.Dot(normal); }));
+  }
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
@@ -0,0 +1 @@
+unit_tests.math_DirectionMaps_Test01()
@@ -0,0 +1,7 @@
+-- Point location on a 2D orthogonal grid with non-uniform cells shorter than unity
+nodes = { 0.0, 0.1, 0.25, 0.3, 0.5, 0.65, 0.8, 0.95, 1.0 }
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes, nodes } })
+mesh.MeshGenerator.Execute(meshgen1)
+
+unit_tests.mesh_PointLocation_Test01()
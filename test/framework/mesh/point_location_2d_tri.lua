@@ -0,0 +1,7 @@
+-- Point location on a 2D unstructured triangle grid
+meshgen1 = mesh.FromFileMeshGenerator.Create({
+  filename = "../../../resources/TestMeshes/TriangleMesh2x2.obj",
+})
+mesh.MeshGenerator.Execute(meshgen1)
+
+unit_tests.mesh_PointLocation_Test01()
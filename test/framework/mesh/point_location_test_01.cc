@@ -0,0 +1,147 @@
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh_continuum/cell_spatial_index.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include "lua/framework/console/console.h"
+
+#include <random>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock mesh_PointLocation_Test01(const InputParameters& params);
+
+RegisterWrapperFunctionNamespace(unit_tests,
+                                 mesh_PointLocation_Test01,
+                                 nullptr,
+                                 mesh_PointLocation_Test01);
+
+namespace
+{
+
+/**Returns the local-ids of all local cells that contain the point, found by
+ * testing every local cell.*/
+std::vector<uint64_t>
+BruteForceLocate(const MeshContinuum& grid, const Vector3& point)
+{
+  std::vector<uint64_t> local_ids;
+  for (const auto& cell : grid.local_cells)
+    if (grid.CheckPointInsideCell(cell, point))
+      local_ids.push_back(cell.local_id_);
+  return local_ids;
+}
+
+void
+LogResult(const std::string& name, const bool passed)
+{
+  opensn::log.Log() << "PointLocation " << name << " ... " << (passed ? "Passed" : "Failed");
+}
+
+} // namespace
+
+ParameterBlock
+mesh_PointLocation_Test01(const InputParameters&)
+{
+  const auto& grid = *GetCurrentMesh();
+  OpenSnLogicalErrorIf(opensn::mpi_comm.size() != 1,
+                       "mesh_PointLocation_Test01 must be run on a single process.");
+
+  const bool orthogonal = grid.Attributes() & MeshAttributes::ORTHOGONAL;
+
+  std::mt19937 generator(20241019);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  // Points strictly inside each cell, as random convex combinations dominated
+  // by the cell centroid. Exactly one cell contains each point, and the walk
+  // from the cell of the previous point must not end anywhere else.
+  {
+    bool index_passed = true;
+    bool walk_passed = true;
+    uint64_t previous_local_id = 0;
+    for (const auto& cell : grid.local_cells)
+    {
+      const double max_weight = 0.5 / static_cast<double>(cell.vertex_ids_.size());
+      for (int k = 0; k < 2; ++k)
+      {
+        auto point = cell.centroid_;
+        for (const uint64_t vid : cell.vertex_ids_)
+          point += (grid.vertices[vid] - cell.centroid_) * max_weight * distribution(generator);
+
+        const std::vector<uint64_t> expected = {cell.local_id_};
+        index_passed = index_passed and BruteForceLocate(grid, point) == expected and
+                       grid.FindLocalCellsContainingPoint(point) == expected;
+
+        uint64_t local_id = 0;
+        const bool found = grid.LocateLocalCellByNeighborWalk(previous_local_id, point, local_id);
+        walk_passed = walk_passed and (found or not orthogonal) and
+                      (not found or local_id == cell.local_id_);
+      }
+      previous_local_id = cell.local_id_;
+    }
+    LogResult("interior points", index_passed);
+    LogResult("interior walk", walk_passed);
+  }
+
+  // Points on interior faces. The index must agree with testing every cell.
+  // Slabs own one of their end points and polygons contain their edges, so
+  // these points are in at least one cell. Polyhedra exclude their faces. The
+  // walk must never report a face point as strictly inside a cell.
+  {
+    bool passed = true;
+    for (const auto& cell : grid.local_cells)
+      for (const auto& face : cell.faces_)
+      {
+        if (not face.has_neighbor_)
+          continue;
+        const auto& vertex = grid.vertices[face.vertex_ids_.front()];
+        for (const double w : {0.0, 0.5})
+        {
+          const auto point = face.centroid_ + (vertex - face.centroid_) * w;
+          const auto local_ids = grid.FindLocalCellsContainingPoint(point);
+          passed = passed and local_ids == BruteForceLocate(grid, point);
+          if (cell.Type() != CellType::POLYHEDRON)
+            passed = passed and not local_ids.empty() and local_ids.size() <= 2;
+
+          uint64_t local_id = 0;
+          passed =
+            passed and not grid.LocateLocalCellByNeighborWalk(cell.local_id_, point, local_id);
+        }
+      }
+    LogResult("face points", passed);
+  }
+
+  // Points outside the domain, mirrored through boundary faces and far away.
+  // For slabs shorter than unity this exercises the squared length in the
+  // slab test.
+  {
+    std::vector<Vector3> points = {Vector3(1.0e3, 1.0e3, 1.0e3), Vector3(-1.0e3, -1.0e3, -1.0e3)};
+    std::vector<uint64_t> start_local_ids = {0, 0};
+    for (const auto& cell : grid.local_cells)
+      for (const auto& face : cell.faces_)
+        if (not face.has_neighbor_)
+        {
+          points.push_back(face.centroid_ + (face.centroid_ - cell.centroid_));
+          start_local_ids.push_back(cell.local_id_);
+        }
+
+    bool passed = true;
+    for (size_t p = 0; p < points.size(); ++p)
+    {
+      uint64_t local_id = 0;
+      passed = passed and BruteForceLocate(grid, points[p]).empty() and
+               grid.FindLocalCellsContainingPoint(points[p]).empty() and
+               not grid.LocateLocalCellByNeighborWalk(start_local_ids[p], points[p], local_id);
+    }
+    LogResult("outside points", passed);
+  }
+
+  LogResult("index size", grid.GetCellSpatialIndex().NumCells() == grid.local_cells.size());
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
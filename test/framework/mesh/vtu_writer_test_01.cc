@@ -0,0 +1,190 @@
+#include "framework/mesh/mesh_continuum/mesh_continuum.h"
+#include "framework/mesh/mesh_continuum/grid_vtu_writer.h"
+#include "framework/mesh/mesh_continuum/grid_vtk_utils.h"
+
+#include "framework/runtime.h"
+#include "framework/logging/log.h"
+
+#include "lua/framework/console/console.h"
+
+#include <vtkCellData.h>
+#include <vtkCellType.h>
+#include <vtkDoubleArray.h>
+#include <vtkIdList.h>
+#include <vtkPointData.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridReader.h>
+
+using namespace opensn;
+
+namespace unit_tests
+{
+
+ParameterBlock mesh_VTUWriter_Test01(const InputParameters& params);
+
+RegisterWrapperFunctionNamespace(unit_tests,
+                                 mesh_VTUWriter_Test01,
+                                 nullptr,
+                                 mesh_VTUWriter_Test01);
+
+namespace
+{
+
+vtkSmartPointer<vtkUnstructuredGrid>
+ReadVTU(const std::string& file_base_name)
+{
+  const std::string file_name =
+    file_base_name + "_" + std::to_string(opensn::mpi_comm.rank()) + ".vtu";
+
+  vtkNew<vtkXMLUnstructuredGridReader> reader;
+  reader->SetFileName(file_name.c_str());
+  reader->Update();
+  return reader->GetOutput();
+}
+
+bool
+SamePoints(vtkUnstructuredGrid& a, vtkUnstructuredGrid& b)
+{
+  if (a.GetNumberOfPoints() != b.GetNumberOfPoints())
+    return false;
+  for (vtkIdType i = 0; i < a.GetNumberOfPoints(); ++i)
+  {
+    double xyz_a[3], xyz_b[3];
+    a.GetPoint(i, xyz_a);
+    b.GetPoint(i, xyz_b);
+    if (xyz_a[0] != xyz_b[0] or xyz_a[1] != xyz_b[1] or xyz_a[2] != xyz_b[2])
+      return false;
+  }
+  return true;
+}
+
+bool
+SameIds(vtkIdList& a, vtkIdList& b)
+{
+  if (a.GetNumberOfIds() != b.GetNumberOfIds())
+    return false;
+  for (vtkIdType i = 0; i < a.GetNumberOfIds(); ++i)
+    if (a.GetId(i) != b.GetId(i))
+      return false;
+  return true;
+}
+
+/**Compares cell types, connectivity and, for general polyhedra, face streams.*/
+bool
+SameCells(vtkUnstructuredGrid& a, vtkUnstructuredGrid& b)
+{
+  if (a.GetNumberOfCells() != b.GetNumberOfCells())
+    return false;
+  vtkNew<vtkIdList> ids_a, ids_b;
+  for (vtkIdType c = 0; c < a.GetNumberOfCells(); ++c)
+  {
+    if (a.GetCellType(c) != b.GetCellType(c))
+      return false;
+
+    a.GetCellPoints(c, ids_a);
+    b.GetCellPoints(c, ids_b);
+    if (not SameIds(*ids_a, *ids_b))
+      return false;
+
+    if (a.GetCellType(c) == VTK_POLYHEDRON)
+    {
+      a.GetFaceStream(c, ids_a);
+      b.GetFaceStream(c, ids_b);
+      if (not SameIds(*ids_a, *ids_b))
+        return false;
+    }
+  }
+  return true;
+}
+
+/**Compares the named arrays value by value.*/
+bool
+SameArrays(vtkFieldData& a, vtkFieldData& b, const std::vector<std::string>& names)
+{
+  for (const auto& name : names)
+  {
+    auto array_a = a.GetArray(name.c_str());
+    auto array_b = b.GetArray(name.c_str());
+    if (array_a == nullptr or array_b == nullptr or
+        array_a->GetNumberOfTuples() != array_b->GetNumberOfTuples() or
+        array_a->GetNumberOfComponents() != 1 or array_b->GetNumberOfComponents() != 1)
+      return false;
+    for (vtkIdType i = 0; i < array_a->GetNumberOfTuples(); ++i)
+      if (array_a->GetTuple1(i) != array_b->GetTuple1(i))
+        return false;
+  }
+  return true;
+}
+
+void
+LogResult(const std::string& name, const bool local_passed)
+{
+  int passed = local_passed ? 1 : 0;
+  int global_passed = 0;
+  opensn::mpi_comm.all_reduce(passed, global_passed, mpi::op::min<int>());
+  opensn::log.Log() << "VTUWriter " << name << " ... " << (global_passed ? "Passed" : "Failed");
+}
+
+} // namespace
+
+ParameterBlock
+mesh_VTUWriter_Test01(const InputParameters&)
+{
+  const auto& grid = *GetCurrentMesh();
+  const auto& geometry = grid.GetVTUGeometry();
+
+  // Fields that differ per point and per cell
+  std::vector<VTUDataArray> point_data = {{"PointField", {}}};
+  std::vector<VTUDataArray> cell_data = {{"CellField", {}}};
+  for (const auto& cell : grid.local_cells)
+  {
+    for (const uint64_t vid : cell.vertex_ids_)
+    {
+      const auto& vertex = grid.vertices[vid];
+      point_data[0].values.push_back(vertex.x + 2.0 * vertex.y + 3.0 * vertex.z);
+    }
+    cell_data[0].values.push_back(cell.centroid_.x - cell.centroid_.y +
+                                  static_cast<double>(cell.global_id_));
+  }
+
+  WriteVTUFiles("vtu_writer_test_01_new", geometry, point_data, cell_data);
+
+  // Reference output of the VTK-based writer
+  auto AddArrays = [](const std::vector<VTUDataArray>& arrays, vtkFieldData* field_data)
+  {
+    for (const auto& array : arrays)
+    {
+      vtkNew<vtkDoubleArray> vtk_array;
+      vtk_array->SetName(array.name.c_str());
+      for (const double value : array.values)
+        vtk_array->InsertNextValue(value);
+      field_data->AddArray(vtk_array);
+    }
+  };
+  auto ugrid = PrepareVtkUnstructuredGrid(grid);
+  AddArrays(point_data, ugrid->GetPointData());
+  AddArrays(cell_data, ugrid->GetCellData());
+  WritePVTUFiles(ugrid, "vtu_writer_test_01_old");
+  opensn::mpi_comm.barrier();
+
+  auto new_grid = ReadVTU("vtu_writer_test_01_new");
+  auto old_grid = ReadVTU("vtu_writer_test_01_old");
+
+  LogResult("points",
+            new_grid->GetNumberOfPoints() == static_cast<vtkIdType>(geometry.NumPoints()) and
+              SamePoints(*new_grid, *old_grid));
+  LogResult("cells",
+            new_grid->GetNumberOfCells() == static_cast<vtkIdType>(geometry.NumCells()) and
+              SameCells(*new_grid, *old_grid));
+  LogResult("cell data",
+            SameArrays(*new_grid->GetCellData(),
+                       *old_grid->GetCellData(),
+                       {"Material", "Partition", "CellField"}));
+  LogResult("point data",
+            SameArrays(*new_grid->GetPointData(), *old_grid->GetPointData(), {"PointField"}));
+
+  return ParameterBlock();
+}
+
+} //  namespace unit_tests
@@ -0,0 +1,7 @@
+-- VTU export of a 2D grid of triangles, quadrilaterals and general polygons
+meshgen1 = mesh.FromFileMeshGenerator.Create({
+  filename = "../../../resources/TestMeshes/QuadMeshPolyMix.obj",
+})
+mesh.MeshGenerator.Execute(meshgen1)
+
+unit_tests.mesh_VTUWriter_Test01()
@@ -0,0 +1,12 @@
+-- VTU export of a 3D grid of wedges, hexahedra and general polyhedra
+meshgen1 = mesh.ExtruderMeshGenerator.Create({
+  inputs = {
+    mesh.FromFileMeshGenerator.Create({
+      filename = "../../../resources/TestMeshes/QuadMeshPolyMix.obj",
+    }),
+  },
+  layers = { { z = 0.5, n = 2 } },
+})
+mesh.MeshGenerator.Execute(meshgen1)
+
+unit_tests.mesh_VTUWriter_Test01()
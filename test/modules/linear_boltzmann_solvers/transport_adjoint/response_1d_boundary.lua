@@ -0,0 +1,126 @@
+-- 1D transport response evaluation test with a boundary source
+-- A unit isotropic angular flux enters a pure absorber with unit length and a
+-- unit absorption cross section at zmin. The absorption rate is the incoming
+-- current minus the leakage:
+-- 1/2 - \int_{0}^{1} \mu e^{-1/\mu} d\mu = 0.5 - 0.10969 = 0.39031
+-- The adjoint response of the boundary source uses the adjoint angular fluxes,
+-- which are stored with `angular_flux_storage` in the solver and in the buffer.
+-- Test: QoI Value=3.90308e-01
+--       Inner Product=3.90308e-01
+--       Response Rel-diff=0
+num_procs = 2
+
+-- Check num_procs
+if (check_num_procs == nil and number_of_processes ~= num_procs) then
+    Log(LOG_0ERROR, "Incorrect amount of processors. " ..
+            "Expected " .. tostring(num_procs) ..
+            ". Pass check_num_procs=false to override if possible.")
+    os.exit(false)
+end
+
+if (angular_flux_storage == nil) then angular_flux_storage = "dense" end
+
+-- Create mesh
+N = 100
+L = 1.0
+nodes = {}
+for i = 1, (N + 1) do
+    nodes[i] = (i - 1) * L / N
+end
+
+meshgen = mesh.OrthogonalMeshGenerator.Create({ node_sets = { nodes } })
+mesh.MeshGenerator.Execute(meshgen)
+mesh.SetUniformMaterialID(0)
+
+-- Create materials
+num_groups = 1
+materials = {}
+materials[1] = PhysicsAddMaterial("Test Material");
+PhysicsMaterialAddProperty(materials[1], TRANSPORT_XSECTIONS)
+PhysicsMaterialSetProperty(materials[1], TRANSPORT_XSECTIONS,
+        SIMPLEXS0, num_groups, 1.0)
+
+-- Setup physics
+pquad = CreateProductQuadrature(GAUSS_LEGENDRE, 128)
+
+lbs_block = {
+    num_groups = num_groups,
+    groupsets = {
+        {
+            groups_from_to = { 0, num_groups - 1 },
+            angular_quadrature_handle = pquad,
+            inner_linear_method = "gmres",
+            l_abs_tol = 1.0e-8,
+            l_max_its = 300,
+            gmres_restart_interval = 100,
+        },
+    },
+}
+
+-- Forward solve. With no scattering the absorption rate is the incoming
+-- current, which the Gauss-Legendre quadrature integrates exactly, minus the
+-- leakage.
+bsrc = { { name = "zmin", type = "isotropic", group_strength = { 1.0 } } }
+lbs_block.name = "response_1d_boundary_fwd"
+phys_fwd = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys_fwd, {
+    boundary_conditions = bsrc,
+    scattering_order = 0,
+    save_angular_flux = true,
+    angular_flux_storage = angular_flux_storage
+})
+
+ss_solver_fwd = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys_fwd })
+SolverInitialize(ss_solver_fwd)
+SolverExecute(ss_solver_fwd)
+
+leakage = lbs.ComputeLeakage(phys_fwd, { "zmax" })
+fwd_qoi = 0.5 - leakage["zmax"][1]
+
+-- Adjoint solve with a unit adjoint source everywhere and vacuum boundaries.
+-- A separate solver is used because boundary conditions are fixed at
+-- initialization. Distinct solver names give distinct spill files.
+qoi_vol = mesh.RPPLogicalVolume.Create({ infx = true, infy = true, infz = true })
+adjoint_source = lbs.DistributedSource.Create({ logical_volume_handle = qoi_vol })
+
+lbs_block.name = "response_1d_boundary_adj"
+phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys, {
+    adjoint = true,
+    distributed_sources = { adjoint_source },
+    scattering_order = 0,
+    save_angular_flux = true,
+    angular_flux_storage = angular_flux_storage
+})
+
+ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
+SolverInitialize(ss_solver)
+SolverExecute(ss_solver)
+LBSWriteAngularFluxes(phys, "response_1d_boundary_" .. angular_flux_storage)
+
+-- Evaluate the response to the forward boundary source
+response_options = {
+    lbs_solver_handle = phys,
+    options = {
+        buffers = {
+            {
+                name = "buff",
+                file_prefixes = { angular_fluxes = "response_1d_boundary_" .. angular_flux_storage }
+            }
+        },
+        sources = { boundary = bsrc }
+    }
+}
+evaluator = lbs.ResponseEvaluator.Create(response_options)
+adj_qoi = lbs.EvaluateResponse(evaluator, "buff")
+
+-- Print results
+Log(LOG_0, string.format("QoI Value=%.5e", fwd_qoi))
+Log(LOG_0, string.format("Inner Product=%.5e", adj_qoi))
+Log(LOG_0, string.format("Response Rel-diff=%.5e", math.abs(adj_qoi - fwd_qoi) / fwd_qoi))
+
+-- Cleanup
+MPIBarrier()
+if (location_id == 0) then
+    os.execute("rm response_1d_boundary_" .. angular_flux_storage .. "*")
+end
@@ -1,7 +1,13 @@
 -- 2D Transport test with localized material source
 -- SDM: PWLD
+-- The batched responses are checked against the forward QoI, including a
+-- source set with a boundary source whose response uses the adjoint angular
+-- fluxes stored with `angular_flux_storage`, and against exact doubling.
 -- Test: QoI Value=1.38399e-05
 --       Inner Product=1.38405e-05
+--       Batched Response Rel-diff=5.8e-05
+--       Doubled Response Max-rel-diff=0
+--       Boundary Response Rel-diff=0 (within the solver tolerance)
 num_procs = 4
 
 -- Check num_procs
@@ -12,6 +18,8 @@ if (check_num_procs == nil and number_of_processes ~= num_procs) then
     os.exit(false)
 end
 
+if (angular_flux_storage == nil) then angular_flux_storage = "dense" end
+
 -- Create mesh
 N = 60
 L = 5.0
@@ -116,6 +124,10 @@ lbs_block = {
     options = { scattering_order = 0 }
 }
 phys = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys, {
+    save_angular_flux = true,
+    angular_flux_storage = angular_flux_storage
+})
 
 -- Forward solve
 ss_solver = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys })
@@ -147,6 +159,30 @@ FFInterpolationInitialize(ffi)
 FFInterpolationExecute(ffi)
 fwd_qoi = FFInterpolationGetValue(ffi)
 
+-- Forward solve with an additional isotropic boundary source. A separate
+-- solver is used because boundary conditions are fixed at initialization.
+bsrc = { { name = "xmin", type = "isotropic", group_strength = { 1.0 } } }
+lbs_block.name = "response_2d_1_bnd"
+phys_bnd = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys_bnd, {
+    boundary_conditions = bsrc,
+    field_function_prefix = "bnd"
+})
+
+ss_solver_bnd = lbs.SteadyStateSolver.Create({ lbs_solver_handle = phys_bnd })
+SolverInitialize(ss_solver_bnd)
+SolverExecute(ss_solver_bnd)
+
+ffi_bnd = FFInterpolationCreate(VOLUME)
+FFInterpolationSetProperty(ffi_bnd, OPERATION, OP_SUM)
+FFInterpolationSetProperty(ffi_bnd, LOGICAL_VOLUME, qoi_vol)
+FFInterpolationSetProperty(ffi_bnd, ADD_FIELDFUNCTION,
+        GetFieldFunctionHandleByName("bnd_phi_g000_m00"))
+
+FFInterpolationInitialize(ffi_bnd)
+FFInterpolationExecute(ffi_bnd)
+fwd_qoi_bnd = FFInterpolationGetValue(ffi_bnd)
+
 -- Create adjoint source
 adjoint_source = lbs.DistributedSource.Create(
         { logical_volume_handle = qoi_vol }
@@ -161,10 +197,20 @@ lbs.SetOptions(phys, adjoint_options)
 
 -- Adjoint solve, write results
 SolverExecute(ss_solver)
-LBSWriteFluxMoments(phys, "adjoint_2d_1")
+-- The adjoint angular fluxes go into a single shared file, which is much
+-- smaller than one file per location for this many angles. File names include
+-- the storage so that variants of this test do not share files.
+file_base = "adjoint_2d_1_" .. angular_flux_storage
+LBSWriteFluxMoments(phys, file_base)
+LBSWriteAngularFluxes(phys, file_base .. "_psi", true)
 
 -- Create response evaluator
-buffers = { { name = "buff", file_prefixes = { flux_moments = "adjoint_2d_1" } } }
+buffers = {
+    {
+        name = "buff",
+        file_prefixes = { flux_moments = file_base, angular_fluxes = file_base .. "_psi" }
+    }
+}
 mat_sources = { { material_id = 2, strength = src } }
 response_options = {
     lbs_solver_handle = phys,
@@ -178,12 +224,64 @@ evaluator = lbs.ResponseEvaluator.Create(response_options)
 -- Evaluate response
 adj_qoi = lbs.EvaluateResponse(evaluator, "buff")
 
+-- Second adjoint solve with a different QoI region
+qoi_vol_b = mesh.RPPLogicalVolume.Create(
+        {
+            xmin = 4.16666, xmax = 4.5,
+            ymin = 0.5, ymax = 0.8333,
+            infz = true
+        }
+)
+adjoint_source_b = lbs.DistributedSource.Create(
+        { logical_volume_handle = qoi_vol_b }
+)
+lbs.SetOptions(phys, {
+    clear_distributed_sources = true,
+    distributed_sources = { adjoint_source_b }
+})
+SolverExecute(ss_solver)
+LBSWriteFluxMoments(phys, file_base .. "_b")
+lbs.AddResponseBuffers(evaluator,
+        { { name = "buff_b", file_prefixes = { flux_moments = file_base .. "_b" } } })
+
+-- Batched responses. The first source set is the forward problem and doubling
+-- the source strengths doubles every product exactly, so the second set must
+-- give exactly twice the first.
+src_x2 = {}
+for g = 1, num_groups do
+    src_x2[g] = 2.0 * src[g]
+end
+source_sets = {
+    { material = mat_sources },
+    { material = { { material_id = 2, strength = src_x2 } } }
+}
+buffer_names = { "buff", "buff_b" }
+responses = lbs.EvaluateResponses(evaluator, buffer_names, source_sets)
+
+batched_rel_diff = math.abs(responses[1]["buff"] - fwd_qoi) / fwd_qoi
+doubled_rel_diff = 0.0
+for _, buffer in ipairs(buffer_names) do
+    rel_diff = math.abs(responses[2][buffer] - 2.0 * responses[1][buffer]) /
+            math.abs(2.0 * responses[1][buffer])
+    doubled_rel_diff = math.max(doubled_rel_diff, rel_diff)
+end
+
+-- The material and boundary sources of the second forward problem. Only
+-- "buff" holds adjoint angular fluxes.
+bnd_responses = lbs.EvaluateResponses(evaluator, { "buff" },
+        { { material = mat_sources, boundary = bsrc } })
+bnd_rel_diff = math.abs(bnd_responses[1]["buff"] - fwd_qoi_bnd) / fwd_qoi_bnd
+
 -- Print results
 Log(LOG_0, string.format("QoI Value=%.5e", fwd_qoi))
 Log(LOG_0, string.format("Inner Product=%.5e", adj_qoi))
+Log(LOG_0, string.format("Batched Response Rel-diff=%.5e", batched_rel_diff))
+Log(LOG_0, string.format("Doubled Response Max-rel-diff=%.5e", doubled_rel_diff))
+Log(LOG_0, string.format("Boundary QoI Value=%.5e", fwd_qoi_bnd))
+Log(LOG_0, string.format("Boundary Response Rel-diff=%.5e", bnd_rel_diff))
 
 -- Cleanup
 MPIBarrier()
 if (location_id == 0) then
-    os.execute("rm adjoint_2d_1*")
+    os.execute("rm " .. file_base .. "*")
 end
@@ -2,7 +2,10 @@
 -- SDM: PWLD
 -- Test: WGS groups [0-62] Iteration    28 Residual 6.74299e-07 CONVERGED
 -- and   WGS groups [63-167] Iteration    39 Residual 8.73816e-07 CONVERGED
+-- With matrix_free=true the DSA solves are matrix-free and the flux is compared
+-- with an assembled reference solve. Flux rel-diff should be below 1e-4.
 num_procs = 4
+if (matrix_free == nil) then matrix_free = false end
 
 
 
@@ -73,38 +76,46 @@ PhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
 pquad0 = CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
 --pquad1 = CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,8, 8,false)
 
-lbs_block =
-{
-  num_groups = num_groups,
-  groupsets =
+-- Returns the solver block with assembled or matrix-free DSA
+function MakeLBSBlock(mf)
+  return
   {
+    num_groups = num_groups,
+    groupsets =
     {
-      groups_from_to = {0, 62},
-      angular_quadrature_handle = pquad0,
-      angle_aggregation_num_subsets = 1,
-      groupset_num_subsets = 1,
-      inner_linear_method = "gmres",
-      l_abs_tol = 1.0e-6,
-      l_max_its = 1000,
-      gmres_restart_interval = 30,
-      apply_wgdsa = true,
-      wgdsa_l_abs_tol = 1.0e-2,
-    },
-    {
-      groups_from_to = {63, num_groups-1},
-      angular_quadrature_handle = pquad0,
-      angle_aggregation_num_subsets = 1,
-      groupset_num_subsets = 1,
-      inner_linear_method = "gmres",
-      l_abs_tol = 1.0e-6,
-      l_max_its = 1000,
-      gmres_restart_interval = 30,
-      apply_wgdsa = true,
-      apply_tgdsa = true,
-      wgdsa_l_abs_tol = 1.0e-2,
-    },
+      {
+        groups_from_to = {0, 62},
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-6,
+        l_max_its = 1000,
+        gmres_restart_interval = 30,
+        apply_wgdsa = true,
+        wgdsa_l_abs_tol = 1.0e-2,
+        wgdsa_matrix_free = mf,
+      },
+      {
+        groups_from_to = {63, num_groups-1},
+        angular_quadrature_handle = pquad0,
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = 1.0e-6,
+        l_max_its = 1000,
+        gmres_restart_interval = 30,
+        apply_wgdsa = true,
+        apply_tgdsa = true,
+        wgdsa_l_abs_tol = 1.0e-2,
+        wgdsa_matrix_free = mf,
+        tgdsa_matrix_free = mf,
+      },
+    }
   }
-}
+end
+
+lbs_block = MakeLBSBlock(matrix_free)
 
 lbs_options =
 {
@@ -115,6 +126,17 @@ phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
 lbs.SetOptions(phys1, lbs_options)
 
 --############################################### Initialize and Execute Solver
+-- The assembled reference is solved first so that the WGS iterations logged
+-- after "Matrix-free solve" are those of the matrix-free solver
+if (matrix_free) then
+  phys_ref = lbs.DiscreteOrdinatesSolver.Create(MakeLBSBlock(false))
+  lbs.SetOptions(phys_ref, lbs_options)
+  ss_solver_ref = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys_ref})
+  SolverInitialize(ss_solver_ref)
+  SolverExecute(ss_solver_ref)
+  Log(LOG_0,"Matrix-free solve")
+end
+
 ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
 
 SolverInitialize(ss_solver)
@@ -123,6 +145,35 @@ SolverExecute(ss_solver)
 --############################################### Get field functions
 fflist,count = LBSGetScalarFieldFunctionList(phys1)
 
+--############################################### Compare with the assembled reference
+-- Largest relative difference, over groups, of the maximum and of the integral
+-- of the scalar flux
+if (matrix_free) then
+  vol_all = mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+  function FFVolumeValue(ff, op)
+    local ffi = FFInterpolationCreate(VOLUME)
+    FFInterpolationSetProperty(ffi,OPERATION,op)
+    FFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol_all)
+    FFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,ff)
+    FFInterpolationInitialize(ffi)
+    FFInterpolationExecute(ffi)
+    return FFInterpolationGetValue(ffi)
+  end
+
+  fflist_ref,count_ref = LBSGetScalarFieldFunctionList(phys_ref)
+  max_rel_diff = 0.0
+  for g=1,num_groups do
+    for _,op in ipairs({OP_MAX, OP_SUM}) do
+      ref_value = FFVolumeValue(fflist_ref[g], op)
+      value = FFVolumeValue(fflist[g], op)
+      if (ref_value ~= 0.0) then
+        max_rel_diff = math.max(max_rel_diff, math.abs(value - ref_value) / math.abs(ref_value))
+      end
+    end
+  end
+  Log(LOG_0,string.format("Flux-max-rel-diff=%.5e", max_rel_diff))
+end
+
 --############################################### Exports
 if (master_export == nil) then
   ExportMultiFieldFunctionToVTK(fflist,"ZPhi")
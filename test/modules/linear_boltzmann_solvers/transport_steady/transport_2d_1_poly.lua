@@ -2,6 +2,8 @@
 -- SDM: PWLD
 -- Test: Max-value=0.50758 and 2.52527e-04
 num_procs = 4
+if (autotune == nil) then autotune = false end
+if (rebalance == nil) then rebalance = false end
 
 
 
@@ -85,6 +87,7 @@ lbs_block =
       l_abs_tol = 1.0e-6,
       l_max_its = 300,
       gmres_restart_interval = 100,
+      autotune_sweep_subsets = autotune,
     },
     {
       groups_from_to = {63, num_groups-1},
@@ -95,6 +98,7 @@ lbs_block =
       l_abs_tol = 1.0e-6,
       l_max_its = 300,
       gmres_restart_interval = 100,
+      autotune_sweep_subsets = autotune,
     },
   }
 }
@@ -126,6 +130,51 @@ ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
 SolverInitialize(ss_solver)
 SolverExecute(ss_solver)
 
+-- A zero threshold forces a repartition. The migrated solution must be the
+-- same before solving again, and solving again from it must take only a few
+-- sweeps compared to the first solve.
+if (rebalance) then
+  function MaxFlux()
+    local fflist,count = LBSGetScalarFieldFunctionList(phys1)
+    local ffi = FFInterpolationCreate(VOLUME)
+    FFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    FFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    FFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[1])
+    FFInterpolationInitialize(ffi)
+    FFInterpolationExecute(ffi)
+    return FFInterpolationGetValue(ffi)
+  end
+
+  function NumSweeps()
+    ExecutePostProcessors({"num_sweeps"})
+    return PostProcessorGetValue("num_sweeps")
+  end
+
+  lbs.SweepStatsPostProcessor.Create
+  ({
+    name = "num_sweeps",
+    lbs_solver_handle = phys1,
+    statistic = "num_sweeps",
+  })
+  num_sweeps_first = NumSweeps()
+  max_before = MaxFlux()
+
+  rebalanced, num_migrated = lbs.RebalanceLoad(phys1, 0.0)
+  max_after = MaxFlux()
+  num_sweeps_rebalanced = NumSweeps()
+
+  SolverExecute(ss_solver)
+  num_sweeps_second = NumSweeps() - num_sweeps_rebalanced
+
+  Log(LOG_0,"Rebalanced="..tostring(rebalanced))
+  Log(LOG_0,string.format("Migrated-cells=%d", num_migrated))
+  Log(LOG_0,"Cells-migrated="..tostring(num_migrated > 0))
+  Log(LOG_0,string.format("Rebalanced-max-value1-rel-diff=%.5e",
+    math.abs(max_after - max_before) / max_before))
+  Log(LOG_0,string.format("Second-solve-sweep-fraction=%.5f",
+    num_sweeps_second / num_sweeps_first))
+end
+
 --############################################### Get field functions
 fflist,count = LBSGetScalarFieldFunctionList(phys1)
 
@@ -0,0 +1,170 @@
+-- 2D Transport test with Vacuum and Incident-isotropic BC writing
+-- restart data asynchronously after every across-groupset iteration.
+-- SDM: PWLD
+-- Test: Max-value=0.50758 and 2.52527e-04
+num_procs = 4
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and number_of_processes ~= num_procs) then
+  Log(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+meshgen1 = mesh.MeshGenerator.Create
+({
+  inputs =
+  {
+    mesh.FromFileMeshGenerator.Create
+    ({
+      filename="../../../../resources/TestMeshes/SquareMesh2x2QuadsBlock.obj"
+    }),
+  },
+  partitioner = KBAGraphPartitioner.Create
+  ({
+    nx = 2, ny=2, nz=1,
+    xcuts = {0.0}, ycuts = {0.0},
+  })
+})
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+mesh.SetMaterialIDFromLogicalVolume(vol0,0)
+
+
+--############################################### Add materials
+materials = {}
+materials[1] = PhysicsAddMaterial("Test Material");
+materials[2] = PhysicsAddMaterial("Test Material2");
+
+PhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+PhysicsMaterialAddProperty(materials[2],TRANSPORT_XSECTIONS)
+
+PhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+PhysicsMaterialAddProperty(materials[2],ISOTROPIC_MG_SOURCE)
+
+
+num_groups = 168
+PhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  OPENSN_XSFILE,"xs_3_170.xs")
+PhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,
+  OPENSN_XSFILE,"xs_3_170.xs")
+
+--PhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,SIMPLEXS0,num_groups,0.1)
+--PhysicsMaterialSetProperty(materials[2],TRANSPORT_XSECTIONS,SIMPLEXS0,num_groups,0.1)
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+--src[1] = 1.0
+PhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+PhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 1)
+OptimizeAngularQuadratureForPolarSymmetry(pquad, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, 62},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 2,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+    {
+      groups_from_to = {63, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 2,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 300,
+      gmres_restart_interval = 100,
+    },
+  }
+}
+bsrc={}
+for g=1,num_groups do
+  bsrc[g] = 0.0
+end
+bsrc[1] = 1.0/4.0/math.pi
+
+lbs_options =
+{
+  boundary_conditions =
+  {
+    {
+      name = "xmin",
+      type = "isotropic",
+      group_strength = bsrc
+    }
+  },
+  scattering_order = 1,
+  write_restart_data = true,
+  write_restart_folder_name = "YRestart2DAsync",
+  write_restart_file_base = "restart",
+  write_restart_interval = 0.0,
+  write_restart_async = true,
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+
+SolverInitialize(ss_solver)
+SolverExecute(ss_solver)
+
+--############################################### Get field functions
+fflist,count = LBSGetScalarFieldFunctionList(phys1)
+
+--############################################### Slice plot
+slice2 = FFInterpolationCreate(SLICE)
+FFInterpolationSetProperty(slice2,SLICE_POINT,0.0,0.0,0.025)
+FFInterpolationSetProperty(slice2,ADD_FIELDFUNCTION,fflist[1])
+
+FFInterpolationInitialize(slice2)
+FFInterpolationExecute(slice2)
+
+--############################################### Volume integrations
+ffi1 = FFInterpolationCreate(VOLUME)
+curffi = ffi1
+FFInterpolationSetProperty(curffi,OPERATION,OP_MAX)
+FFInterpolationSetProperty(curffi,LOGICAL_VOLUME,vol0)
+FFInterpolationSetProperty(curffi,ADD_FIELDFUNCTION,fflist[1])
+
+FFInterpolationInitialize(curffi)
+FFInterpolationExecute(curffi)
+maxval = FFInterpolationGetValue(curffi)
+
+Log(LOG_0,string.format("Max-value1=%.5f", maxval))
+
+--############################################### Volume integrations
+ffi1 = FFInterpolationCreate(VOLUME)
+curffi = ffi1
+FFInterpolationSetProperty(curffi,OPERATION,OP_MAX)
+FFInterpolationSetProperty(curffi,LOGICAL_VOLUME,vol0)
+FFInterpolationSetProperty(curffi,ADD_FIELDFUNCTION,fflist[160])
+
+FFInterpolationInitialize(curffi)
+FFInterpolationExecute(curffi)
+maxval = FFInterpolationGetValue(curffi)
+
+Log(LOG_0,string.format("Max-value2=%.5e", maxval))
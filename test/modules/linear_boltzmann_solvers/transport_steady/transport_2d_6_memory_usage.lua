@@ -0,0 +1,120 @@
+-- 2D LinearBSolver memory usage reporting. Every subsystem of an LBS solver
+-- with reflecting boundaries, WGDSA and stored angular fluxes must be reported
+-- with a positive size.
+num_procs = 2
+
+
+
+
+
+--############################################### Check num_procs
+if (check_num_procs==nil and number_of_processes ~= num_procs) then
+  Log(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=10
+L=10.0
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = k*dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes} })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = PhysicsAddMaterial("Test Material");
+
+PhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+PhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 2
+PhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  SIMPLEXS1,num_groups,1.0,0.9)
+
+src={}
+for g=1,num_groups do
+  src[g] = 1.0
+end
+PhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+pquad0 = CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2,false)
+OptimizeAngularQuadratureForPolarSymmetry(pquad0, 4.0*math.pi)
+
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = pquad0,
+      angle_aggregation_num_subsets = 1,
+      groupset_num_subsets = 1,
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-6,
+      l_max_its = 100,
+      gmres_restart_interval = 30,
+      apply_wgdsa = true,
+      wgdsa_l_abs_tol = 1.0e-2,
+    },
+  }
+}
+
+lbs_options =
+{
+  boundary_conditions =
+  {
+   {name = "xmin",type = "reflecting"},
+   {name = "ymin",type = "reflecting"},
+  },
+  scattering_order = 1,
+  save_angular_flux = true,
+  log_memory_usage = true,
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
+
+SolverInitialize(ss_solver)
+SolverExecute(ss_solver)
+
+--############################################### Memory usage
+usage = GetSubsystemMemoryUsage(true)
+subsystems = { "spatial discretization", "unit cell matrices", "flux moments", "psi",
+               "fluds", "reflecting boundaries", "petsc/dsa", "total", "process" }
+num_missing = 0
+num_nonpositive = 0
+for _,subsystem in ipairs(subsystems) do
+  if (usage[subsystem] == nil) then
+    num_missing = num_missing + 1
+    Log(LOG_0,"Missing memory usage of subsystem "..subsystem)
+  elseif (usage[subsystem] <= 0.0) then
+    num_nonpositive = num_nonpositive + 1
+    Log(LOG_0,"Non-positive memory usage of subsystem "..subsystem)
+  end
+end
+Log(LOG_0,string.format("Memory-usage-missing=%d", num_missing))
+Log(LOG_0,string.format("Memory-usage-nonpositive=%d", num_nonpositive))
+
+-- The single-subsystem lookup and the post processor report the same value
+MemoryUsagePostProcessor.Create({ name = "psi_memory", subsystem = "psi" })
+ExecutePostProcessors({"psi_memory"})
+psi_memory = GetSubsystemMemoryUsage(true, "psi")
+Log(LOG_0,string.format("Memory-usage-psi-diff=%.5e",
+  math.abs(PostProcessorGetValue("psi_memory") - usage["psi"]) +
+  math.abs(psi_memory - usage["psi"])))
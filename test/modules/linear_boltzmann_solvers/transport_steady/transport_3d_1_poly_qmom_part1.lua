@@ -107,6 +107,29 @@ SolverExecute(ss_solver)
 
 LBSCreateAndWriteSourceMoments(phys1,"Qmoms")
 
+--############################################### Sweep statistics
+-- A single Richardson iteration of the only groupset is a single sweep. Each
+-- sweep solves 32x32x8 cells for 32 directions and 21 groups. It sends, and
+-- receives, the 4 nodal values of the 2x32x8 faces on the x=0 and y=0
+-- partition boundaries once per direction and group, as 8-byte doubles.
+for _,statistic in ipairs({"num_sweeps", "num_solves", "bytes_sent", "bytes_received"}) do
+  lbs.SweepStatsPostProcessor.Create
+  ({
+    name = statistic,
+    lbs_solver_handle = phys1,
+    statistic = statistic,
+  })
+end
+ExecutePostProcessors({"num_sweeps", "num_solves", "bytes_sent", "bytes_received"})
+num_sweeps = math.floor(PostProcessorGetValue("num_sweeps"))
+Log(LOG_0,string.format("Num-sweeps=%d", num_sweeps))
+Log(LOG_0,string.format("Num-solves-per-sweep=%d",
+  math.floor(PostProcessorGetValue("num_solves") / num_sweeps)))
+Log(LOG_0,string.format("Bytes-sent-per-sweep=%d",
+  math.floor(PostProcessorGetValue("bytes_sent") / num_sweeps)))
+Log(LOG_0,string.format("Bytes-received-per-sweep=%d",
+  math.floor(PostProcessorGetValue("bytes_received") / num_sweeps)))
+
 --############################################### Get field functions
 fflist,count = LBSGetScalarFieldFunctionList(phys1)
 
@@ -2,6 +2,7 @@
 -- SDM: PWLD
 -- Test: Max-value=3.74343e-04
 num_procs = 4
+if (resolve_cycles == nil) then resolve_cycles = false end
 
 
 
@@ -71,24 +72,31 @@ PhysicsMaterialSetProperty(materials[2],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
 --############################################### Setup Physics
 pquad0 = CreateProductQuadrature(GAUSS_LEGENDRE_CHEBYSHEV,2, 2)
 
-lbs_block =
-{
-  num_groups = num_groups,
-  groupsets =
+-- With resolve_cycles the local cycles are also solved lagged, as a
+-- reference, and both solves use a tighter tolerance
+if (resolve_cycles) then l_abs_tol = 1.0e-8 else l_abs_tol = 1.0e-6 end
+function MakeLBSBlock(resolve)
+  return
   {
+    num_groups = num_groups,
+    groupsets =
     {
-      groups_from_to = {0, 20},
-      angular_quadrature_handle = pquad0,
-      --angle_aggregation_type = "single",
-      angle_aggregation_num_subsets = 1,
-      groupset_num_subsets = 1,
-      inner_linear_method = "gmres",
-      l_abs_tol = 1.0e-6,
-      l_max_its = 300,
-      gmres_restart_interval = 30,
-    },
+      {
+        groups_from_to = {0, 20},
+        angular_quadrature_handle = pquad0,
+        --angle_aggregation_type = "single",
+        angle_aggregation_num_subsets = 1,
+        groupset_num_subsets = 1,
+        inner_linear_method = "gmres",
+        l_abs_tol = l_abs_tol,
+        l_max_its = 300,
+        gmres_restart_interval = 30,
+        resolve_local_cycles = resolve,
+      },
+    }
   }
-}
+end
+lbs_block = MakeLBSBlock(resolve_cycles)
 bsrc={}
 for g=1,num_groups do
   bsrc[g] = 0.0
@@ -105,6 +113,42 @@ if (reflecting) then
     {name = "zmax", type = "reflecting"})
 end
 
+--############################################### Volume maxima of groups 0 and 19
+function MaxValues(phys)
+  local fflist,count = LBSGetScalarFieldFunctionList(phys)
+  local values = {}
+  for k,g in ipairs({1, 20}) do
+    local ffi = FFInterpolationCreate(VOLUME)
+    FFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    FFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    FFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[g])
+    FFInterpolationInitialize(ffi)
+    FFInterpolationExecute(ffi)
+    values[k] = FFInterpolationGetValue(ffi)
+  end
+  return values
+end
+
+--############################################### Lagged reference solve
+if (resolve_cycles) then
+  phys0 = lbs.DiscreteOrdinatesSolver.Create(MakeLBSBlock(false))
+  lbs.SetOptions(phys0, lbs_options)
+
+  ss_solver0 = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys0})
+  SolverInitialize(ss_solver0)
+  SolverExecute(ss_solver0)
+
+  lbs.SweepStatsPostProcessor.Create
+  ({
+    name = "num_sweeps_lagged",
+    lbs_solver_handle = phys0,
+    statistic = "num_sweeps",
+  })
+  ExecutePostProcessors({"num_sweeps_lagged"})
+  num_sweeps_lagged = math.floor(PostProcessorGetValue("num_sweeps_lagged"))
+  ref_values = MaxValues(phys0)
+end
+
 phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
 lbs.SetOptions(phys1, lbs_options)
 
@@ -114,6 +158,32 @@ ss_solver = lbs.SteadyStateSolver.Create({lbs_solver_handle = phys1})
 SolverInitialize(ss_solver)
 SolverExecute(ss_solver)
 
+--############################################### Compare with the lagged solve
+-- Resolving the local cycles removes their delayed angular fluxes from the
+-- Krylov system, so it must not need more sweeps than lagging them
+if (resolve_cycles) then
+  lbs.SweepStatsPostProcessor.Create
+  ({
+    name = "num_sweeps_resolved",
+    lbs_solver_handle = phys1,
+    statistic = "num_sweeps",
+  })
+  ExecutePostProcessors({"num_sweeps_resolved"})
+  num_sweeps_resolved = math.floor(PostProcessorGetValue("num_sweeps_resolved"))
+  Log(LOG_0,string.format("Num-sweeps-lagged=%d", num_sweeps_lagged))
+  Log(LOG_0,string.format("Num-sweeps-resolved=%d", num_sweeps_resolved))
+  Log(LOG_0,string.format("Excess-sweeps=%d",
+    math.max(0, num_sweeps_resolved - num_sweeps_lagged)))
+
+  values = MaxValues(phys1)
+  max_rel_diff = 0.0
+  for k=1,2 do
+    max_rel_diff = math.max(max_rel_diff,
+      math.abs(values[k] - ref_values[k]) / math.abs(ref_values[k]))
+  end
+  Log(LOG_0,string.format("Max-rel-diff=%.5e", max_rel_diff))
+end
+
 --############################################### Get field functions
 fflist,count = LBSGetScalarFieldFunctionList(phys1)
 
@@ -0,0 +1,149 @@
+-- 1D 1G transient transport test of an infinite, subcritical medium with one
+-- delayed neutron precursor group. The medium starts without neutrons or
+-- precursors and a unit source is switched on at t=0. The flux stays uniform,
+-- so the theta-scheme reduces to a theta-scheme for the point equations
+--   v^-1 dphi/dt = Q - (sigma_a - nu_p*sigma_f) phi + lambda C
+--   dC/dt = nu_d*sigma_f phi - lambda C
+-- whose discrete solution is computed below as the reference.
+-- SDM: PWLD
+-- Test: theta=0.7: Avg-value=8.58762e-01
+--       theta=0.5: Avg-value=8.63203e-01
+--       theta=1.0: Avg-value=8.52186e-01
+num_procs = 2
+
+--############################################### Check num_procs
+if (check_num_procs==nil and number_of_processes ~= num_procs) then
+  Log(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+if (theta == nil) then theta = 0.7 end
+
+--############################################### Setup mesh
+nodes={}
+N=20
+L=10.0
+dx = L/N
+for i=0,N do
+  nodes[i+1] = i*dx
+end
+
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes} })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = PhysicsAddMaterial("Test Material");
+
+PhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+PhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+num_groups = 1
+PhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  OPENSN_XSFILE,"xs_1g_1p_subcritical.xs")
+
+src={1.0}
+PhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup Physics
+lbs_block =
+{
+  num_groups = num_groups,
+  groupsets =
+  {
+    {
+      groups_from_to = {0, num_groups-1},
+      angular_quadrature_handle = CreateProductQuadrature(GAUSS_LEGENDRE,8),
+      inner_linear_method = "gmres",
+      l_abs_tol = 1.0e-10,
+      l_max_its = 300,
+      gmres_restart_interval = 30,
+    },
+  }
+}
+
+lbs_options =
+{
+  scattering_order = 0,
+  boundary_conditions =
+  {
+    {name = "zmin", type = "reflecting"},
+    {name = "zmax", type = "reflecting"},
+  },
+  use_precursors = true,
+  save_angular_flux = true,
+}
+
+phys1 = lbs.DiscreteOrdinatesSolver.Create(lbs_block)
+lbs.SetOptions(phys1, lbs_options)
+
+--############################################### Initialize and Execute Solver
+time_integration = math.ThetaSchemeTimeIntegration.Create({theta = theta})
+
+dt = 0.1
+end_time = 1.0
+transient_solver = lbs.TransientSolver.Create
+({
+  lbs_solver_handle = phys1,
+  time_integration = time_integration,
+  solve_initial_state = false,
+  dt = dt,
+  end_time = end_time,
+})
+
+SolverInitialize(transient_solver)
+SolverExecute(transient_solver)
+
+--############################################### Get field functions
+fflist,count = LBSGetScalarFieldFunctionList(phys1)
+
+--############################################### Volume integrations
+ffi1 = FFInterpolationCreate(VOLUME)
+FFInterpolationSetProperty(ffi1,OPERATION,OP_AVG)
+FFInterpolationSetProperty(ffi1,LOGICAL_VOLUME,vol0)
+FFInterpolationSetProperty(ffi1,ADD_FIELDFUNCTION,fflist[1])
+
+FFInterpolationInitialize(ffi1)
+FFInterpolationExecute(ffi1)
+avgval = FFInterpolationGetValue(ffi1)
+
+Log(LOG_0,string.format("Avg-value=%.5e", avgval))
+
+ffi2 = FFInterpolationCreate(VOLUME)
+FFInterpolationSetProperty(ffi2,OPERATION,OP_MAX)
+FFInterpolationSetProperty(ffi2,LOGICAL_VOLUME,vol0)
+FFInterpolationSetProperty(ffi2,ADD_FIELDFUNCTION,fflist[1])
+
+FFInterpolationInitialize(ffi2)
+FFInterpolationExecute(ffi2)
+maxval = FFInterpolationGetValue(ffi2)
+
+Log(LOG_0,string.format("Max-value=%.5e", maxval))
+
+--############################################### Reference
+-- sigma_a - nu_p*sigma_f, nu_d*sigma_f and lambda of xs_1g_1p_subcritical.xs
+a = 1.0 - 0.5 - 1.98 * 0.1
+nu_d_sigma_f = 0.02 * 0.1
+lambda = 0.1
+phi_ref = 0.0
+c_ref = 0.0
+eff_dt = theta * dt
+for n = 1, math.floor(end_time / dt + 0.5) do
+  -- Solve at t^{n+theta} with the precursors eliminated, then extrapolate
+  denom = 1.0 + eff_dt * lambda
+  phi_theta = (src[1] + phi_ref / eff_dt + lambda * c_ref / denom) /
+              (a + 1.0 / eff_dt - lambda * eff_dt * nu_d_sigma_f / denom)
+  c_theta = (c_ref + eff_dt * nu_d_sigma_f * phi_theta) / denom
+  phi_ref = (phi_theta - (1.0 - theta) * phi_ref) / theta
+  c_ref = (c_theta - (1.0 - theta) * c_ref) / theta
+end
+
+Log(LOG_0,string.format("Reference-value=%.5e", phi_ref))
+Log(LOG_0,string.format("Max-rel-diff=%.5e",
+  math.max(math.abs(avgval - phi_ref), math.abs(maxval - phi_ref)) / phi_ref))
@@ -0,0 +1,43 @@
+NUM_GROUPS		1
+NUM_MOMENTS	    1
+NUM_PRECURSORS	1
+
+SIGMA_T_BEGIN
+0		1.0
+SIGMA_T_END
+
+SIGMA_F_BEGIN
+0		0.1
+SIGMA_F_END
+
+NU_PROMPT_BEGIN
+0		1.98
+NU_PROMPT_END
+
+NU_DELAYED_BEGIN
+0		0.02
+NU_DELAYED_END
+
+CHI_PROMPT_BEGIN
+0		1.0
+CHI_PROMPT_END
+
+TRANSFER_MOMENTS_BEGIN
+M_GPRIME_G_VAL	0		0		0		0.5
+TRANSFER_MOMENTS_END
+
+INV_VELOCITY_BEGIN
+0		1.0
+INV_VELOCITY_END
+
+PRECURSOR_DECAY_CONSTANTS_BEGIN
+0		0.1
+PRECURSOR_DECAY_CONSTANTS_END
+
+PRECURSOR_FRACTIONAL_YIELDS_BEGIN
+0		1.0
+PRECURSOR_FRACTIONAL_YIELDS_END
+
+CHI_DELAYED_BEGIN
+G_PRECURSOR_VAL 0  0	1.0
+CHI_DELAYED_END
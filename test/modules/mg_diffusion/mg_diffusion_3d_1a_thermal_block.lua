@@ -0,0 +1,91 @@
+-- 3D CFEM multigroup diffusion test of a block of graphite with thermal upscattering.
+-- The problem is solved with group-by-group thermal iterations and with the thermal
+-- block solve. Both must agree.
+-- SDM: PWLC
+-- Test: Max-value1=2.74873e-01, Max-value2=9.47508e-05 and Max-diff2=0.0
+num_procs = 4
+
+--############################################### Check num_procs
+if (check_num_procs==nil and number_of_processes ~= num_procs) then
+  Log(LOG_0ERROR,"Incorrect amount of processors. " ..
+    "Expected "..tostring(num_procs)..
+    ". Pass check_num_procs=false to override if possible.")
+  os.exit(false)
+end
+
+--############################################### Setup mesh
+nodes={}
+N=10
+L=5
+xmin = -L/2
+dx = L/N
+for i=1,(N+1) do
+  k=i-1
+  nodes[i] = xmin + k*dx
+end
+znodes={}
+for i=1,(N/2+1) do
+  k=i-1
+  znodes[i] = xmin + k*dx
+end
+meshgen1 = mesh.OrthogonalMeshGenerator.Create({ node_sets = {nodes,nodes,znodes} })
+mesh.MeshGenerator.Execute(meshgen1)
+
+--############################################### Set Material IDs
+vol0 = mesh.RPPLogicalVolume.Create({infx=true, infy=true, infz=true})
+mesh.SetUniformMaterialID(0)
+
+--############################################### Add materials
+materials = {}
+materials[1] = PhysicsAddMaterial("Test Material");
+
+PhysicsMaterialAddProperty(materials[1],TRANSPORT_XSECTIONS)
+
+PhysicsMaterialAddProperty(materials[1],ISOTROPIC_MG_SOURCE)
+
+
+num_groups = 21
+PhysicsMaterialSetProperty(materials[1],TRANSPORT_XSECTIONS,
+  OPENSN_XSFILE,"../linear_boltzmann_solvers/transport_steady/xs_graphite_pure.xs")
+
+src={}
+for g=1,num_groups do
+  src[g] = 0.0
+end
+src[1] = 1.0
+PhysicsMaterialSetProperty(materials[1],ISOTROPIC_MG_SOURCE,FROM_ARRAY,src)
+
+--############################################### Setup and execute solvers
+zmax_bndry = 4
+function SolveAndGetMaxValues(name, do_thermal_block_solve)
+  local phys = CFEMMGDiffusionSolverCreate(name)
+  SolverSetBasicOption(phys, "residual_tolerance", 1.0e-8)
+  SolverSetBasicOption(phys, "thermal_flux_tolerance", 1.0e-8)
+  SolverSetBasicOption(phys, "do_thermal_block_solve", do_thermal_block_solve)
+  CFEMMGDiffusionSetBCProperty(phys, "boundary_type", zmax_bndry, "reflecting")
+
+  SolverInitialize(phys)
+  SolverExecute(phys)
+
+  local fflist,count = SolverGetFieldFunctionList(phys)
+  local maxvals = {}
+  for k,g in ipairs({1, 20}) do
+    local ffi = FFInterpolationCreate(VOLUME)
+    FFInterpolationSetProperty(ffi,OPERATION,OP_MAX)
+    FFInterpolationSetProperty(ffi,LOGICAL_VOLUME,vol0)
+    FFInterpolationSetProperty(ffi,ADD_FIELDFUNCTION,fflist[g])
+
+    FFInterpolationInitialize(ffi)
+    FFInterpolationExecute(ffi)
+    maxvals[k] = FFInterpolationGetValue(ffi)
+  end
+  return maxvals
+end
+
+maxvals_gs = SolveAndGetMaxValues("MGDiffusionGS", false)
+maxvals_block = SolveAndGetMaxValues("MGDiffusionBlock", true)
+
+Log(LOG_0,string.format("Max-value1=%.5e", maxvals_block[1]))
+Log(LOG_0,string.format("Max-value2=%.5e", maxvals_block[2]))
+Log(LOG_0,string.format("Max-diff1=%.5e", math.abs(maxvals_block[1] - maxvals_gs[1])))
+Log(LOG_0,string.format("Max-diff2=%.5e", math.abs(maxvals_block[2] - maxvals_gs[2])))
@@ -0,0 +1,56 @@
+-- Point-reactor kinetics test of a step reactivity insertion of 0.5$ into a critical
+-- reactor with one delayed neutron precursor group, integrated with the adaptive SDIRK2
+-- scheme. With one precursor group the exact population is a sum of two exponentials,
+-- n(t) = c1*exp(w1*t) + c2*exp(w2*t), where w1 and w2 are the eigenvalues of the
+-- kinetics matrix.
+-- Test: Max-rel-error=0.0
+num_procs = 1
+
+if (time_integration == nil) then time_integration = "sdirk2" end
+
+lambda = 0.1
+beta = 0.0065
+gen_time = 1.0e-4
+rho = 0.5
+
+phys0 = prk.TransientSolver.Create
+({
+  precursor_lambdas = { lambda },
+  precursor_betas = { beta },
+  gen_time = gen_time,
+  initial_source = 0.0,
+  time_integration = time_integration,
+  rel_tol = 1.0e-6,
+  abs_tol = 1.0e-10,
+})
+
+SolverInitialize(phys0)
+prk.SetParam(phys0, "rho", rho)
+
+-- Exact solution
+n0 = SolverGetInfo(phys0, "neutron_population")
+a = beta * (rho - 1.0) / gen_time
+b = beta / gen_time
+disc = math.sqrt((a - lambda)^2 + 4.0 * lambda * (a + b))
+w1 = 0.5 * ((a - lambda) + disc)
+w2 = 0.5 * ((a - lambda) - disc)
+-- c1 + c2 = n0 and c1*w1 + c2*w2 = dn/dt(0) = (a + b)*n0
+c1 = n0 * ((a + b) - w2) / (w1 - w2)
+c2 = n0 - c1
+
+max_rel_error = 0.0
+time = 0.0
+num_steps = 0
+while (time < 1.0) do
+  SolverStep(phys0)
+  time = SolverGetInfo(phys0, "time_next")
+  n = SolverGetInfo(phys0, "population_next")
+  n_exact = c1 * math.exp(w1 * time) + c2 * math.exp(w2 * time)
+  max_rel_error = math.max(max_rel_error, math.abs(n - n_exact) / n_exact)
+  num_steps = num_steps + 1
+  SolverAdvance(phys0)
+end
+
+Log(LOG_0, string.format("Number of steps=%d", num_steps))
+Log(LOG_0, string.format("Population=%.5e", n))
+Log(LOG_0, string.format("Max-rel-error=%.5e", max_rel_error))
@@ -0,0 +1,31 @@
+-- Point-reactor kinetics ensemble test with a single member. The member repeats the
+-- reactivity step of test/framework/post_processors/solver_info_01.lua, where the
+-- single solver is stepped manually and the reactivity is set to 0.8$ after the
+-- step to t=0.11, and must reproduce its populations.
+-- Test: Population-12=3.28513 and Population-20=5.61151
+num_procs = 1
+
+-- The reactivity is evaluated at the end of each implicit Euler step, so the
+-- jump between 0.11 and 0.12 applies the new reactivity from the step to t=0.12 on
+rho_function = math.functions.PiecewiseLinear1D.Create
+({
+  x_values = { 0.115, 0.1151 },
+  y_values = { 0.0, 0.8 },
+})
+
+phys0 = prk.EnsembleSolver.Create
+({
+  num_members = 1,
+  reactivity_functions = { rho_function },
+  dt = 0.01,
+  end_time = 0.2,
+})
+
+SolverInitialize(phys0)
+SolverExecute(phys0)
+
+times = SolverGetInfo(phys0, "history_times")
+populations = SolverGetInfo(phys0, { name = "population_history", member = 0 })
+for k = 2, #times do
+  Log(LOG_0, string.format("Population-%d=%.5f time=%.3f", k - 1, populations[k], times[k]))
+end